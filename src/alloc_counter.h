@@ -0,0 +1,16 @@
+#ifndef ALLOCCOUNTER_H
+#define ALLOCCOUNTER_H
+
+#include <cstdint>
+
+// Counts calls to the global operator new so we can check that steady-state frames don't
+// touch the heap. alloc_counter.cpp replaces the global allocation functions, so this is
+// active for the whole program as soon as it is linked in
+namespace AllocCounter {
+    // Total number of global allocations made since the program started
+    uint64_t getCount();
+    // Total number of bytes requested from the global allocator since the program started
+    uint64_t getBytes();
+}
+
+#endif // ALLOCCOUNTER_H
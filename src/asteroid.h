@@ -2,38 +2,139 @@
 #define ASTEROID_H
 
 #include <raylib-cpp.hpp>
-#include "polar_coordinate.h"
+#include <array>
+#include <cmath>
+#include <random>
+#include <utility>
+#include "components.h"
+#include "game_constants.h"
 
+// Vertex counts that get their own specialised shape storage. Asteroids asking for any other
+// count get the next supported count up (or the largest)
+template <int... Ns>
+struct VertexCounts {};
+using AsteroidVertexCounts = VertexCounts<5, 8, 12, 16>;
+
+// Call f(std::integral_constant<int, I>) for I = 0..N-1, expanded at compile time
+template <int N, typename F, int... Is>
+inline void unroll_impl(F&& f, std::integer_sequence<int, Is...>) {
+    (f(std::integral_constant<int, Is>()), ...);
+}
+
+template <int N, typename F>
+inline void unroll(F&& f) {
+    unroll_impl<N>(f, std::make_integer_sequence<int, N>());
+}
+
+// constexpr sine and cosine for building tables at compile time (std::sin isn't constexpr).
+// Taylor series after reducing the angle to [-pi, pi], which is plenty accurate for floats
+constexpr double constexpr_sin(double x) {
+    while (x > GC::pi) x -= 2*GC::pi;
+    while (x < -GC::pi) x += 2*GC::pi;
+    double term = x;
+    double sum = x;
+    for (int k = 1; k < 12; k++) {
+        term *= -x*x / ((2*k) * (2*k + 1));
+	sum += term;
+    }
+    return sum;
+}
+
+constexpr double constexpr_cos(double x) { return constexpr_sin(x + GC::pi/2); }
+
+// Unit vectors for N vertices evenly spaced around a circle
+template <int N>
+struct UnitCircle {
+    static constexpr std::array<float, N> makeTable(bool cosine) {
+        std::array<float, N> table {};
+	for (int i = 0; i < N; i++) {
+	    double theta = i*(2*GC::pi/N);
+	    table[i] = (float)(cosine ? constexpr_cos(theta) : constexpr_sin(theta));
+	}
+	return table;
+    }
+
+    static constexpr std::array<float, N> cosines = makeTable(true);
+    static constexpr std::array<float, N> sines = makeTable(false);
+};
+
+// Outline of an asteroid with exactly N vertices, stored as each vertex's distance from the
+// centroid. The angles are fixed (evenly spaced) so they come from UnitCircle<N>. Asteroid
+// entities have exactly one AsteroidShape<N> component, so each vertex count is its own
+// archetype and every loop over a shape has a compile-time trip count
+template <int N>
+struct AsteroidShape {
+    std::array<float, N> magnitudes;
+
+    // Randomly generate the distance of each vertex from the centroid with a gaussian around the radius
+    template <typename Generator>
+    static AsteroidShape Random(int radius, int spikiness, Generator& gen) {
+        std::normal_distribution<> gaussDis(radius, spikiness);
+	AsteroidShape shape;
+	for (int i = 0; i < N; i++) {
+	    shape.magnitudes[i] = radius + gaussDis(gen);
+	}
+	return shape;
+    }
+
+    // The vertices' cartesian positions around the centroid at position
+    std::array<Vector2, N> getVertices(Position position) const {
+	std::array<Vector2, N> vertices;
+	unroll<N>([&](auto i) {
+	    vertices[i] = {position.x + magnitudes[i] * UnitCircle<N>::cosines[i], position.y + magnitudes[i] * UnitCircle<N>::sines[i]};
+	});
+	return vertices;
+    }
+
+    void Draw(Position position, Color colour) const {
+	std::array<Vector2, N> vertices = getVertices(position);
+
+	// Draw lines between asteroid's vertices
+	unroll<N>([&](auto i) {
+	    DrawLineV(vertices[i], vertices[(i + 1) % N], colour);
+	});
+    }
+};
+
+// Size of an asteroid. Asteroid entities pair this with a Position, a Velocity and an AsteroidShape<N>
 class Asteroid {
     public:
-	Asteroid(Vector2 pos, float dx, float dy, int siz, int nVert, Color col, int sWidth, int sHeight);
+	Asteroid(int siz, int nVert, Color col);
         
-	void Draw();
-        bool ContainsBullet(Vector2 bulletCoords);
+        bool ContainsBullet(Position position, Vector2 bulletCoords) const;
       
-       	Vector2 getPosition();	
-	float getVelocX();
-	float getVelocY();
-	int getRadius();
-	int getSize();
-	int getNumVertices();
+	int getRadius() const;
+	int getSize() const;
+	int getSpikiness() const;
+	int getNumVertices() const;
+	Color getColour() const;
+	// Distance the centroid can go off screen before the asteroid is entirely out of view
+	float getWrapOffset() const;
     private:
-	Vector2 position;
-	float velocX;
-	float velocY;
-	int radii[3] = {10, 15, 30};
+	static constexpr int radii[3] = {10, 15, 30};
+	static constexpr int spikinesses[3] = {4, 6, 10};
+
 	int radius;
 	int size;
 	int numVertices;
-	int spikinesses[3] = {4, 6, 10};
 	int spikiness; // Standard deviation of the random gaussian process that chooses the euclidian distance from the asteroid's centroid to each vertex, with the radius being the mean
 	Color colour;
-	int SCREEN_WIDTH;
-	int SCREEN_HEIGHT;
-
-	// Keep both for now. TODO: Know numVertices so don't want these to have dynamic length
-	std::vector<PolarCoordinate> polarVertices;
-	std::vector<Vector2> cartesianVertices;
 };
 
+// Call f(std::integral_constant<int, N>()) for the supported vertex count N used for an
+// asteroid asking for numVertices
+template <typename F, int... Ns>
+inline void dispatch_vertex_count(int numVertices, F&& f, VertexCounts<Ns...>) {
+    constexpr int counts[] = {Ns...};
+    constexpr int largest = counts[sizeof...(Ns) - 1];
+    if (numVertices > largest) numVertices = largest;
+    // Stops at the first supported count that is big enough
+    ((numVertices <= Ns ? (f(std::integral_constant<int, Ns>()), true) : false) || ...);
+}
+
+template <typename F>
+inline void dispatch_vertex_count(int numVertices, F&& f) {
+    dispatch_vertex_count(numVertices, f, AsteroidVertexCounts());
+}
+
 #endif // ASTEROID_H
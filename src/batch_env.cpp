@@ -0,0 +1,267 @@
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "batch_env.h"
+#include "raster.h"
+#include "world.h"
+#include "game_constants.h"
+
+// Asteroids start out at up to this many pixels a tick each way
+static constexpr float MAX_ASTEROID_SPEED = 3.0f;
+
+struct AsteroidsEnv {
+    struct Game {
+        std::unique_ptr<World> world;
+	uint32_t episode = 0;
+	int steps = 0;
+    };
+
+    AsteroidsEnvConfig config;
+    std::vector<Game> games;
+
+    // The pool, which steps in rounds the way MatchServer's workers do. The caller's thread
+    // takes the first share of the games itself
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable roundStart;
+    std::condition_variable roundDone;
+    uint64_t round = 0;
+    int busy = 0;
+    bool stopping = false;
+
+    // The call being worked on
+    enum Job { RESET, STEP, RENDER } job = RESET;
+    const int32_t* actions = nullptr;
+    float* obs = nullptr;
+    float* rewards = nullptr;
+    uint8_t* dones = nullptr;
+    uint8_t* frames = nullptr;
+    int frameWidth = 0;
+    int frameHeight = 0;
+};
+
+// Seed for game index's episode, spread out so neighbouring games and episodes look unrelated
+static uint32_t episode_seed(uint32_t seed, int index, uint32_t episode) {
+    uint64_t x = ((uint64_t)seed << 32) ^ ((uint64_t)index << 20) ^ episode;
+    x += 0x9e3779b97f4a7c15ull;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return (uint32_t)(x ^ (x >> 31));
+}
+
+static void start_game(AsteroidsEnv& env, int index) {
+    AsteroidsEnv::Game& game = env.games[index];
+    World& world = *game.world;
+    world.state = GameState(episode_seed(env.config.seed, index, game.episode));
+    world.NewGame(1);
+    world.state.status = PLAYING;
+    game.steps = 0;
+}
+
+static PlayerInput action_input(int32_t action) {
+    PlayerInput input;
+    if (action < 0 || action >= ASTEROIDS_ENV_NUM_ACTIONS) return input;
+    input.fire = action & 1;
+    input.thrust = action & 2;
+    input.left = action >> 2 == 1;
+    input.right = action >> 2 == 2;
+    return input;
+}
+
+static void observe(World& world, float* obs) {
+    std::fill(obs, obs + ASTEROIDS_ENV_OBS_SIZE, 0.0f);
+    Entity ship = world.getShip(0);
+    if (ship == NULL_ENTITY) return;
+
+    const Player& player = world.registry.get<Player>(ship);
+    float w = (float)world.width;
+    float h = (float)world.height;
+    Vector2 centre = player.getMidpoint();
+    Vector2 velocity = player.getVelocity();
+    float length = std::max(std::hypot(player.getDeltaXShip(), player.getDeltaYShip()), 1e-6f);
+    obs[0] = centre.x / w;
+    obs[1] = centre.y / h;
+    obs[2] = velocity.x / MAX_ASTEROID_SPEED;
+    obs[3] = velocity.y / MAX_ASTEROID_SPEED;
+    obs[4] = player.getDeltaXShip() / length;
+    obs[5] = player.getDeltaYShip() / length;
+
+    // The nearest few, kept sorted by insertion
+    struct Near {
+        float distance2;
+	float dx, dy;
+	Entity asteroid;
+	int radius;
+    };
+    Near nearest[ASTEROIDS_ENV_NEAREST];
+    int count = 0;
+    world.asteroids.ForEach([&](Entity e, Position& position, Asteroid& asteroid) {
+        float dx = wrapped(position.x - centre.x, w);
+	float dy = wrapped(position.y - centre.y, h);
+	float distance2 = dx * dx + dy * dy;
+	if (count == ASTEROIDS_ENV_NEAREST && distance2 >= nearest[count - 1].distance2) return;
+	int i = count < ASTEROIDS_ENV_NEAREST ? count++ : count - 1;
+	for (; i > 0 && nearest[i - 1].distance2 > distance2; i--) nearest[i] = nearest[i - 1];
+	nearest[i] = {distance2, dx, dy, e, asteroid.getRadius()};
+    });
+
+    for (int i = 0; i < count; i++) {
+        float* o = obs + 6 + 6 * i;
+	const Velocity& v = world.registry.get<Velocity>(nearest[i].asteroid);
+	o[0] = 1;
+	o[1] = nearest[i].dx / w;
+	o[2] = nearest[i].dy / h;
+	o[3] = v.x / MAX_ASTEROID_SPEED;
+	o[4] = v.y / MAX_ASTEROID_SPEED;
+	o[5] = nearest[i].radius / GC::MAX_ASTEROID_RADIUS;
+    }
+}
+
+static void step_game(AsteroidsEnv& env, int index) {
+    AsteroidsEnv::Game& game = env.games[index];
+    World& world = *game.world;
+    PlayerInput input = action_input(env.actions[index]);
+    int before = world.state.score;
+    bool over = false;
+    for (int t = 0; t < env.config.frameSkip && !over; t++) {
+        world.Tick(&input, 1);
+	if (world.state.status == NEXT_LEVEL) world.state.status = PLAYING;
+	over = world.state.status == GAME_OVER;
+    }
+    env.rewards[index] = (float)(world.state.score - before);
+    game.steps++;
+
+    bool done = over || (env.config.maxEpisodeSteps > 0 && game.steps >= env.config.maxEpisodeSteps);
+    env.dones[index] = done;
+    if (done) {
+        game.episode++;
+	start_game(env, index);
+    }
+}
+
+static void render_game(AsteroidsEnv& env, int index) {
+    size_t frameSize = (size_t)env.frameWidth * env.frameHeight;
+    GrayImage image{env.frames + index * frameSize, env.frameWidth, env.frameHeight, env.frameWidth};
+    raster_world(*env.games[index].world, image);
+}
+
+// Do the current job for the part'th share of the games
+static void run_part(AsteroidsEnv& env, int part) {
+    int numParts = (int)env.threads.size() + 1;
+    int numEnvs = (int)env.games.size();
+    int begin = (int)((int64_t)numEnvs * part / numParts);
+    int end = (int)((int64_t)numEnvs * (part + 1) / numParts);
+    for (int i = begin; i < end; i++) {
+        if (env.job == AsteroidsEnv::RENDER) {
+	    render_game(env, i);
+	    continue;
+	}
+	if (env.job == AsteroidsEnv::STEP) step_game(env, i);
+	else start_game(env, i);
+	observe(*env.games[i].world, env.obs + (size_t)i * ASTEROIDS_ENV_OBS_SIZE);
+    }
+}
+
+static void thread_loop(AsteroidsEnv& env, int part) {
+    uint64_t seen = 0;
+    std::unique_lock<std::mutex> lock(env.mutex);
+    while (true) {
+        env.roundStart.wait(lock, [&] { return env.round != seen || env.stopping; });
+	if (env.stopping) return;
+	seen = env.round;
+	lock.unlock();
+
+	run_part(env, part);
+
+	lock.lock();
+	if (--env.busy == 0) env.roundDone.notify_one();
+    }
+}
+
+// Run one round over every game, on every thread
+static void run_round(AsteroidsEnv& env) {
+    {
+        std::lock_guard<std::mutex> lock(env.mutex);
+	env.busy = (int)env.threads.size();
+	env.round++;
+    }
+    env.roundStart.notify_all();
+    run_part(env, 0);
+    std::unique_lock<std::mutex> lock(env.mutex);
+    env.roundDone.wait(lock, [&] { return env.busy == 0; });
+}
+
+extern "C" {
+
+AsteroidsEnvConfig asteroids_env_default_config(void) {
+    AsteroidsEnvConfig config;
+    config.numEnvs = 64;
+    config.numThreads = 0;
+    config.frameSkip = 4;
+    config.maxEpisodeSteps = 0;
+    config.seed = 1;
+    return config;
+}
+
+AsteroidsEnv* asteroids_env_create(const AsteroidsEnvConfig* config) {
+    if (!config || config->numEnvs < 1 || config->numThreads < 0 || config->frameSkip < 1 || config->maxEpisodeSteps < 0) return nullptr;
+
+    auto env = std::make_unique<AsteroidsEnv>();
+    env->config = *config;
+    env->games.resize(config->numEnvs);
+    for (int i = 0; i < config->numEnvs; i++) {
+        env->games[i].world = std::make_unique<World>(GC::SCREEN_WIDTH, GC::SCREEN_HEIGHT, 0);
+	start_game(*env, i);
+    }
+
+    int numThreads = config->numThreads > 0 ? config->numThreads : (int)std::max(1u, std::thread::hardware_concurrency());
+    numThreads = std::min(numThreads, config->numEnvs);
+    for (int i = 1; i < numThreads; i++) env->threads.emplace_back(thread_loop, std::ref(*env), i);
+    return env.release();
+}
+
+void asteroids_env_destroy(AsteroidsEnv* env) {
+    if (!env) return;
+    {
+        std::lock_guard<std::mutex> lock(env->mutex);
+	env->stopping = true;
+    }
+    env->roundStart.notify_all();
+    for (std::thread& thread : env->threads) thread.join();
+    delete env;
+}
+
+int asteroids_env_num_envs(const AsteroidsEnv* env) {
+    return (int)env->games.size();
+}
+
+void asteroids_env_reset(AsteroidsEnv* env, float* obs) {
+    for (AsteroidsEnv::Game& game : env->games) game.episode++;
+    env->job = AsteroidsEnv::RESET;
+    env->obs = obs;
+    run_round(*env);
+}
+
+void asteroids_env_step(AsteroidsEnv* env, const int32_t* actions, float* obs, float* rewards, uint8_t* dones) {
+    env->job = AsteroidsEnv::STEP;
+    env->actions = actions;
+    env->obs = obs;
+    env->rewards = rewards;
+    env->dones = dones;
+    run_round(*env);
+}
+
+void asteroids_env_render(AsteroidsEnv* env, uint8_t* frames, int width, int height) {
+    if (width < 1 || height < 1) return;
+    env->job = AsteroidsEnv::RENDER;
+    env->frames = frames;
+    env->frameWidth = width;
+    env->frameHeight = height;
+    run_round(*env);
+}
+
+}
@@ -0,0 +1,83 @@
+#ifndef BATCH_ENV_H
+#define BATCH_ENV_H
+
+// Batched environment for reinforcement learning, with a C API so it can be loaded from
+// Python (ctypes, cffi) or anything else that speaks C. Built into bin/libasteroids_env.so by
+// "make envlib", which leaves out drawing and raylib.
+//
+// One AsteroidsEnv holds numEnvs independent single-player games, each with a random number
+// generator of its own. Every step takes one action per game and steps all of them, spread
+// over a pool of threads, writing observations, rewards and done flags into arrays the caller
+// allocates once:
+//
+//     float obs[numEnvs * ASTEROIDS_ENV_OBS_SIZE], rewards[numEnvs];
+//     uint8_t dones[numEnvs];
+//     asteroids_env_reset(env, obs);
+//     for (;;) asteroids_env_step(env, actions, obs, rewards, dones);
+//
+// A game that ends is reset on the spot: its done flag is set and the observation written is
+// the first one of its next game.
+//
+// Actions are numbered 0 to ASTEROIDS_ENV_NUM_ACTIONS - 1, with bit 0 for fire, bit 1 for
+// thrust and the rest choosing between no turn (0), turning left (1) and right (2): action =
+// turn * 4 + thrust * 2 + fire. The reward is the points scored over the step.
+//
+// An observation is ASTEROIDS_ENV_OBS_SIZE floats, all roughly within -1 to 1:
+//     [0, 1]  the ship's position, as a fraction of the arena
+//     [2, 3]  its velocity, in units of the top asteroid speed
+//     [4, 5]  which way it's pointing, as a unit vector
+//     then for each of the ASTEROIDS_ENV_NEAREST nearest asteroids, nearest first:
+//             1 if there is one (all zeros past the last), where it is relative to the ship
+//             the shortest way round the arena as a fraction of the arena, its velocity in
+//             units of the top asteroid speed, and its radius relative to the largest
+//
+// For agents that learn from pixels, asteroids_env_render draws every game into grayscale
+// frames on the CPU (see raster.h), at whatever resolution the caller asks for, 84x84 and up
+// being the usual. It needs no GPU or window, so it works in the library too.
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum {
+    ASTEROIDS_ENV_NUM_ACTIONS = 12,
+    ASTEROIDS_ENV_NEAREST = 8,
+    ASTEROIDS_ENV_OBS_SIZE = 6 + 6 * ASTEROIDS_ENV_NEAREST
+};
+
+typedef struct AsteroidsEnvConfig {
+    int numEnvs;
+    // Threads to step on, counting the caller's. 0 uses one per hardware thread
+    int numThreads;
+    // Ticks each action is repeated for
+    int frameSkip;
+    // Steps after which a game is ended and reset even if it isn't over. 0 for no limit
+    int maxEpisodeSteps;
+    // Game i's first seed is derived from this and i
+    uint32_t seed;
+} AsteroidsEnvConfig;
+
+typedef struct AsteroidsEnv AsteroidsEnv;
+
+AsteroidsEnvConfig asteroids_env_default_config(void);
+// Returns null if the config is out of range
+AsteroidsEnv* asteroids_env_create(const AsteroidsEnvConfig* config);
+void asteroids_env_destroy(AsteroidsEnv* env);
+int asteroids_env_num_envs(const AsteroidsEnv* env);
+
+// Start every game again and write their first observations
+void asteroids_env_reset(AsteroidsEnv* env, float* obs);
+// Step every game with actions[i], then write obs[numEnvs * ASTEROIDS_ENV_OBS_SIZE],
+// rewards[numEnvs] and dones[numEnvs]. Out of range actions do nothing
+void asteroids_env_step(AsteroidsEnv* env, const int32_t* actions, float* obs, float* rewards, uint8_t* dones);
+// Draw game i as it is now into frames[i * height * width], height rows of width bytes, black
+// background, shapes in shades of grey. Does nothing if either size isn't positive
+void asteroids_env_render(AsteroidsEnv* env, uint8_t* frames, int width, int height);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BATCH_ENV_H
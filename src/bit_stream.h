@@ -0,0 +1,157 @@
+#ifndef BIT_STREAM_H
+#define BIT_STREAM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Bit-level writer and reader for compact encodings. Bits are packed least significant first,
+// so the same bytes come out on every machine whatever its byte order.
+//
+// Besides plain fixed-width fields there are exponential-Golomb codes for unsigned numbers
+// (small values take few bits: 0 is 1 bit, 1-2 are 3 bits, 3-6 are 5 bits, ...) and zigzag
+// mapping for signed ones, which makes small differences cheap
+
+inline uint64_t zigzag(int64_t v) { return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63); }
+inline int64_t unzigzag(uint64_t v) { return (int64_t)(v >> 1) ^ -(int64_t)(v & 1); }
+
+inline uint32_t float_bits(float f) {
+    uint32_t bits;
+    std::memcpy(&bits, &f, sizeof(bits));
+    return bits;
+}
+
+inline float bits_float(uint32_t bits) {
+    float f;
+    std::memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+class BitWriter {
+    public:
+	// Appends to out, which is cleared first. Its capacity is kept
+	BitWriter(std::vector<uint8_t>& o) : out(o) { out.clear(); }
+
+	// Write the low bits of value. bits can be 0 to 64
+	void Write(uint64_t value, int bits) {
+	    if (bits > 32) {
+	        write32(value & 0xffffffffu, 32);
+		write32(value >> 32, bits - 32);
+	    } else {
+	        write32(value, bits);
+	    }
+	}
+
+	void WriteBit(bool bit) { write32(bit ? 1 : 0, 1); }
+
+	// Exponential-Golomb code for any value up to UINT64_MAX - 1
+	void WriteGolomb(uint64_t value) {
+	    uint64_t x = value + 1;
+	    int n = 64 - __builtin_clzll(x);
+	    // n - 1 zeros and a one, then the bits of x below its leading one
+	    Write(1ull << (n - 1), n);
+	    Write(x, n - 1);
+	}
+
+	void WriteSigned(int64_t value) { WriteGolomb(zigzag(value)); }
+
+	void WriteBytes(const void* data, size_t size) {
+	    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+	    for (size_t i = 0; i < size; i++) write32(bytes[i], 8);
+	}
+
+	// Pad to a whole byte. Call once everything has been written
+	void Flush() {
+	    while (filled > 0) {
+	        out.push_back((uint8_t)acc);
+		acc >>= 8;
+		filled = filled > 8 ? filled - 8 : 0;
+	    }
+	}
+
+	size_t getBitCount() const { return out.size() * 8 + filled; }
+    private:
+	void write32(uint64_t value, int bits) {
+	    if (bits == 0) return;
+	    acc |= (value & ((1ull << bits) - 1)) << filled;
+	    filled += bits;
+	    if (filled >= 32) {
+	        uint32_t word = (uint32_t)acc;
+		out.push_back((uint8_t)word);
+		out.push_back((uint8_t)(word >> 8));
+		out.push_back((uint8_t)(word >> 16));
+		out.push_back((uint8_t)(word >> 24));
+		acc >>= 32;
+		filled -= 32;
+	    }
+	}
+
+	std::vector<uint8_t>& out;
+	uint64_t acc = 0;
+	int filled = 0;
+};
+
+// Reading past the end gives zeros and marks the stream bad, so a decoder can read a whole
+// record and check isGood() afterwards instead of after every field
+class BitReader {
+    public:
+	BitReader(const uint8_t* d, size_t s) : data(d), size(s) {}
+
+	uint64_t Read(int bits) {
+	    if (bits > 32) {
+	        uint64_t low = read32(32);
+		return low | (read32(bits - 32) << 32);
+	    }
+	    return read32(bits);
+	}
+
+	bool ReadBit() { return read32(1) != 0; }
+
+	uint64_t ReadGolomb() {
+	    int zeros = 0;
+	    while (read32(1) == 0) {
+	        if (++zeros > 63 || !good) {
+		    good = false;
+		    return 0;
+		}
+	    }
+	    uint64_t rest = Read(zeros);
+	    return ((1ull << zeros) | rest) - 1;
+	}
+
+	int64_t ReadSigned() { return unzigzag(ReadGolomb()); }
+
+	void ReadBytes(void* dest, size_t n) {
+	    uint8_t* bytes = static_cast<uint8_t*>(dest);
+	    for (size_t i = 0; i < n; i++) bytes[i] = (uint8_t)read32(8);
+	}
+
+	bool isGood() const { return good; }
+	// Upper bound on the bits still to come, for sanity-checking counts read from the stream
+	size_t getBitsLeft() const { return (size - pos) * 8 + filled; }
+    private:
+	uint64_t read32(int bits) {
+	    if (bits == 0) return 0;
+	    while (filled < bits) {
+	        uint64_t byte = 0;
+		if (pos < size) byte = data[pos++];
+		else good = false;
+		acc |= byte << filled;
+		filled += 8;
+	    }
+	    uint64_t value = acc & ((1ull << bits) - 1);
+	    acc >>= bits;
+	    filled -= bits;
+	    return value;
+	}
+
+	const uint8_t* data;
+	size_t size;
+	size_t pos = 0;
+	uint64_t acc = 0;
+	int filled = 0;
+	bool good = true;
+};
+
+#endif // BIT_STREAM_H
@@ -1,15 +1,23 @@
+#ifndef BULLET_H
+#define BULLET_H
+
 #include <raylib-cpp.hpp>
+#include "components.h"
 
+// Bullet entities pair this with a Position and a Velocity
 class Bullet {
     public:
-	Bullet(Vector2 pos, float dx, float dy);
-	void Draw();
-	Vector2 getPosition() const;
-	bool IsOffScreen(int SCREEN_WIDTH, int SCREEN_HEIGHT);
+	Bullet(int ownerSlot = 0);
+	void Draw(Position position) const;
+	bool IsOffScreen(Position position, int SCREEN_WIDTH, int SCREEN_HEIGHT) const;
+	// Slot of the player who fired it
+	int getOwner() const;
+	float getRadius() const;
+	Color getColour() const;
     private:
-        Vector2 position;
-	float velocX;
-	float velocY;
 	float radius = 2;
 	Color color = WHITE;
+	int owner;
 };
+
+#endif // BULLET_H
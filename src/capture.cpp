@@ -0,0 +1,278 @@
+#include <glad.h>
+#include <raylib.h>
+#include <rlgl.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include "capture.h"
+#include "process_stats.h"
+
+using Clock = std::chrono::steady_clock;
+
+// Frames a readback is left on the GPU before it's collected, by when it's long finished
+static constexpr uint64_t READBACK_LAG = 2;
+
+FrameCapture::FrameCapture(CaptureSettings s) : settings(s) {
+    settings.maxQueued = std::max(settings.maxQueued, 1);
+    settings.gifFrameInterval = std::max(settings.gifFrameInterval, 1);
+    thread = std::thread(&FrameCapture::run, this);
+}
+
+FrameCapture::~FrameCapture() {
+    if (recording) ToggleRecording();
+    collectAll();
+    if (!allBuffers.empty()) glDeleteBuffers((GLsizei)allBuffers.size(), allBuffers.data());
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+	stopping = true;
+    }
+    ready.notify_one();
+    thread.join();
+}
+
+void FrameCapture::TakeScreenshot() { screenshotWanted = true; }
+
+void FrameCapture::ToggleRecording() {
+    Job job;
+    if (recording) {
+        // The frames still on the GPU belong to this recording
+	collectAll();
+	job.kind = JobKind::GIF_END;
+    } else {
+        job.kind = JobKind::GIF_BEGIN;
+	job.path = TextFormat("%s/recording%03i.gif", settings.directory.c_str(), numRecordings++);
+	recordingStart = frame;
+	// The first frame is shown for as long as the rest
+	lastGifFrame = (int64_t)frame - settings.gifFrameInterval;
+    }
+    recording = !recording;
+    push(std::move(job));
+}
+
+void FrameCapture::Capture() {
+    auto start = Clock::now();
+    bool worked = false;
+    while (!readbacks.empty() && readbacks.front().frame + READBACK_LAG <= frame) {
+        collect(readbacks.front());
+	readbacks.erase(readbacks.begin());
+	worked = true;
+    }
+
+    bool gifFrame = recording && (frame - recordingStart) % settings.gifFrameInterval == 0;
+    if (screenshotWanted || gifFrame) {
+        bool full;
+	{
+	    std::lock_guard<std::mutex> lock(mutex);
+	    full = inFlight + (int)readbacks.size() >= settings.maxQueued;
+	    if (full && gifFrame) stats.dropped++;
+	}
+	// A screenshot that doesn't fit is tried again next frame
+	if (!full) {
+	    Readback readback = {0, GetRenderWidth(), GetRenderHeight(), screenshotWanted, gifFrame, frame};
+	    screenshotWanted = false;
+	    // What's been drawn so far is still waiting in raylib's batch
+	    rlDrawRenderBatchActive();
+	    if (glad_glMapBufferRange) {
+	        if (spareBuffers.empty()) {
+		    unsigned int buffer;
+		    glGenBuffers(1, &buffer);
+		    allBuffers.push_back(buffer);
+		    spareBuffers.push_back(buffer);
+		}
+		readback.buffer = spareBuffers.back();
+		spareBuffers.pop_back();
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.buffer);
+		glBufferData(GL_PIXEL_PACK_BUFFER, (GLsizeiptr)readback.width * readback.height * 4, nullptr, GL_STREAM_READ);
+		glReadPixels(0, 0, readback.width, readback.height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		readbacks.push_back(readback);
+	    } else {
+	        // Without buffer objects (OpenGL 1.1) all there is is reading straight back
+		unsigned char* pixels = rlReadScreenPixels(readback.width, readback.height);
+		handOver(pixels, readback.width, readback.height, false, readback.screenshot, readback.gifFrame, frame);
+		MemFree(pixels);
+	    }
+	}
+	worked = true;
+    }
+    frame++;
+
+    if (worked) {
+        std::lock_guard<std::mutex> lock(mutex);
+	stats.frameTimes.Record(seconds_since(start));
+    }
+}
+
+void FrameCapture::collect(const Readback& readback) {
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, readback.buffer);
+    const void* mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, (GLsizeiptr)readback.width * readback.height * 4, GL_MAP_READ_BIT);
+    if (mapped) {
+        handOver((const uint8_t*)mapped, readback.width, readback.height, true, readback.screenshot, readback.gifFrame, readback.frame);
+	glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    spareBuffers.push_back(readback.buffer);
+}
+
+void FrameCapture::collectAll() {
+    for (const Readback& readback : readbacks) collect(readback);
+    readbacks.clear();
+}
+
+bool FrameCapture::SubmitFrame(const uint8_t* pixels, int width, int height, bool screenshot, bool gifFrame) {
+    bool handedOver = handOver(pixels, width, height, false, screenshot, gifFrame && recording, frame);
+    frame++;
+    return handedOver;
+}
+
+bool FrameCapture::handOver(const uint8_t* pixels, int width, int height, bool bottomUp, bool screenshot, bool gifFrame, uint64_t atFrame) {
+    size_t size = (size_t)width * height * 4;
+    bool handedOver = true;
+    if (screenshot) {
+        Job job;
+	if (acquire(job.pixels)) {
+	    job.kind = JobKind::SCREENSHOT;
+	    job.pixels.assign(pixels, pixels + size);
+	    job.width = width;
+	    job.height = height;
+	    job.bottomUp = bottomUp;
+	    job.path = TextFormat("%s/screenshot%03i.png", settings.directory.c_str(), numScreenshots++);
+	    push(std::move(job));
+	} else {
+	    handedOver = false;
+	}
+    }
+    if (gifFrame) {
+        Job job;
+	if (acquire(job.pixels)) {
+	    job.kind = JobKind::GIF_FRAME;
+	    job.pixels.assign(pixels, pixels + size);
+	    job.width = width;
+	    job.height = height;
+	    job.bottomUp = bottomUp;
+	    // In whole hundredths of a second from the start, so rounding doesn't add up
+	    job.centiseconds = (int)((int64_t)atFrame * 100 / GC::FPS - lastGifFrame * 100 / GC::FPS);
+	    lastGifFrame = (int64_t)atFrame;
+	    push(std::move(job));
+	} else {
+	    handedOver = false;
+	}
+    }
+    return handedOver;
+}
+
+bool FrameCapture::acquire(std::vector<uint8_t>& pixels) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (inFlight >= settings.maxQueued) {
+        stats.dropped++;
+	return false;
+    }
+    inFlight++;
+    if (!pool.empty()) {
+        pixels.swap(pool.back());
+	pool.pop_back();
+    }
+    return true;
+}
+
+void FrameCapture::push(Job job) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+	queue.push_back(std::move(job));
+    }
+    ready.notify_one();
+}
+
+void FrameCapture::Flush() {
+    std::unique_lock<std::mutex> lock(mutex);
+    idle.wait(lock, [&] { return queue.empty() && !busy; });
+}
+
+CaptureStats FrameCapture::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
+
+void FrameCapture::run() {
+    run_at_idle_priority();
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        ready.wait(lock, [&] { return !queue.empty() || stopping; });
+	if (queue.empty()) break;
+	Job job = std::move(queue.front());
+	queue.pop_front();
+	busy = true;
+	lock.unlock();
+
+	auto start = Clock::now();
+	bool written = write(job);
+	double seconds = seconds_since(start);
+
+	lock.lock();
+	busy = false;
+	if (!written) stats.failed++;
+	else if (job.kind == JobKind::SCREENSHOT) stats.screenshots++;
+	else if (job.kind == JobKind::GIF_FRAME) stats.gifFrames++;
+	else if (job.kind == JobKind::GIF_END) stats.gifs++;
+	if (job.kind == JobKind::SCREENSHOT || job.kind == JobKind::GIF_FRAME) {
+	    stats.encodeTimes.Record(seconds);
+	    pool.push_back(std::move(job.pixels));
+	    inFlight--;
+	}
+	if (queue.empty()) idle.notify_all();
+    }
+}
+
+bool FrameCapture::write(Job& job) {
+    switch (job.kind) {
+        case JobKind::SCREENSHOT: {
+	    size_t pitch = (size_t)job.width * 4;
+	    if (job.bottomUp) {
+	        row.resize(pitch);
+		for (int y = 0; y < job.height / 2; y++) {
+		    uint8_t* top = job.pixels.data() + y * pitch;
+		    uint8_t* bottom = job.pixels.data() + (job.height - 1 - y) * pitch;
+		    std::memcpy(row.data(), top, pitch);
+		    std::memcpy(top, bottom, pitch);
+		    std::memcpy(bottom, row.data(), pitch);
+		}
+	    }
+	    // The framebuffer's alpha is whatever blending left, and a PNG would keep it
+	    for (size_t i = 3; i < job.pixels.size(); i += 4) job.pixels[i] = 255;
+	    Image image = {job.pixels.data(), job.width, job.height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+	    return ExportImage(image, job.path.c_str());
+	}
+	case JobKind::GIF_BEGIN:
+	    // The file is started by the first frame, once its size is known
+	    gifPath = job.path;
+	    return true;
+	case JobKind::GIF_FRAME: {
+	    if (!gifFile) {
+	        if (gifPath.empty()) return false;
+		gifFile = std::fopen(gifPath.c_str(), "wb");
+		gifPath.clear();
+		if (!gifFile) return false;
+		gifWidth = job.width;
+		gifHeight = job.height;
+		if (!msf_gif_begin_to_file(&gif, gifWidth, gifHeight, (MsfGifFileWriteFunc)std::fwrite, gifFile)) {
+		    std::fclose(gifFile);
+		    gifFile = nullptr;
+		    return false;
+		}
+	    }
+	    // A window resized mid-recording can't change the GIF's size
+	    if (job.width != gifWidth || job.height != gifHeight) return false;
+	    int pitch = job.width * 4;
+	    return msf_gif_frame_to_file(&gif, job.pixels.data(), job.centiseconds, 16, job.bottomUp ? -pitch : pitch);
+	}
+	case JobKind::GIF_END: {
+	    gifPath.clear();
+	    if (!gifFile) return false;
+	    bool ended = msf_gif_end_to_file(&gif);
+	    ended = std::fclose(gifFile) == 0 && ended;
+	    gifFile = nullptr;
+	    return ended;
+	}
+    }
+    return false;
+}
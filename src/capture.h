@@ -0,0 +1,145 @@
+#ifndef CAPTURE_H
+#define CAPTURE_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <msf_gif.h>
+#include "latency_histogram.h"
+#include "game_constants.h"
+
+struct CaptureSettings {
+    // Frames read back but not yet written, past which new ones are dropped
+    int maxQueued = GC::CAPTURE_MAX_QUEUED;
+    // A GIF keeps one frame in this many
+    int gifFrameInterval = GC::CAPTURE_GIF_FRAME_INTERVAL;
+    // Where screenshotNNN.png and recordingNNN.gif go
+    std::string directory = ".";
+};
+
+struct CaptureStats {
+    uint64_t screenshots = 0;
+    uint64_t gifFrames = 0;
+    uint64_t gifs = 0;
+    // Frames thrown away because maxQueued were already waiting, and files that couldn't be
+    // written
+    uint64_t dropped = 0;
+    uint64_t failed = 0;
+    // Time the frame loop spends on a capture, reading back and handing over a frame, and the
+    // background thread's time encoding and writing one
+    LatencyHistogram frameTimes;
+    LatencyHistogram encodeTimes;
+};
+
+// Screenshots and GIF recordings that cost the frame loop next to nothing.
+//
+// raylib's own F12 capture reads the screen back while the GPU finishes drawing, flips it a
+// byte at a time, then encodes and writes it, all before the frame can end, so taking one or
+// recording hitches the game. Here Capture() only asks for the framebuffer to be copied into a
+// GPU buffer, and picks the copy up a couple of frames later when it's long done, with one
+// memcpy into a buffer from a pool. Flipping, encoding and writing the file happen on a thread
+// of its own. The pool holds maxQueued buffers, so if the writer falls behind frames are
+// dropped and counted rather than piling up; a GIF frame that's dropped lengthens the one
+// before it, so the recording keeps the game's pace
+class FrameCapture {
+    public:
+	FrameCapture(CaptureSettings s = CaptureSettings());
+	FrameCapture(const FrameCapture&) = delete;
+	FrameCapture& operator=(const FrameCapture&) = delete;
+	// Finishes any recording and writes whatever is still queued. Needs the window still
+	// open, for the buffers on the GPU
+	~FrameCapture();
+
+	// Save the next frame Capture() sees as a PNG
+	void TakeScreenshot();
+	// Start recording a GIF, or finish the one being recorded
+	void ToggleRecording();
+	bool isRecording() const { return recording; }
+
+	// Call every frame once it is all drawn, before EndDrawing()
+	void Capture();
+	// Hand over a frame that didn't come from the screen: width * height RGBA pixels, rows
+	// top first. What Capture() does with the pixels it reads back, for tools without a
+	// window. Returns false if it was dropped
+	bool SubmitFrame(const uint8_t* pixels, int width, int height, bool screenshot, bool gifFrame);
+
+	// Wait for everything queued so far to be written
+	void Flush();
+	CaptureStats getStats() const;
+    private:
+	enum class JobKind { SCREENSHOT, GIF_BEGIN, GIF_FRAME, GIF_END };
+	struct Job {
+	    JobKind kind;
+	    // Pooled, or empty for GIF_BEGIN and GIF_END
+	    std::vector<uint8_t> pixels;
+	    int width = 0;
+	    int height = 0;
+	    // Rows bottom first, as OpenGL reads them
+	    bool bottomUp = false;
+	    // For GIF_FRAME, hundredths of a second it's shown for
+	    int centiseconds = 0;
+	    std::string path;
+	};
+	// A framebuffer read into a GPU buffer and not yet collected
+	struct Readback {
+	    unsigned int buffer = 0;
+	    int width = 0;
+	    int height = 0;
+	    bool screenshot = false;
+	    bool gifFrame = false;
+	    uint64_t frame = 0;
+	};
+
+	// A buffer from the pool, or false if maxQueued frames are already waiting
+	bool acquire(std::vector<uint8_t>& pixels);
+	void push(Job job);
+	// Hand over the frame in readback, waiting for the GPU if it hasn't finished
+	void collect(const Readback& readback);
+	void collectAll();
+	// Queue pixels to be written, as a screenshot, a GIF frame or both
+	bool handOver(const uint8_t* pixels, int width, int height, bool bottomUp, bool screenshot, bool gifFrame, uint64_t atFrame);
+	void run();
+	// Returns false if the file couldn't be written
+	bool write(Job& job);
+
+	CaptureSettings settings;
+	uint64_t frame = 0;
+	bool screenshotWanted = false;
+	bool recording = false;
+	int numScreenshots = 0;
+	int numRecordings = 0;
+	uint64_t recordingStart = 0;
+	// GIF frames are shown until the next: each is given the time since the one before
+	int64_t lastGifFrame = 0;
+	// Only used on the thread that draws
+	std::vector<Readback> readbacks;
+	std::vector<unsigned int> spareBuffers;
+	std::vector<unsigned int> allBuffers;
+
+	std::thread thread;
+	mutable std::mutex mutex;
+	std::condition_variable ready;
+	std::condition_variable idle;
+	std::deque<Job> queue;
+	std::vector<std::vector<uint8_t>> pool;
+	// Buffers out of the pool
+	int inFlight = 0;
+	bool busy = false;
+	bool stopping = false;
+	CaptureStats stats;
+
+	// Only touched by the thread
+	MsfGifState gif = {};
+	FILE* gifFile = nullptr;
+	std::string gifPath;
+	int gifWidth = 0;
+	int gifHeight = 0;
+	std::vector<uint8_t> row;
+};
+
+#endif // CAPTURE_H
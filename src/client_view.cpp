@@ -0,0 +1,262 @@
+#include <algorithm>
+#include <cmath>
+#include "client_view.h"
+#include "snapshot.h"
+
+using Clock = std::chrono::steady_clock;
+
+// A correction bigger than this (a ship wrapping round the screen, or a new game) is a jump,
+// not something to smooth out
+static constexpr float MAX_SMOOTHED_CORRECTION = 100;
+// How hard the render clock is steered towards where it should be, per tick it's off, and the
+// most it can be sped up or slowed down by
+static constexpr double CLOCK_GAIN = 0.05;
+static constexpr double MAX_CLOCK_ADJUST = 0.1;
+// Further off than this, the render clock jumps instead
+static constexpr double MAX_CLOCK_ERROR = 8;
+
+ClientView::ClientView(const ClientViewSettings& s)
+    : settings(s),
+      predicted(GC::SCREEN_WIDTH, GC::SCREEN_HEIGHT, 0),
+      view(GC::SCREEN_WIDTH, GC::SCREEN_HEIGHT, 0),
+      next(GC::SCREEN_WIDTH, GC::SCREEN_HEIGHT, 0) {
+    setInterpolationTicks(settings.interpolationTicks);
+    Reset(0);
+}
+
+void ClientView::setInterpolationTicks(float ticks) {
+    settings.interpolationTicks = std::clamp(ticks, 0.0f, (float)(SNAPSHOT_BUFFER - 2));
+}
+
+void ClientView::Reset(int s) {
+    slot = s;
+    for (auto& r : received) r.tick = NO_TICK;
+    newestTick = NO_TICK;
+    newSnapshot = false;
+    std::fill(std::begin(inputFrames), std::end(inputFrames), NO_TICK);
+    predictedFrame = NO_TICK;
+    correction = {0, 0};
+    renderTick = -1;
+    viewTick = NO_TICK;
+    nextTick = NO_TICK;
+    shownDisplay = NO_TICK;
+    shownSnapshot = NO_TICK;
+    shownInterpolated = NO_TICK;
+    countedDisplay = NO_TICK;
+    countedSnapshot = NO_TICK;
+    countedInterpolated = NO_TICK;
+}
+
+void ClientView::AddSnapshot(uint32_t tick, uint32_t lastApplied, const std::vector<std::byte>& snapshot) {
+    // Too old to ever be drawn
+    if (newestTick != NO_TICK && tick + SNAPSHOT_BUFFER <= newestTick) return;
+    Received& r = received[tick % SNAPSHOT_BUFFER];
+    r.tick = tick;
+    r.lastApplied = lastApplied;
+    r.data.assign(snapshot.begin(), snapshot.end());
+    stats.snapshots++;
+    if (newestTick == NO_TICK || tick > newestTick) {
+        newestTick = tick;
+	newSnapshot = true;
+    }
+}
+
+void ClientView::Update(uint32_t frame, const PlayerInput& input) {
+    int h = frame % INPUT_HISTORY;
+    inputs[h] = input;
+    inputFrames[h] = frame;
+    inputTimes[h] = Clock::now();
+    if (newestTick == NO_TICK) return;
+
+    if (newSnapshot || predictedFrame == NO_TICK || predictedFrame + 1 != frame) {
+        reconcile(frame);
+	newSnapshot = false;
+    } else {
+        stepPrediction(input);
+	predictedFrame = frame;
+    }
+    advanceRenderClock();
+    buildView();
+
+    // What the local ship on screen is showing, and would be showing without prediction
+    const Received* shown = viewTick == NO_TICK ? nullptr : &received[viewTick % SNAPSHOT_BUFFER];
+    bool predicting = settings.predict && predictedFrame != NO_TICK && predicted.state.status != GAME_OVER && predicted.getShip(slot) != NULL_ENTITY;
+    shownDisplay = predicting ? frame : (shown ? shown->lastApplied : NO_TICK);
+    shownSnapshot = received[newestTick % SNAPSHOT_BUFFER].lastApplied;
+    shownInterpolated = shown ? shown->lastApplied : NO_TICK;
+
+    correction.x *= settings.correctionDecay;
+    correction.y *= settings.correctionDecay;
+}
+
+void ClientView::Presented() {
+    auto now = Clock::now();
+    recordLatency(shownDisplay, countedDisplay, stats.inputToDisplay, now);
+    recordLatency(shownSnapshot, countedSnapshot, stats.inputToSnapshot, now);
+    recordLatency(shownInterpolated, countedInterpolated, stats.inputToInterpolated, now);
+}
+
+void ClientView::reconcile(uint32_t frame) {
+    // Where the ship was predicted to be last frame, to see how far the server moves it
+    bool hadShip = false;
+    Vector2 before = {0, 0};
+    if (predictedFrame != NO_TICK && predictedFrame + 1 == frame && predicted.state.status != GAME_OVER) {
+        Entity ship = predicted.getShip(slot);
+	if (ship != NULL_ENTITY) {
+	    hadShip = true;
+	    before = predicted.registry.get<Player>(ship).getMidpoint();
+	}
+    }
+
+    const Received& latest = received[newestTick % SNAPSHOT_BUFFER];
+    if (!load_snapshot(predicted, latest.data.data(), latest.data.size())) {
+        predictedFrame = NO_TICK;
+	return;
+    }
+
+    // Play the inputs the server hadn't got to, as far back as we remember them
+    uint32_t first = latest.lastApplied == NO_TICK ? 0 : latest.lastApplied + 1;
+    if (frame >= INPUT_HISTORY) first = std::max(first, frame - INPUT_HISTORY + 1);
+    first = std::min(first, frame);
+    for (uint32_t f = first; f < frame; f++) {
+        int h = f % INPUT_HISTORY;
+	stepPrediction(inputFrames[h] == f ? inputs[h] : PlayerInput());
+	stats.replayedFrames++;
+    }
+
+    Entity ship = predicted.getShip(slot);
+    if (hadShip && ship != NULL_ENTITY && predicted.state.status != GAME_OVER) {
+        Vector2 after = predicted.registry.get<Player>(ship).getMidpoint();
+	Vector2 moved = {before.x - after.x, before.y - after.y};
+	float pixels = std::sqrt(moved.x * moved.x + moved.y * moved.y);
+	if (pixels > 0.01f) {
+	    stats.corrections++;
+	    stats.correctionPixels += pixels;
+	    stats.maxCorrectionPixels = std::max(stats.maxCorrectionPixels, (double)pixels);
+	}
+	// Keep drawing the ship where it was and let the difference fade away
+	if (pixels < MAX_SMOOTHED_CORRECTION) {
+	    correction.x += moved.x;
+	    correction.y += moved.y;
+	} else {
+	    correction = {0, 0};
+	}
+    } else {
+        correction = {0, 0};
+    }
+
+    stepPrediction(inputs[frame % INPUT_HISTORY]);
+    predictedFrame = frame;
+}
+
+void ClientView::stepPrediction(const PlayerInput& input) {
+    // Once the predicted game is over the ship stays where it was. The snapshots will say
+    // whether it really is
+    if (predicted.state.status == GAME_OVER) return;
+
+    // Everyone else carries on with the input they last had
+    PlayerInput shipInputs[GC::MAX_PLAYERS];
+    predicted.players.ForEach([&](Entity, Player&, PlayerInput& shipInput, PlayerSlot& s) {
+        if (s.index >= 0 && s.index < GC::MAX_PLAYERS) shipInputs[s.index] = shipInput;
+    });
+    if (slot >= 0 && slot < GC::MAX_PLAYERS) shipInputs[slot] = input;
+    predicted.Tick(shipInputs, GC::MAX_PLAYERS);
+
+    // The server carries straight on into the next level, so the prediction does too
+    if (predicted.state.status == NEXT_LEVEL) predicted.state.status = PLAYING;
+}
+
+void ClientView::advanceRenderClock() {
+    double target = (double)newestTick - settings.interpolationTicks;
+    double error = target - renderTick;
+    if (renderTick < 0 || std::abs(error) > MAX_CLOCK_ERROR) {
+        if (renderTick >= 0) stats.clockJumps++;
+	renderTick = std::max(target, 0.0);
+    } else {
+        // Run a little fast or slow until it's back where it should be
+	renderTick += 1 + std::clamp(error * CLOCK_GAIN, -MAX_CLOCK_ADJUST, MAX_CLOCK_ADJUST);
+    }
+
+    if (renderTick > newestTick) {
+        renderTick = newestTick;
+	stats.starved++;
+    }
+}
+
+const ClientView::Received* ClientView::findAtOrBefore(double tick) const {
+    const Received* best = nullptr;
+    for (const Received& r : received) {
+        if (r.tick != NO_TICK && r.tick <= tick && (!best || r.tick > best->tick)) best = &r;
+    }
+    return best;
+}
+
+const ClientView::Received* ClientView::findAfter(double tick) const {
+    const Received* best = nullptr;
+    for (const Received& r : received) {
+        if (r.tick != NO_TICK && r.tick > tick && (!best || r.tick < best->tick)) best = &r;
+    }
+    return best;
+}
+
+void ClientView::buildView() {
+    const Received* from = findAtOrBefore(renderTick);
+    const Received* to = findAfter(renderTick);
+    // The render clock is older than anything we've got, so start at the oldest
+    if (!from) std::swap(from, to);
+    if (!from || !load_snapshot(view, from->data.data(), from->data.size())) return;
+    viewTick = from->tick;
+
+    if (to && to->tick != nextTick) {
+        if (load_snapshot(next, to->data.data(), to->data.size())) nextTick = to->tick;
+	else to = nullptr;
+    }
+
+    bool predicting = settings.predict && predictedFrame != NO_TICK && predicted.state.status != GAME_OVER;
+    Entity predictedShip = predicting ? predicted.getShip(slot) : NULL_ENTITY;
+    Entity viewShip = view.getShip(slot);
+    predicting = predictedShip != NULL_ENTITY && viewShip != NULL_ENTITY;
+
+    if (to) {
+        float t = (float)std::clamp((renderTick - from->tick) / (to->tick - from->tick), 0.0, 1.0);
+	float halfWidth = view.width / 2.0f;
+	float halfHeight = view.height / 2.0f;
+
+	// Asteroids and bullets. Anything that wrapped round the screen in between is left where
+	// it was rather than dragged across the middle. Anything gone by the later snapshot is
+	// still drawn until the render clock gets there
+	view.movers.ForEach([&](Entity e, Position& position, Velocity&) {
+	    if (!next.registry.has<Position>(e)) return;
+	    const Position& target = next.registry.get<Position>(e);
+	    if (std::abs(target.x - position.x) > halfWidth || std::abs(target.y - position.y) > halfHeight) return;
+	    position.x += (target.x - position.x) * t;
+	    position.y += (target.y - position.y) * t;
+	});
+
+	view.players.ForEach([&](Entity e, Player& ship, PlayerInput&, PlayerSlot& s) {
+	    if ((predicting && s.index == slot) || !next.registry.has<Player>(e)) return;
+	    const Player& target = next.registry.get<Player>(e);
+	    Vector2 a = ship.getMidpoint();
+	    Vector2 b = target.getMidpoint();
+	    if (std::abs(b.x - a.x) > halfWidth || std::abs(b.y - a.y) > halfHeight) return;
+	    ship.Blend(target, t);
+	});
+    }
+
+    if (predicting) {
+        Player& ship = view.registry.get<Player>(viewShip);
+	ship = predicted.registry.get<Player>(predictedShip);
+	ship.Offset(correction);
+    }
+}
+
+void ClientView::recordLatency(uint32_t newest, uint32_t& counted, LatencyHistogram& histogram, Clock::time_point now) {
+    if (newest == NO_TICK || (counted != NO_TICK && newest <= counted)) return;
+    // Frames from before we started counting, or that we no longer remember, aren't timed
+    uint32_t f = counted == NO_TICK || newest - counted > INPUT_HISTORY ? newest : counted + 1;
+    for (; f <= newest; f++) {
+        int h = f % INPUT_HISTORY;
+	if (inputFrames[h] == f) histogram.Record(std::chrono::duration<double>(now - inputTimes[h]).count());
+    }
+    counted = newest;
+}
@@ -0,0 +1,139 @@
+#ifndef CLIENT_VIEW_H
+#define CLIENT_VIEW_H
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include "world.h"
+#include "latency_histogram.h"
+
+struct ClientViewSettings {
+    // How far behind the newest snapshot remote entities are drawn, in ticks. More rides out
+    // late and lost snapshots, less shows the other players sooner
+    float interpolationTicks = 3;
+    // Draw the local ship from its own inputs straight away instead of waiting for the server
+    bool predict = true;
+    // Fraction of a correction to the predicted ship still left to smooth out after each frame.
+    // 0 snaps straight to the corrected position
+    float correctionDecay = 0.8f;
+};
+
+struct ClientViewStats {
+    // From an input being read to the first frame with its effect on the local ship reaching
+    // the screen (see Presented)
+    LatencyHistogram inputToDisplay;
+    // The same if the local ship were drawn from the newest snapshot, or interpolated along with
+    // everything else: what it would be without prediction
+    LatencyHistogram inputToSnapshot;
+    LatencyHistogram inputToInterpolated;
+    uint64_t snapshots = 0;
+    // Frames simulated again on top of a new snapshot, and how often (and by how many pixels)
+    // that moved the predicted ship
+    uint64_t replayedFrames = 0;
+    uint64_t corrections = 0;
+    double correctionPixels = 0;
+    double maxCorrectionPixels = 0;
+    // Frames the render clock caught up with the newest snapshot and had nothing to interpolate
+    // towards, and times it was too far off to steer and had to jump
+    uint64_t starved = 0;
+    uint64_t clockJumps = 0;
+};
+
+// What a networked client draws, built from the server's snapshots (see match_client.h).
+//
+// Remote entities are drawn interpolationTicks behind the newest snapshot, between the two
+// snapshots either side of the render clock, so they move smoothly even though snapshots
+// arrive unevenly. The render clock runs at one tick a frame and is steered gently towards
+// that distance behind, so a late snapshot holds things up a little instead of making them jump.
+//
+// The local ship is predicted. Each new snapshot is loaded into a world of its own and the
+// inputs the server hadn't applied yet are played on top of it, then the current input every
+// frame until the next snapshot. Other ships are assumed to keep doing what they last did. If
+// the server disagreed the ship is corrected, and the jump is smoothed out over a few frames
+class ClientView {
+    public:
+	ClientView(const ClientViewSettings& settings = ClientViewSettings());
+	ClientView(const ClientView&) = delete;
+	ClientView& operator=(const ClientView&) = delete;
+
+	// Forget everything and start on a new match, flying the ship in slot
+	void Reset(int slot);
+	// The snapshot of the server's tick, made after it had applied our inputs up to lastApplied
+	// (or none). Snapshots may arrive out of order or not at all
+	void AddSnapshot(uint32_t tick, uint32_t lastApplied, const std::vector<std::byte>& snapshot);
+	// Once a frame, with the input just read and the frame number it was sent as. Moves the
+	// prediction and the render clock on and rebuilds the view
+	void Update(uint32_t frame, const PlayerInput& input);
+	// Once the frame drawn from the view is on the screen, after EndDrawing(). Input latency
+	// is timed up to here, as the view itself is built the moment its input is read
+	void Presented();
+
+	// Nothing to draw until the first snapshot arrives
+	bool hasView() const { return viewTick != NO_TICK; }
+	// The world to draw. Only for drawing: it's rebuilt every Update
+	World& getView() { return view; }
+	int getSlot() const { return slot; }
+	double getRenderTick() const { return renderTick; }
+
+	const ClientViewSettings& getSettings() const { return settings; }
+	void setInterpolationTicks(float ticks);
+	const ClientViewStats& getStats() const { return stats; }
+
+	// Snapshots kept to interpolate between. Bounds interpolationTicks
+	static constexpr int SNAPSHOT_BUFFER = 32;
+	// Inputs remembered for replaying, and most frames predicted past the newest snapshot
+	static constexpr int INPUT_HISTORY = 64;
+    private:
+	static constexpr uint32_t NO_TICK = UINT32_MAX;
+
+	struct Received {
+	    uint32_t tick = NO_TICK;
+	    uint32_t lastApplied = NO_TICK;
+	    std::vector<std::byte> data;
+	};
+
+	// Reload the newest snapshot and replay our unapplied inputs up to and including frame
+	void reconcile(uint32_t frame);
+	void stepPrediction(const PlayerInput& input);
+	void advanceRenderClock();
+	void buildView();
+	// Newest snapshot at or before tick, and oldest after it
+	const Received* findAtOrBefore(double tick) const;
+	const Received* findAfter(double tick) const;
+	// Record the latency of every frame up to newest not yet counted in histogram
+	void recordLatency(uint32_t newest, uint32_t& counted, LatencyHistogram& histogram, std::chrono::steady_clock::time_point now);
+
+	ClientViewSettings settings;
+	int slot = 0;
+
+	std::vector<Received> received = std::vector<Received>(SNAPSHOT_BUFFER);
+	uint32_t newestTick = NO_TICK;
+	bool newSnapshot = false;
+
+	PlayerInput inputs[INPUT_HISTORY];
+	std::chrono::steady_clock::time_point inputTimes[INPUT_HISTORY];
+	uint32_t inputFrames[INPUT_HISTORY];
+
+	World predicted;
+	// Newest frame played into predicted, or NO_TICK if it doesn't hold a usable prediction
+	uint32_t predictedFrame = NO_TICK;
+	Vector2 correction = {0, 0};
+
+	double renderTick = -1;
+	World view;
+	World next;
+	uint32_t viewTick = NO_TICK;
+	uint32_t nextTick = NO_TICK;
+
+	// Newest input frame whose effect the last Update's view shows on the local ship, and
+	// would show if it were drawn from the newest snapshot or interpolated
+	uint32_t shownDisplay = NO_TICK;
+	uint32_t shownSnapshot = NO_TICK;
+	uint32_t shownInterpolated = NO_TICK;
+	uint32_t countedDisplay = NO_TICK;
+	uint32_t countedSnapshot = NO_TICK;
+	uint32_t countedInterpolated = NO_TICK;
+	ClientViewStats stats;
+};
+
+#endif // CLIENT_VIEW_H
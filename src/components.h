@@ -0,0 +1,51 @@
+#ifndef COMPONENTS_H
+#define COMPONENTS_H
+
+// Plain data components shared between entity types. Type-specific components live with
+// their type (Asteroid, Bullet, Player)
+
+// Centre of the entity in world pixels
+struct Position {
+    float x;
+    float y;
+};
+
+// Pixels moved per frame
+struct Velocity {
+    float x;
+    float y;
+};
+
+// Which player a ship belongs to (0 is the first) and what they have scored
+struct PlayerSlot {
+    int index = 0;
+    int score = 0;
+};
+
+// Controls for one ship for one tick. Filled from the keyboard for the local player, but
+// anything that drives a ship (bots, the network) goes through this too
+struct PlayerInput {
+    bool left = false;
+    bool right = false;
+    bool thrust = false;
+    bool fire = false;
+
+    bool operator==(const PlayerInput& o) const { return left == o.left && right == o.right && thrust == o.thrust && fire == o.fire; }
+    bool operator!=(const PlayerInput& o) const { return !(*this == o); }
+};
+
+// An input as 4 bits, for sending over the network
+inline unsigned int pack_input(const PlayerInput& input) {
+    return (input.left ? 1 : 0) | (input.right ? 2 : 0) | (input.thrust ? 4 : 0) | (input.fire ? 8 : 0);
+}
+
+inline PlayerInput unpack_input(unsigned int bits) {
+    PlayerInput input;
+    input.left = bits & 1;
+    input.right = bits & 2;
+    input.thrust = bits & 4;
+    input.fire = bits & 8;
+    return input;
+}
+
+#endif // COMPONENTS_H
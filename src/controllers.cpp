@@ -0,0 +1,208 @@
+#include <algorithm>
+#include <cmath>
+#include "controllers.h"
+#include "world.h"
+#include "intercept.h"
+#include "game_constants.h"
+
+PlayerInput IdleBot::Decide(World&, Entity) { return PlayerInput(); }
+
+PlayerInput SpinnerBot::Decide(World&, Entity) {
+    PlayerInput input;
+    input.right = true;
+    input.fire = true;
+    // Thrust for a quarter of every two seconds so the ship doesn't sit still
+    input.thrust = (frame % 120) < 30;
+    frame++;
+    return input;
+}
+
+RandomBot::RandomBot(unsigned int seed) : gen(seed) {}
+
+PlayerInput RandomBot::Decide(World&, Entity) {
+    if (framesLeft <= 0) {
+        std::uniform_int_distribution<> coin(0, 1);
+	std::uniform_int_distribution<> duration(5, 60);
+	held.left = coin(gen);
+	held.right = !held.left && coin(gen);
+	held.thrust = coin(gen);
+	held.fire = coin(gen);
+	framesLeft = duration(gen);
+    }
+    framesLeft--;
+    return held;
+}
+
+// Asteroids that will pass within this many pixels of the ship's midpoint, on top of their
+// radius, are on a collision course
+static constexpr float CLEARANCE = 35.0f;
+// Ticks ahead collisions are looked for, and how soon one has to be to dodge rather than shoot
+static constexpr float THREAT_TICKS = 90.0f;
+static constexpr float DODGE_TICKS = 30.0f;
+// Asteroids are looked for this near the ship, then this far if there were none, and then
+// everywhere
+static constexpr float NEAR_RADIUS = 120.0f;
+static constexpr float FAR_RADIUS = 480.0f;
+// Beyond this the ship closes in on its target, up to CRUISE_SPEED pixels a tick
+static constexpr float APPROACH_DISTANCE = 300.0f;
+static constexpr float CRUISE_SPEED = 2.0f;
+// Radians the ship turns a tick (see Player)
+static constexpr float TURN_STEP = 2 * GC::pi / 50;
+
+// Press left or right to turn the ship's heading towards direction
+static void steer(PlayerInput& input, Vector2 heading, Vector2 direction) {
+    float angle = std::atan2(heading.x * direction.y - heading.y * direction.x, heading.x * direction.x + heading.y * direction.y);
+    // Screen y points down, so turning right increases the angle
+    input.right = angle > TURN_STEP / 2;
+    input.left = angle < -TURN_STEP / 2;
+}
+
+PlayerInput AutopilotBot::Decide(World& world, Entity ship) {
+    PlayerInput input;
+    if (ship == NULL_ENTITY || !world.registry.IsAlive(ship)) return input;
+
+    const Player& player = world.registry.get<Player>(ship);
+    const AsteroidIndex& index = world.asteroidIndex;
+    Vector2 centre = player.getMidpoint();
+    Vector2 shipVelocity = player.getVelocity();
+    Vector2 heading = {player.getDeltaXShip() / player.getLength(), player.getDeltaYShip() / player.getLength()};
+    float w = (float)world.width;
+    float h = (float)world.height;
+
+    // The asteroid that will come closest soonest, if any is on a collision course, and the
+    // nearest. The grid is from the last tick's broadphase, which nothing has moved since
+    struct Candidate {
+        int asteroid = -1;
+	float ticks = 0;
+	float distance2 = 0;
+	// Where it will be relative to the ship when they're closest
+	Vector2 closest = {0, 0};
+    };
+    Candidate threat;
+    Candidate nearest;
+    auto consider = [&](int a) {
+        if (!world.registry.IsAlive(index.entities[a])) return;
+	const Velocity& velocity = world.registry.get<Velocity>(index.entities[a]);
+	Vector2 r = {wrapped(index.positions[a].x - centre.x, w), wrapped(index.positions[a].y - centre.y, h)};
+	Vector2 v = {velocity.x - shipVelocity.x, velocity.y - shipVelocity.y};
+	float distance2 = r.x * r.x + r.y * r.y;
+	float speed2 = v.x * v.x + v.y * v.y;
+	float ticks = speed2 > 0 ? std::clamp(-(r.x * v.x + r.y * v.y) / speed2, 0.0f, THREAT_TICKS) : 0.0f;
+	Vector2 closest = {r.x + v.x * ticks, r.y + v.y * ticks};
+	float reach = index.radii[a] + CLEARANCE;
+	if (closest.x * closest.x + closest.y * closest.y < reach * reach && (threat.asteroid < 0 || ticks < threat.ticks)) threat = {a, ticks, distance2, closest};
+	if (nearest.asteroid < 0 || distance2 < nearest.distance2) nearest = {a, ticks, distance2, closest};
+    };
+    query_nearby_asteroids(world, centre, NEAR_RADIUS, consider);
+    if (nearest.asteroid < 0) query_nearby_asteroids(world, centre, FAR_RADIUS, consider);
+    if (nearest.asteroid < 0) query_nearby_asteroids(world, centre, std::max(w, h), consider);
+    if (nearest.asteroid < 0) return input;
+
+    if (threat.asteroid >= 0 && threat.ticks < DODGE_TICKS) {
+        // Head away from where it will pass, or sideways if it's coming straight on
+	Vector2 away = {-threat.closest.x, -threat.closest.y};
+	if (away.x * away.x + away.y * away.y < 1) {
+	    const Velocity& v = world.registry.get<Velocity>(index.entities[threat.asteroid]);
+	    away = {-(v.y - shipVelocity.y), v.x - shipVelocity.x};
+	}
+	steer(input, heading, away);
+	float length = std::sqrt(away.x * away.x + away.y * away.y);
+	input.thrust = length > 0 && (heading.x * away.x + heading.y * away.y) > 0.5f * length;
+	return input;
+    }
+
+    // Lead the target, turning towards where the bullet would meet it. If it can't be hit
+    // before the bullet leaves the arena, turn towards where it is now instead
+    int target = threat.asteroid >= 0 ? threat.asteroid : nearest.asteroid;
+    const Velocity& v = world.registry.get<Velocity>(index.entities[target]);
+    InterceptQuery query = ship_intercept_query(player, world.width, world.height);
+    float angle, ticks;
+    solve_intercepts(query, 1, &index.positions[target].x, &index.positions[target].y, &v.x, &v.y, &angle, &ticks);
+    bool reachable = ticks >= 0;
+    Vector2 aim = {wrapped(index.positions[target].x - centre.x, w), wrapped(index.positions[target].y - centre.y, h)};
+    if (reachable) {
+        float range = query.speed * ticks;
+	aim = {query.muzzle.x + range * std::cos(angle) - centre.x, query.muzzle.y + range * std::sin(angle) - centre.y};
+    }
+    steer(input, heading, aim);
+
+    // Fire once the asteroid is within the bullet's path
+    float distance = std::sqrt(aim.x * aim.x + aim.y * aim.y);
+    float error = std::fabs(std::atan2(heading.x * aim.y - heading.y * aim.x, heading.x * aim.x + heading.y * aim.y));
+    bool aimed = error < std::max(std::atan2((float)index.radii[target], distance), TURN_STEP / 2);
+    input.fire = reachable && aimed;
+    // Go after targets out of reach, which otherwise could be waited on for ever
+    float speed2 = shipVelocity.x * shipVelocity.x + shipVelocity.y * shipVelocity.y;
+    input.thrust = aimed && (!reachable || distance > APPROACH_DISTANCE) && speed2 < CRUISE_SPEED * CRUISE_SPEED;
+    return input;
+}
+
+// What a future that loses the ship scores, plus as much again the sooner it's lost
+static constexpr float LOSS_PENALTY = 1000.0f;
+
+// The 12 distinct inputs: left and right together turn the same way as right alone
+static PlayerInput search_input(int i) {
+    PlayerInput input = unpack_input(i % 4 * 4);
+    input.left = i / 4 == 1;
+    input.right = i / 4 == 2;
+    return input;
+}
+
+SearchBot::SearchBot(unsigned int seed, int rollouts, int depth) : rng(seed), rolloutsPerSearch(std::max(rollouts, 12)), depth(std::max(depth, HOLD_TICKS)) {}
+
+PlayerInput SearchBot::Decide(World& world, Entity ship) {
+    if (ticksLeft > 0) {
+        ticksLeft--;
+	return held;
+    }
+
+    SimState root;
+    if (!capture_sim_state(world, ship, SEARCH_RADIUS, root)) return PlayerInput();
+
+    // Rollout i starts with input i % 12
+    int n = rolloutsPerSearch;
+    clones.assign(n, root);
+    inputs.resize(n);
+    inputTicksLeft.resize(n);
+    for (int i = 0; i < n; i++) {
+        inputs[i] = search_input(i % 12);
+	inputTicksLeft[i] = HOLD_TICKS;
+    }
+    for (int t = 0; t < depth; t++) {
+        for (int i = 0; i < n; i++) {
+	    if (inputTicksLeft[i]-- > 0) continue;
+	    inputs[i] = search_input(rng() % 12);
+	    inputTicksLeft[i] = HOLD_TICKS + rng() % 8;
+	}
+	sim_step_batch(clones.data(), inputs.data(), n);
+    }
+    rollouts += n;
+
+    float totals[12] = {};
+    int counts[12] = {};
+    for (int i = 0; i < n; i++) {
+        const SimState& s = clones[i];
+	float value = (float)s.score;
+	if (s.lost) value -= LOSS_PENALTY * (2.0f - (float)s.ticks / depth);
+	totals[i % 12] += value;
+	counts[i % 12]++;
+    }
+    int best = 0;
+    for (int i = 1; i < 12; i++) {
+        if (totals[i] / counts[i] > totals[best] / counts[best]) best = i;
+    }
+    held = search_input(best);
+    ticksLeft = HOLD_TICKS - 1;
+    return held;
+}
+
+uint64_t SearchBot::getRollouts() const { return rollouts; }
+
+std::unique_ptr<Controller> make_controller(const std::string& name, unsigned int seed) {
+    if (name == "none") return std::make_unique<IdleBot>();
+    if (name == "spinner") return std::make_unique<SpinnerBot>();
+    if (name == "random") return std::make_unique<RandomBot>(seed);
+    if (name == "autopilot") return std::make_unique<AutopilotBot>();
+    if (name == "search") return std::make_unique<SearchBot>(seed);
+    return nullptr;
+}
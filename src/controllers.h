@@ -0,0 +1,91 @@
+#ifndef CONTROLLERS_H
+#define CONTROLLERS_H
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "components.h"
+#include "ecs.h"
+#include "lookahead.h"
+#include "rng.h"
+
+struct World;
+
+// Something that flies a ship without a keyboard. Controllers produce the same PlayerInput
+// the keyboard does, so the simulation can't tell them apart from a player
+class Controller {
+    public:
+	virtual ~Controller() = default;
+	// Choose the input for ship this tick
+	virtual PlayerInput Decide(World& world, Entity ship) = 0;
+};
+
+// Does nothing. The ship just drifts
+class IdleBot : public Controller {
+    public:
+	PlayerInput Decide(World& world, Entity ship) override;
+};
+
+// Turns on the spot and fires constantly, with the odd burst of thrust
+class SpinnerBot : public Controller {
+    public:
+	PlayerInput Decide(World& world, Entity ship) override;
+    private:
+	int frame = 0;
+};
+
+// Holds a random combination of controls for a random number of frames
+class RandomBot : public Controller {
+    public:
+	RandomBot(unsigned int seed);
+	PlayerInput Decide(World& world, Entity ship) override;
+    private:
+	std::mt19937 gen;
+	PlayerInput held;
+	int framesLeft = 0;
+};
+
+// Plays properly, for soak tests and demos: steers out of the way of asteroids about to hit
+// the ship, and otherwise turns to lead the most dangerous asteroid nearby, or failing that
+// the nearest, and shoots it (see intercept.h). Only looks at what the broadphase grid says
+// is near the ship, so a decision costs the same whatever the size of the world, a
+// microsecond or two
+class AutopilotBot : public Controller {
+    public:
+	PlayerInput Decide(World& world, Entity ship) override;
+};
+
+// Searches over its next moves with flat Monte Carlo: every HOLD_TICKS ticks it plays
+// rollouts futures from the present on SimState clones (lookahead.h), depth ticks long, each
+// starting with one of the 12 distinct inputs held for HOLD_TICKS and going on with random
+// ones, and holds the input whose futures scored best on average, losing the ship counting
+// heavily against. Clones are stepped together in batches, one tick at a time
+class SearchBot : public Controller {
+    public:
+	static constexpr int HOLD_TICKS = 4;
+	// Asteroids further than this from the ship are left out
+	static constexpr float SEARCH_RADIUS = 800.0f;
+
+	SearchBot(unsigned int seed, int rollouts = 96, int depth = 45);
+	PlayerInput Decide(World& world, Entity ship) override;
+	// Rollouts played so far
+	uint64_t getRollouts() const;
+    private:
+	Pcg32 rng;
+	int rolloutsPerSearch;
+	int depth;
+	PlayerInput held;
+	int ticksLeft = 0;
+	uint64_t rollouts = 0;
+	// Kept between searches so they don't allocate
+	std::vector<SimState> clones;
+	std::vector<PlayerInput> inputs;
+	std::vector<int> inputTicksLeft;
+};
+
+// Build a controller by name ("none", "spinner", "random", "autopilot" or "search"). Returns
+// nullptr for unknown names
+std::unique_ptr<Controller> make_controller(const std::string& name, unsigned int seed);
+
+#endif // CONTROLLERS_H
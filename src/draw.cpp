@@ -0,0 +1,42 @@
+#include <raylib-cpp.hpp>
+#include <rlgl.h>
+#include "world.h"
+#include "particles.h"
+
+// Everything the simulation draws, kept out of the simulation's own files so a build without
+// a window, like the batched environment's library (batch_env.h), can leave raylib out
+
+void World::Draw() {
+    shapedAsteroids.ForEach([](Entity, Position& position, Asteroid& asteroid, const auto& shape) { shape.Draw(position, asteroid.getColour()); });
+    bullets.ForEach([](Entity, Position& position, Bullet& bullet) { bullet.Draw(position); });
+    players.ForEach([](Entity, Player& p, PlayerInput&, PlayerSlot&) { p.Draw(); });
+}
+
+void Player::Draw() const {
+    DrawTriangle(points[10], points[9], points[8], thrusting ? ORANGE : BLACK);
+    DrawLine(points[0].x, points[0].y, points[1].x, points[1].y, BLACK);
+    DrawLine(points[2].x, points[2].y, points[3].x, points[3].y, WHITE);
+    DrawLine(points[4].x, points[4].y, points[5].x, points[5].y, WHITE);
+    DrawLine(points[6].x, points[6].y, points[7].x, points[7].y, WHITE);
+}
+
+void Bullet::Draw(Position position) const {
+    DrawCircleV({position.x, position.y}, radius, color);
+}
+
+void ParticleSystem::Draw() const {
+    if (count == 0) return;
+
+    // Each particle is a streak from its current position back along its velocity.
+    // Everything goes into raylib's render batch in one begin/end pair, which rlgl
+    // flushes in large chunks rather than one draw call per particle
+    rlBegin(RL_LINES);
+    for (int i = 0; i < count; i++) {
+        uint32_t c = colours[i];
+        float alpha = life[i] * fade[i];
+        rlColor4ub(c & 0xff, (c >> 8) & 0xff, (c >> 16) & 0xff, (unsigned char)(alpha * 255));
+        rlVertex2f(posX[i], posY[i]);
+        rlVertex2f(posX[i] - velocX[i], posY[i] - velocY[i]);
+    }
+    rlEnd();
+}
@@ -0,0 +1,120 @@
+#include <algorithm>
+#include "ecs.h"
+
+int next_component_id() {
+    static int next = 0;
+    assert(next < MAX_COMPONENT_TYPES);
+    return next++;
+}
+
+static int align_up(int v, int align) { return (v + align - 1) / align * align; }
+
+Archetype::Archetype(ComponentMask m, const std::vector<ComponentInfo>& infos) : mask(m) {
+    std::fill(std::begin(columnOf), std::end(columnOf), -1);
+
+    // Work out how many rows fit in a chunk, leaving room to cache-line align every column
+    int rowBytes = sizeof(Entity);
+    for (const auto& info : infos) rowBytes += info.size;
+    chunkCapacity = (CHUNK_BYTES - 64 * (int)(infos.size() + 1)) / rowBytes;
+    assert(chunkCapacity > 0 && "components too large for a chunk");
+
+    // The entity handles come first, followed by one column per component
+    int offset = align_up(chunkCapacity * sizeof(Entity), 64);
+    for (const auto& info : infos) {
+        columnOf[info.id] = (int)columns.size();
+	columns.push_back({info.size, offset});
+	offset = align_up(offset + chunkCapacity * info.size, 64);
+    }
+    assert(offset <= CHUNK_BYTES);
+}
+
+uint32_t Archetype::PushRow(Entity e) {
+    if (count == (int)chunks.size() * chunkCapacity) {
+        chunks.push_back(std::make_unique<Chunk>());
+    }
+    uint32_t row = count++;
+    entityAt(row) = e;
+    return row;
+}
+
+uint32_t Archetype::PushRows(uint32_t n) {
+    uint32_t first = count;
+    count += n;
+    while ((int)chunks.size() * chunkCapacity < count) {
+        chunks.push_back(std::make_unique<Chunk>());
+    }
+    return first;
+}
+
+Entity Archetype::RemoveRow(uint32_t row) {
+    uint32_t last = --count;
+    if (row == last) return NULL_ENTITY;
+
+    std::byte* dst = chunks[row / chunkCapacity]->data;
+    std::byte* src = chunks[last / chunkCapacity]->data;
+    int dstSlot = row % chunkCapacity;
+    int srcSlot = last % chunkCapacity;
+
+    for (const auto& col : columns) {
+        std::memcpy(dst + col.offset + dstSlot * col.size, src + col.offset + srcSlot * col.size, col.size);
+    }
+
+    Entity moved = entityAt(last);
+    entityAt(row) = moved;
+    return moved;
+}
+
+void Archetype::Clear() { count = 0; }
+
+Entity Registry::allocateEntity() {
+    numAlive++;
+    if (!freeIndices.empty()) {
+        uint32_t index = freeIndices.back();
+	freeIndices.pop_back();
+	return {index, records[index].generation};
+    }
+    records.emplace_back();
+    return {(uint32_t)(records.size() - 1), 0};
+}
+
+bool Registry::IsAlive(Entity e) const {
+    return e.index < records.size() && records[e.index].archetype != nullptr && records[e.index].generation == e.generation;
+}
+
+void Registry::Destroy(Entity e) {
+    if (!IsAlive(e)) return;
+
+    Record& r = records[e.index];
+    Entity moved = r.archetype->RemoveRow(r.row);
+    if (moved != NULL_ENTITY) records[moved.index].row = r.row;
+
+    r.archetype = nullptr;
+    r.generation++;
+    freeIndices.push_back(e.index);
+    numAlive--;
+}
+
+void Registry::Clear() {
+    for (auto& a : archetypes) a->Clear();
+
+    for (uint32_t i = 0; i < records.size(); i++) {
+        if (records[i].archetype == nullptr) continue;
+	records[i].archetype = nullptr;
+	records[i].generation++;
+	freeIndices.push_back(i);
+    }
+    numAlive = 0;
+}
+
+void Registry::RestoreHandles(const uint32_t* generations, uint32_t numSlots, const uint32_t* freeList, uint32_t numFree) {
+    for (auto& a : archetypes) a->Clear();
+
+    records.resize(numSlots);
+    for (uint32_t i = 0; i < numSlots; i++) {
+        records[i].archetype = nullptr;
+	records[i].row = 0;
+	records[i].generation = generations[i];
+    }
+    freeIndices.assign(freeList, freeList + numFree);
+    numAlive = 0;
+}
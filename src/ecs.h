@@ -0,0 +1,266 @@
+#ifndef ECS_H
+#define ECS_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+// Small archetype entity component system.
+//
+// Every distinct set of component types is an archetype. An archetype stores its entities in
+// fixed-size chunks, and inside a chunk each component type has its own tightly packed column,
+// so a system that only needs positions and velocities streams through exactly those two
+// arrays. Entities are removed with swap-and-pop, so the rows of an archetype are always dense.
+//
+// Components must be trivially copyable: rows are moved around with memcpy and never destructed.
+// Entities of an archetype must not be created or destroyed while a query is iterating that
+// archetype. Collect the entities and apply the changes afterwards instead
+
+// Handle to an entity. The generation is bumped whenever an index is recycled so stale
+// handles to destroyed entities can be detected
+struct Entity {
+    uint32_t index;
+    uint32_t generation;
+
+    bool operator==(const Entity& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const Entity& other) const { return !(*this == other); }
+};
+
+static constexpr Entity NULL_ENTITY = {UINT32_MAX, 0};
+
+static constexpr int MAX_COMPONENT_TYPES = 64;
+static constexpr int CHUNK_BYTES = 16 * 1024;
+using ComponentMask = uint64_t;
+
+// Component type ids are handed out on first use
+int next_component_id();
+
+template <typename T>
+int component_id() {
+    static_assert(std::is_trivially_copyable<T>::value, "components are moved with memcpy");
+    static const int id = next_component_id();
+    return id;
+}
+
+template <typename... Cs>
+ComponentMask component_mask() {
+    return (ComponentMask(0) | ... | (ComponentMask(1) << component_id<Cs>()));
+}
+
+struct ComponentInfo {
+    int id;
+    int size;
+    int align;
+};
+
+struct Chunk {
+    alignas(64) std::byte data[CHUNK_BYTES];
+};
+
+class Archetype {
+    public:
+	Archetype(ComponentMask m, const std::vector<ComponentInfo>& infos);
+
+	ComponentMask getMask() const { return mask; }
+	int getCount() const { return count; }
+	int getChunkCapacity() const { return chunkCapacity; }
+	// Number of chunks currently holding entities. Only the last one can be partly full
+	int getNumChunks() const { return (count + chunkCapacity - 1) / chunkCapacity; }
+	int getChunkCount(int chunk) const { return std::min(chunkCapacity, count - chunk * chunkCapacity); }
+
+	Entity* entities(int chunk) { return reinterpret_cast<Entity*>(chunks[chunk]->data); }
+
+	template <typename T>
+	T* column(int chunk) {
+	    int col = columnOf[component_id<T>()];
+	    assert(col >= 0 && "archetype doesn't have this component");
+	    return reinterpret_cast<T*>(chunks[chunk]->data + columns[col].offset);
+	}
+
+	template <typename T>
+	T& get(uint32_t row) { return column<T>(row / chunkCapacity)[row % chunkCapacity]; }
+
+	Entity& entityAt(uint32_t row) { return entities(row / chunkCapacity)[row % chunkCapacity]; }
+
+	// Append a row for e and return its index. Component values are left for the caller to fill
+	uint32_t PushRow(Entity e);
+	// Append n rows and return the index of the first. Entities and components are left for
+	// the caller to fill
+	uint32_t PushRows(uint32_t n);
+	// Remove a row by moving the last row into its place. Returns the entity that was moved,
+	// or NULL_ENTITY if the removed row was the last one
+	Entity RemoveRow(uint32_t row);
+	// Drop every row. Chunks are kept for reuse
+	void Clear();
+    private:
+	struct Column {
+	    int size;
+	    int offset;
+	};
+
+	ComponentMask mask;
+	int chunkCapacity;
+	int count = 0;
+	std::vector<Column> columns;
+	int columnOf[MAX_COMPONENT_TYPES];
+	// Chunks past the ones in use are kept around so steady-state churn doesn't allocate
+	std::vector<std::unique_ptr<Chunk>> chunks;
+};
+
+class Registry {
+    public:
+	Registry() = default;
+	Registry(const Registry&) = delete;
+	Registry& operator=(const Registry&) = delete;
+
+	template <typename... Cs>
+	Entity Create(const Cs&... components) {
+	    Archetype* a = archetypeFor<Cs...>();
+	    Entity e = allocateEntity();
+	    uint32_t row = a->PushRow(e);
+	    (std::memcpy(&a->get<Cs>(row), &components, sizeof(Cs)), ...);
+	    records[e.index].archetype = a;
+	    records[e.index].row = row;
+	    return e;
+	}
+
+	void Destroy(Entity e);
+	// Destroy every entity. Storage is kept for reuse
+	void Clear();
+	bool IsAlive(Entity e) const;
+
+	// Destroy every entity and put the handle space back exactly as it was saved: slot i gets
+	// generation generations[i] and freeList becomes the free list, so handles taken before the
+	// save are valid again once their rows are restored with RestoreRows
+	void RestoreHandles(const uint32_t* generations, uint32_t numSlots, const uint32_t* freeList, uint32_t numFree);
+
+	// Bulk-add n entities with the given handles to the archetype of Cs, copying the components
+	// from one array per type. The handles must come from the state given to RestoreHandles
+	template <typename... Cs>
+	void RestoreRows(uint32_t n, const Entity* handles, const Cs*... components) {
+	    Archetype* a = archetypeFor<Cs...>();
+	    uint32_t first = a->PushRows(n);
+	    uint32_t capacity = a->getChunkCapacity();
+
+	    // Copy in runs that fill the rest of one chunk at a time
+	    for (uint32_t done = 0; done < n;) {
+	        uint32_t row = first + done;
+		int chunk = row / capacity;
+		uint32_t slot = row % capacity;
+		uint32_t run = std::min(n - done, capacity - slot);
+
+		std::memcpy(a->entities(chunk) + slot, handles + done, run * sizeof(Entity));
+		(std::memcpy(a->template column<Cs>(chunk) + slot, components + done, run * sizeof(Cs)), ...);
+		for (uint32_t i = 0; i < run; i++) {
+		    Record& r = records[handles[done + i].index];
+		    r.archetype = a;
+		    r.row = row + i;
+		}
+		done += run;
+	    }
+	    numAlive += n;
+	}
+
+	// The archetype holding exactly the components Cs, created if it doesn't exist yet
+	template <typename... Cs>
+	Archetype* getArchetype() { return archetypeFor<Cs...>(); }
+
+	// Number of entity slots ever handed out, alive or free
+	uint32_t getNumSlots() const { return (uint32_t)records.size(); }
+	// Generation of slot index: the live entity's, or the one the slot's next entity will get
+	uint32_t getGeneration(uint32_t index) const { return records[index].generation; }
+	const std::vector<uint32_t>& getFreeIndices() const { return freeIndices; }
+
+	template <typename T>
+	T& get(Entity e) {
+	    assert(IsAlive(e));
+	    const Record& r = records[e.index];
+	    return r.archetype->get<T>(r.row);
+	}
+
+	template <typename T>
+	bool has(Entity e) const {
+	    return IsAlive(e) && (records[e.index].archetype->getMask() & component_mask<T>());
+	}
+
+	int getNumEntities() const { return numAlive; }
+	// Archetypes are only ever added, never removed, so queries can cache by position
+	const std::vector<std::unique_ptr<Archetype>>& getArchetypes() const { return archetypes; }
+    private:
+	struct Record {
+	    Archetype* archetype = nullptr;
+	    uint32_t row = 0;
+	    uint32_t generation = 0;
+	};
+
+	template <typename... Cs>
+	Archetype* archetypeFor() {
+	    ComponentMask mask = component_mask<Cs...>();
+	    for (const auto& a : archetypes) {
+	        if (a->getMask() == mask) return a.get();
+	    }
+	    archetypes.push_back(std::make_unique<Archetype>(mask, std::vector<ComponentInfo>{{component_id<Cs>(), (int)sizeof(Cs), (int)alignof(Cs)}...}));
+	    return archetypes.back().get();
+	}
+
+	Entity allocateEntity();
+
+	std::vector<std::unique_ptr<Archetype>> archetypes;
+	std::vector<Record> records;
+	std::vector<uint32_t> freeIndices;
+	int numAlive = 0;
+};
+
+// Iterates every entity that has all of Cs, whatever other components it has. The list of
+// matching archetypes is cached and only extended when the registry gains new archetypes
+template <typename... Cs>
+class Query {
+    public:
+	Query(Registry& r) : registry(&r), mask(component_mask<Cs...>()) {}
+
+	// f(Entity, Cs&...) for each matching entity
+	template <typename F>
+	void ForEach(F&& f) {
+	    ForEachChunk([&](int n, Entity* entities, Cs*... columns) {
+	        for (int i = 0; i < n; i++) f(entities[i], columns[i]...);
+	    });
+	}
+
+	// f(n, Entity*, Cs*...) once per chunk, with pointers to the start of each column. Use this
+	// for kernels that want to work on whole arrays at a time
+	template <typename F>
+	void ForEachChunk(F&& f) {
+	    refresh();
+	    for (Archetype* a : matches) {
+	        for (int c = 0; c < a->getNumChunks(); c++) {
+		    f(a->getChunkCount(c), a->entities(c), a->template column<Cs>(c)...);
+		}
+	    }
+	}
+
+	int getCount() {
+	    refresh();
+	    int n = 0;
+	    for (Archetype* a : matches) n += a->getCount();
+	    return n;
+	}
+    private:
+	void refresh() {
+	    const auto& archetypes = registry->getArchetypes();
+	    for (; numSeen < archetypes.size(); numSeen++) {
+	        if ((archetypes[numSeen]->getMask() & mask) == mask) matches.push_back(archetypes[numSeen].get());
+	    }
+	}
+
+	Registry* registry;
+	ComponentMask mask;
+	std::vector<Archetype*> matches;
+	size_t numSeen = 0;
+};
+
+#endif // ECS_H
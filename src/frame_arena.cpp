@@ -0,0 +1,11 @@
+#include "frame_arena.h"
+
+FrameArena::FrameArena(size_t bytes) : capacity(bytes), buffer(std::make_unique<std::byte[]>(bytes)), arena(buffer.get(), bytes) {}
+
+void FrameArena::Reset() {
+    // Rewinds to the start of the initial buffer
+    arena.release();
+}
+
+std::pmr::memory_resource* FrameArena::getResource() { return &arena; }
+size_t FrameArena::getCapacity() const { return capacity; }
@@ -0,0 +1,28 @@
+#ifndef FRAMEARENA_H
+#define FRAMEARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+// Linear allocator for scratch data that only lives for one tick (spawn lists, hit lists,
+// sort buffers). Allocations bump a pointer through a buffer reserved up front and are all
+// freed at once by Reset() at the top of the next tick. Containers opt in by being
+// std::pmr containers constructed with getResource()
+class FrameArena {
+    public:
+	FrameArena(size_t bytes);
+
+	// Release everything allocated during the previous tick
+	void Reset();
+	std::pmr::memory_resource* getResource();
+	size_t getCapacity() const;
+    private:
+	size_t capacity;
+	std::unique_ptr<std::byte[]> buffer;
+	// If a tick ever needs more than capacity bytes the arena falls back to the global
+	// heap, which shows up in the allocation counter
+	std::pmr::monotonic_buffer_resource arena;
+};
+
+#endif // FRAMEARENA_H
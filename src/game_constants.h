@@ -11,6 +11,45 @@ namespace GameConstants {
     static constexpr int BULLET_FRAMES_PER_SPAWN = 6;
     // The number of smaller asteroids created by destroying a larger one
     static constexpr int ASTEROID_SPAWN_FACTOR = 2;
+    // Largest radius an asteroid can have, used to pad broadphase queries
+    static constexpr float MAX_ASTEROID_RADIUS = 30.0f;
+    // Cell size of the collision broadphase grid
+    static constexpr float GRID_CELL_SIZE = 64.0f;
+    // Widest and tallest arena a snapshot may describe, which keeps its grid to about a
+    // million cells
+    static constexpr int MAX_ARENA_SIZE = 1 << 16;
+    // Points awarded for destroying an asteroid, indexed by asteroid size - 1
+    static constexpr int ASTEROID_SCORES[3] = {100, 50, 20};
+    // Scratch memory available to a single frame before the frame arena falls back to the heap
+    static constexpr int FRAME_ARENA_BYTES = 1 << 20;
+    // Particle pool size and behaviour
+    static constexpr int MAX_PARTICLES = 1 << 20;
+    static constexpr float PARTICLE_DRAG = 0.97f;
+    static constexpr int EXPLOSION_PARTICLES_PER_SIZE = 40;
+    static constexpr int EXPLOSION_PARTICLE_LIFE = 45; // frames
+    static constexpr float EXPLOSION_PARTICLE_SPEED = 4.0f;
+    static constexpr int THRUSTER_PARTICLES_PER_FRAME = 3;
+    static constexpr int THRUSTER_PARTICLE_LIFE = 20; // frames
+    static constexpr float THRUSTER_PARTICLE_SPEED = 4.0f;
+    // Most ships in one game
+    static constexpr int MAX_PLAYERS = 4;
+    // Rollback netplay: frames of prediction that can be undone, and frames local input is
+    // held back before it is used, which hides that much latency without any rollback
+    static constexpr int ROLLBACK_FRAMES = 8;
+    static constexpr int NETPLAY_INPUT_DELAY = 2;
+    // Server lag compensation: most ticks a shot is rewound by to match what its shooter saw
+    static constexpr int MAX_REWIND_TICKS = 15;
+    // Rewinding time in the game (rewind.h): seconds of play kept, ticks between the full
+    // snapshots seeks start from, ticks a frame that fast rewinding goes back, and the most
+    // memory the history may take
+    static constexpr int REWIND_HISTORY_SECONDS = 10;
+    static constexpr int REWIND_KEYFRAME_INTERVAL = 60;
+    static constexpr int REWIND_FAST_TICKS = 4;
+    static constexpr int REWIND_BUDGET_BYTES = 192 << 20;
+    // Screenshots and GIF recording (capture.h): frames that may be waiting to be written before
+    // more are dropped, and ticks between the frames a GIF keeps
+    static constexpr int CAPTURE_MAX_QUEUED = 8;
+    static constexpr int CAPTURE_GIF_FRAME_INTERVAL = 3;
 }
 
 // Create an alias
@@ -0,0 +1,41 @@
+#include <raylib-cpp.hpp>
+#include <cstdio>
+#include <climits>
+#include "hud.h"
+
+// Indices into Hud::fields
+enum HudField {
+    HUD_LEVEL,
+    HUD_SCORE,
+    HUD_FPS,
+    HUD_ASTEROIDS,
+    HUD_BULLETS,
+    HUD_PARTICLES,
+    HUD_ALLOCS
+};
+
+Hud::Hud(Color col) : fields{{"Level", INT_MIN, ""}, {"Score", INT_MIN, ""}, {"FPS", INT_MIN, ""}, {"Asteroids", INT_MIN, ""}, {"Bullets", INT_MIN, ""}, {"Particles", INT_MIN, ""}, {"Allocs/frame", INT_MIN, ""}}, colour(col) {}
+
+void Hud::setField(Field& field, int value) {
+    // Nothing to do if the text already shows this value
+    if (field.value == value) return;
+
+    field.value = value;
+    std::snprintf(field.text, sizeof(field.text), "%s: %d", field.label, value);
+}
+
+void Hud::Update(const HudStats& stats) {
+    setField(fields[HUD_LEVEL], stats.level);
+    setField(fields[HUD_SCORE], stats.score);
+    setField(fields[HUD_FPS], stats.fps);
+    setField(fields[HUD_ASTEROIDS], stats.numAsteroids);
+    setField(fields[HUD_BULLETS], stats.numBullets);
+    setField(fields[HUD_PARTICLES], stats.numParticles);
+    setField(fields[HUD_ALLOCS], stats.allocsPerFrame);
+}
+
+void Hud::Draw() const {
+    for (int i = 0; i < numFields; i++) {
+        DrawText(fields[i].text, 10, 10 + i*lineSpacing, fontSize, colour);
+    }
+}
@@ -0,0 +1,46 @@
+#ifndef HUD_H
+#define HUD_H
+
+#include <raylib-cpp.hpp>
+
+// Values shown on the HUD
+struct HudStats {
+    int level;
+    int score;
+    int fps;
+    int numAsteroids;
+    int numBullets;
+    int numParticles;
+    // Global heap allocations made during the previous frame. Should sit at 0 in steady state
+    int allocsPerFrame;
+};
+
+// Heads-up display drawn over the playing screen. Every line is formatted into a
+// fixed buffer owned by the HUD and only re-formatted when its value changes, so
+// drawing the HUD never touches the heap regardless of how many entities are alive
+class Hud {
+    public:
+	Hud(Color col);
+
+	// Refresh the displayed values. Cheap to call every frame
+	void Update(const HudStats& stats);
+	void Draw() const;
+    private:
+	// One line of HUD text and the value it was last formatted from
+	struct Field {
+	    const char* label;
+	    int value;
+	    char text[32];
+	};
+
+	static void setField(Field& field, int value);
+
+	static constexpr int numFields = 7;
+	static constexpr int fontSize = 20;
+	static constexpr int lineSpacing = 22;
+
+	Field fields[numFields];
+	Color colour;
+};
+
+#endif // HUD_H
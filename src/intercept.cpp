@@ -0,0 +1,120 @@
+#include <cmath>
+#include "intercept.h"
+#include "player.h"
+#include "game_constants.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define INTERCEPT_SSE2
+#endif
+
+InterceptQuery ship_intercept_query(const Player& ship, int width, int height) {
+    return {ship.getPoints()[0], (float)GC::BULLET_SPEED, (float)width, (float)height};
+}
+
+// With the target at r from the muzzle, solve |r + v t| = speed t for t. The target is
+// slower, so a < 0 < c, the discriminant is positive and the one positive root is this
+static float hit_ticks(float rx, float ry, float vx, float vy, float speed) {
+    float a = vx * vx + vy * vy - speed * speed;
+    float b = 2 * (rx * vx + ry * vy);
+    float c = rx * rx + ry * ry;
+    return (-b - std::sqrt(b * b - 4 * a * c)) / (2 * a);
+}
+
+void solve_intercepts_scalar(const InterceptQuery& q, int n, const float* x, const float* y, const float* velocX, const float* velocY, float* angles, float* ticks) {
+    for (int i = 0; i < n; i++) {
+        float best = INFINITY;
+	float aimX = 0;
+	float aimY = 0;
+	for (int imageY = -1; imageY <= 1; imageY++) {
+	    for (int imageX = -1; imageX <= 1; imageX++) {
+	        float rx = x[i] + imageX * q.width - q.muzzle.x;
+		float ry = y[i] + imageY * q.height - q.muzzle.y;
+		float t = hit_ticks(rx, ry, velocX[i], velocY[i], q.speed);
+		float hitX = rx + velocX[i] * t;
+		float hitY = ry + velocY[i] * t;
+		float screenX = q.muzzle.x + hitX;
+		float screenY = q.muzzle.y + hitY;
+		if (t >= best || screenX < 0 || screenX > q.width || screenY < 0 || screenY > q.height) continue;
+		best = t;
+		aimX = hitX;
+		aimY = hitY;
+	    }
+	}
+	ticks[i] = best < INFINITY ? best : -1.0f;
+	angles[i] = std::atan2(aimY, aimX);
+    }
+}
+
+#ifdef INTERCEPT_SSE2
+static __m128 select_ps(__m128 mask, __m128 a, __m128 b) {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+// atan2 four at a time: a polynomial for atan on [0, 1], then the octant put back
+static __m128 atan2_ps(__m128 y, __m128 x) {
+    const __m128 signBit = _mm_set1_ps(-0.0f);
+    __m128 absX = _mm_andnot_ps(signBit, x);
+    __m128 absY = _mm_andnot_ps(signBit, y);
+    __m128 big = _mm_max_ps(absX, absY);
+    __m128 z = _mm_div_ps(_mm_min_ps(absX, absY), _mm_max_ps(big, _mm_set1_ps(1e-30f)));
+    __m128 z2 = _mm_mul_ps(z, z);
+    __m128 p = _mm_set1_ps(-0.01172120f);
+    p = _mm_add_ps(_mm_mul_ps(p, z2), _mm_set1_ps(0.05265332f));
+    p = _mm_add_ps(_mm_mul_ps(p, z2), _mm_set1_ps(-0.11643287f));
+    p = _mm_add_ps(_mm_mul_ps(p, z2), _mm_set1_ps(0.19354346f));
+    p = _mm_add_ps(_mm_mul_ps(p, z2), _mm_set1_ps(-0.33262347f));
+    p = _mm_add_ps(_mm_mul_ps(p, z2), _mm_set1_ps(0.99997726f));
+    __m128 angle = _mm_mul_ps(p, z);
+    angle = select_ps(_mm_cmpgt_ps(absY, absX), _mm_sub_ps(_mm_set1_ps((float)(GC::pi / 2)), angle), angle);
+    angle = select_ps(_mm_cmplt_ps(x, _mm_setzero_ps()), _mm_sub_ps(_mm_set1_ps((float)GC::pi), angle), angle);
+    return _mm_or_ps(angle, _mm_and_ps(y, signBit));
+}
+#endif
+
+void solve_intercepts(const InterceptQuery& q, int n, const float* x, const float* y, const float* velocX, const float* velocY, float* angles, float* ticks) {
+    int i = 0;
+#ifdef INTERCEPT_SSE2
+    const __m128 muzzleX = _mm_set1_ps(q.muzzle.x);
+    const __m128 muzzleY = _mm_set1_ps(q.muzzle.y);
+    const __m128 width = _mm_set1_ps(q.width);
+    const __m128 height = _mm_set1_ps(q.height);
+    const __m128 speed2 = _mm_set1_ps(q.speed * q.speed);
+    const __m128 zero = _mm_setzero_ps();
+    for (; i + 4 <= n; i += 4) {
+        __m128 vx = _mm_loadu_ps(velocX + i);
+	__m128 vy = _mm_loadu_ps(velocY + i);
+	// From the muzzle to the middle image
+	__m128 baseX = _mm_sub_ps(_mm_loadu_ps(x + i), muzzleX);
+	__m128 baseY = _mm_sub_ps(_mm_loadu_ps(y + i), muzzleY);
+	__m128 a = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), speed2);
+	__m128 inverse2a = _mm_div_ps(_mm_set1_ps(0.5f), a);
+	__m128 best = _mm_set1_ps(INFINITY);
+	__m128 aimX = zero;
+	__m128 aimY = zero;
+	for (int imageY = -1; imageY <= 1; imageY++) {
+	    __m128 ry = _mm_add_ps(baseY, _mm_set1_ps(imageY * q.height));
+	    for (int imageX = -1; imageX <= 1; imageX++) {
+	        __m128 rx = _mm_add_ps(baseX, _mm_set1_ps(imageX * q.width));
+		__m128 b = _mm_mul_ps(_mm_set1_ps(2), _mm_add_ps(_mm_mul_ps(rx, vx), _mm_mul_ps(ry, vy)));
+		__m128 c = _mm_add_ps(_mm_mul_ps(rx, rx), _mm_mul_ps(ry, ry));
+		__m128 discriminant = _mm_sub_ps(_mm_mul_ps(b, b), _mm_mul_ps(_mm_set1_ps(4), _mm_mul_ps(a, c)));
+		__m128 t = _mm_mul_ps(_mm_sub_ps(_mm_sub_ps(zero, b), _mm_sqrt_ps(discriminant)), inverse2a);
+		__m128 hitX = _mm_add_ps(rx, _mm_mul_ps(vx, t));
+		__m128 hitY = _mm_add_ps(ry, _mm_mul_ps(vy, t));
+		__m128 screenX = _mm_add_ps(muzzleX, hitX);
+		__m128 screenY = _mm_add_ps(muzzleY, hitY);
+		__m128 inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(screenX, zero), _mm_cmple_ps(screenX, width)), _mm_and_ps(_mm_cmpge_ps(screenY, zero), _mm_cmple_ps(screenY, height)));
+		__m128 better = _mm_and_ps(inside, _mm_cmplt_ps(t, best));
+		best = select_ps(better, t, best);
+		aimX = select_ps(better, hitX, aimX);
+		aimY = select_ps(better, hitY, aimY);
+	    }
+	}
+	__m128 found = _mm_cmplt_ps(best, _mm_set1_ps(INFINITY));
+	_mm_storeu_ps(ticks + i, select_ps(found, best, _mm_set1_ps(-1.0f)));
+	_mm_storeu_ps(angles + i, atan2_ps(aimY, aimX));
+    }
+#endif
+    solve_intercepts_scalar(q, n - i, x + i, y + i, velocX + i, velocY + i, angles + i, ticks + i);
+}
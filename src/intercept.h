@@ -0,0 +1,34 @@
+#ifndef INTERCEPT_H
+#define INTERCEPT_H
+
+#include <raylib-cpp.hpp>
+
+class Player;
+
+// Where to fire from and how fast the bullet goes, in an arena width by height
+struct InterceptQuery {
+    Vector2 muzzle;
+    // Pixels a tick
+    float speed;
+    float width;
+    float height;
+};
+
+// Bullets from ship's gun: fired from its nose at GC::BULLET_SPEED
+InterceptQuery ship_intercept_query(const Player& ship, int width, int height);
+
+// Firing solutions against targets moving in straight lines, for bots, homing weapons and aim
+// assist. Bullets fly straight and are removed once they leave the arena, but targets wrap
+// around it, so each target is tried at all nine of its images an arena width and height
+// apart, and the earliest hit that happens inside the arena is taken. Targets have to be
+// slower than the bullet, which every asteroid is.
+//
+// Target i is at (x[i], y[i]) moving by (velocX[i], velocY[i]) a tick. angles[i] is the
+// direction to fire in, in radians as atan2 gives it (so clockwise on screen), and ticks[i]
+// how long the bullet takes to get there, or -1 if it can't hit inside the arena. Four targets
+// are solved at once with SSE2, where the angles come from a polynomial good to 1e-5 radians
+void solve_intercepts(const InterceptQuery& query, int n, const float* x, const float* y, const float* velocX, const float* velocY, float* angles, float* ticks);
+// The same a target at a time with std::atan2, for checking and comparing against
+void solve_intercepts_scalar(const InterceptQuery& query, int n, const float* x, const float* y, const float* velocX, const float* velocY, float* angles, float* ticks);
+
+#endif // INTERCEPT_H
@@ -0,0 +1,190 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include "interest.h"
+
+// How far past the radius an entity the client was told about is kept, so ones sitting on the
+// edge don't keep dropping out and being sent again
+static constexpr float KEEP_SLACK = 1.2f;
+// Estimated cost of a correction to an entity the client has: a row index and its motion
+static constexpr int CORRECTION_BYTES = 12;
+
+static bool same_bits(const void* a, const void* b, size_t size) { return std::memcmp(a, b, size) == 0; }
+
+ClientInterest::ClientInterest(const InterestSettings& s) : settings(s) {}
+
+void ClientInterest::Reset() {
+    for (uint32_t slot : trackedSlots) {
+        forget(tracked[slot]);
+	filter.handles[slot] = NULL_ENTITY;
+	filter.replaceMotion[slot] = 0;
+    }
+    trackedSlots.clear();
+}
+
+InterestStats ClientInterest::TakeStats() {
+    InterestStats taken = stats;
+    stats = InterestStats();
+    return taken;
+}
+
+ClientInterest::Tracked& ClientInterest::track(Entity e) {
+    Tracked& t = tracked[e.index];
+    // A slot still tracked for an entity that's gone is already in the list
+    if (t.entity == NULL_ENTITY) trackedSlots.push_back(e.index);
+    forget(t);
+    t.entity = e;
+    return t;
+}
+
+Entity ClientInterest::newHandle() {
+    uint32_t slot;
+    if (!filter.freeIndices.empty()) {
+        slot = filter.freeIndices.back();
+	filter.freeIndices.pop_back();
+    } else {
+        slot = (uint32_t)filter.generations.size();
+	filter.generations.push_back(0);
+    }
+    return {slot, filter.generations[slot]};
+}
+
+void ClientInterest::forget(Tracked& t) {
+    if (t.handle != NULL_ENTITY) {
+        // The client's slot is free again, under a new generation
+	filter.generations[t.handle.index]++;
+	filter.freeIndices.push_back(t.handle.index);
+	if (!t.ship) numTold--;
+    }
+    t = Tracked();
+}
+
+void ClientInterest::consider(Entity e, Position position, Velocity velocity, int newCost, Vector2 focus, float width, float height) {
+    float distance = std::hypot(wrapped(position.x - focus.x, width), wrapped(position.y - focus.y, height));
+    Tracked* t = &tracked[e.index];
+    bool told = t->entity == e && t->told;
+    if (distance > settings.radius * (told ? KEEP_SLACK : 1)) return;
+
+    if (t->entity != e) t = &track(e);
+    t->seen = true;
+    int cost = newCost;
+    if (told) cost = same_bits(&t->position, &position, sizeof(Position)) && same_bits(&t->velocity, &velocity, sizeof(Velocity)) ? 0 : CORRECTION_BYTES;
+    candidates.push_back({e, position, velocity, distance, cost});
+}
+
+void ClientInterest::send(const Candidate& c) {
+    Tracked& t = tracked[c.entity.index];
+    if (!t.told) {
+        t.handle = newHandle();
+	t.told = true;
+	numTold++;
+    }
+    t.position = c.position;
+    t.velocity = c.velocity;
+    t.priority = 0;
+    stats.updates++;
+}
+
+void ClientInterest::Update(World& world, Vector2 focus) {
+    Registry& registry = world.registry;
+    uint32_t numSlots = registry.getNumSlots();
+    if (tracked.size() < numSlots) tracked.resize(numSlots);
+
+    // Move on what the client has, the way its snapshot decoder predicts it, and clear last
+    // tick's filter
+    for (uint32_t slot : trackedSlots) {
+        Tracked& t = tracked[slot];
+	t.seen = false;
+	filter.handles[slot] = NULL_ENTITY;
+	filter.replaceMotion[slot] = 0;
+	if (!t.told || t.ship) continue;
+	t.position.x += t.velocity.x;
+	t.position.y += t.velocity.y;
+    }
+    filter.handles.resize(numSlots, NULL_ENTITY);
+    filter.replaceMotion.resize(numSlots, 0);
+    filter.positions.resize(numSlots);
+    filter.velocities.resize(numSlots);
+
+    // Every ship is always sent
+    world.players.ForEach([&](Entity e, Player&, PlayerInput&, PlayerSlot&) {
+        Tracked* t = &tracked[e.index];
+	if (t->entity != e) {
+	    t = &track(e);
+	    t->ship = true;
+	    t->told = true;
+	    t->handle = newHandle();
+	}
+	t->seen = true;
+    });
+
+    // Asteroids near enough from the grid, across the edges of the arena too, bullets by
+    // distance. Asteroids split off this tick aren't in the grid yet and are picked up next tick
+    candidates.clear();
+    const AsteroidIndex& index = world.asteroidIndex;
+    float w = (float)world.width;
+    float h = (float)world.height;
+    query_nearby_asteroids(world, focus, settings.radius * KEEP_SLACK, [&](int a) {
+        Entity e = index.entities[a];
+	if (!registry.IsAlive(e)) return;
+	// Seen through two edges of a small arena
+	if (tracked[e.index].entity == e && tracked[e.index].seen) return;
+	const Asteroid& asteroid = registry.get<Asteroid>(e);
+	int newCost = sizeof(Entity) + sizeof(Position) + sizeof(Velocity) + sizeof(Asteroid) + asteroid.getNumVertices() * sizeof(Vector2);
+	consider(e, registry.get<Position>(e), registry.get<Velocity>(e), newCost, focus, w, h);
+    });
+    world.bullets.ForEach([&](Entity e, Position& position, Bullet&) {
+        consider(e, position, registry.get<Velocity>(e), sizeof(Entity) + sizeof(Position) + sizeof(Velocity) + sizeof(Bullet), focus, w, h);
+    });
+
+    // Whatever wasn't seen has gone, or gone out of range
+    trackedSlots.erase(std::remove_if(trackedSlots.begin(), trackedSlots.end(), [&](uint32_t slot) {
+        Tracked& t = tracked[slot];
+	if (t.seen) return false;
+	forget(t);
+	return true;
+    }), trackedSlots.end());
+
+    // Nearby entities first, then the rest by how long and how near they've been waiting
+    waiting.clear();
+    for (const Candidate& c : candidates) {
+        if (c.cost == 0) continue;
+	tracked[c.entity.index].priority += settings.nearRadius / std::max(c.distance, 1.0f);
+	waiting.push_back(&c);
+    }
+    std::sort(waiting.begin(), waiting.end(), [&](const Candidate* a, const Candidate* b) {
+        bool aNear = a->distance <= settings.nearRadius;
+	bool bNear = b->distance <= settings.nearRadius;
+	if (aNear != bNear) return aNear;
+	if (aNear) return a->distance < b->distance;
+	return tracked[a->entity.index].priority > tracked[b->entity.index].priority;
+    });
+    int budget = settings.budgetBytes;
+    for (const Candidate* c : waiting) {
+        bool told = tracked[c->entity.index].told;
+	if (c->distance <= settings.nearRadius) {
+	    send(*c);
+	} else if (c->cost <= budget && (told || numTold < settings.maxEntities)) {
+	    send(*c);
+	    budget -= c->cost;
+	} else {
+	    stats.deferred++;
+	}
+    }
+
+    // Everything told about, as the client has it
+    for (uint32_t slot : trackedSlots) {
+        const Tracked& t = tracked[slot];
+	if (t.told) filter.handles[slot] = t.handle;
+    }
+    for (const Candidate& c : candidates) {
+        const Tracked& t = tracked[c.entity.index];
+	if (!t.told) continue;
+	if (!same_bits(&t.position, &c.position, sizeof(Position)) || !same_bits(&t.velocity, &c.velocity, sizeof(Velocity))) {
+	    filter.replaceMotion[c.entity.index] = 1;
+	    filter.positions[c.entity.index] = t.position;
+	    filter.velocities[c.entity.index] = t.velocity;
+	}
+    }
+    stats.entities += numTold;
+}
@@ -0,0 +1,106 @@
+#ifndef INTEREST_H
+#define INTEREST_H
+
+#include <cstdint>
+#include <vector>
+#include "world.h"
+#include "snapshot.h"
+
+struct InterestSettings {
+    // Everything within nearRadius of the client's ship is kept exact every tick. Further out,
+    // up to radius, asteroids and bullets share what's left of the budget, the nearest first,
+    // and past radius the client isn't told about them at all
+    float nearRadius = 350;
+    float radius = 900;
+    // Estimated bytes of new entities and corrections one snapshot carries, nearby ones aside
+    int budgetBytes = 600;
+    // The most asteroids and bullets a client is told about at once
+    int maxEntities = 256;
+};
+
+struct InterestStats {
+    // Asteroids and bullets in the snapshots sent, summed over snapshots
+    uint64_t entities = 0;
+    // Entities sent anew or corrected, and ones that needed it but waited for a later snapshot
+    // because the budget was spent
+    uint64_t updates = 0;
+    uint64_t deferred = 0;
+};
+
+// Interest management for one client: which of the world's asteroids and bullets it's told
+// about, and how up to date they are.
+//
+// Each tick the spatial grid is asked for the asteroids near the client's ship, and the bullets
+// are checked by distance. What the client has been told about each of them is kept here,
+// moved on a tick at a time exactly as the snapshot delta codec predicts it (snapshot_delta.h),
+// so an entity flying straight costs nothing to keep, whether it's been refreshed or not. Only
+// entities new to the client and ones that have turned or wrapped away from the prediction
+// cost bytes. Those within nearRadius are always sent; the rest build up priority each tick
+// they wait, faster the nearer they are, and go out highest priority first until the budget is
+// spent. The rest keep their predicted position until their turn comes.
+//
+// The client's snapshots give entities handles from a slot table of the client's own, which
+// only grows to the most entities it's been told about at once. So what a client is sent each
+// tick is bounded by the budget and maxEntities, not by how many entities the world holds
+class ClientInterest {
+    public:
+	ClientInterest(const InterestSettings& settings);
+
+	// Forget everything the client was told, for when its next snapshot is a keyframe
+	void Reset();
+	// Decide what the client sees of the world as it is now, centred on focus. The world's
+	// grid has to be from this tick's broadphase
+	void Update(World& world, Vector2 focus);
+	// For save_snapshot, after Update
+	const SnapshotFilter& getFilter() const { return filter; }
+	// Added to since the last call, and cleared
+	InterestStats TakeStats();
+    private:
+	// A ship, or an asteroid or bullet in range whether the client has been told about it yet
+	// or not
+	struct Tracked {
+	    Entity entity = NULL_ENTITY;
+	    // Its handle in the client's snapshots, once told
+	    Entity handle = NULL_ENTITY;
+	    bool told = false;
+	    bool ship = false;
+	    // In range this tick
+	    bool seen = false;
+	    // Where the client has it this tick and how fast it has it moving, once told
+	    Position position;
+	    Velocity velocity;
+	    float priority = 0;
+	};
+
+	struct Candidate {
+	    Entity entity;
+	    Position position;
+	    Velocity velocity;
+	    float distance;
+	    // Estimated bytes to bring the client up to date, 0 if it already is
+	    int cost;
+	};
+
+	// Start tracking e in its slot, forgetting whatever was there
+	Tracked& track(Entity e);
+	void forget(Tracked& t);
+	// A free slot in the client's table, or a new one
+	Entity newHandle();
+	// Distances are measured the short way round an arena of width by height
+	void consider(Entity e, Position position, Velocity velocity, int newCost, Vector2 focus, float width, float height);
+	void send(const Candidate& c);
+
+	InterestSettings settings;
+	// By entity slot, and the slots with something in them
+	std::vector<Tracked> tracked;
+	std::vector<uint32_t> trackedSlots;
+	// Asteroids and bullets told about
+	int numTold = 0;
+	std::vector<Candidate> candidates;
+	std::vector<const Candidate*> waiting;
+	// Holds the client's slot table too
+	SnapshotFilter filter;
+	InterestStats stats;
+};
+
+#endif // INTEREST_H
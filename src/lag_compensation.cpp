@@ -0,0 +1,33 @@
+#include <algorithm>
+#include "lag_compensation.h"
+
+AsteroidHistory::AsteroidHistory(float worldW, float worldH, int ticks)
+    : frames(std::max(ticks, 1), Frame{NO_TICK, AsteroidIndex(), SpatialGrid(worldW, worldH, GC::GRID_CELL_SIZE)}) {}
+
+void AsteroidHistory::Clear() {
+    for (Frame& frame : frames) frame.tick = NO_TICK;
+}
+
+void AsteroidHistory::Record(uint64_t tick, const AsteroidIndex& index, const SpatialGrid& grid) {
+    Frame& frame = frames[tick % frames.size()];
+    frame.tick = tick;
+    // Copying into vectors big enough already doesn't allocate
+    frame.index.entities.assign(index.entities.begin(), index.entities.end());
+    frame.index.positions.assign(index.positions.begin(), index.positions.end());
+    frame.index.radii.assign(index.radii.begin(), index.radii.end());
+    frame.grid = grid;
+}
+
+size_t AsteroidHistory::getMemoryBytes() const {
+    size_t bytes = frames.capacity() * sizeof(Frame);
+    for (const Frame& frame : frames) {
+        bytes += frame.index.entities.capacity() * sizeof(Entity);
+	bytes += frame.index.positions.capacity() * sizeof(Position);
+	bytes += frame.index.radii.capacity() * sizeof(int);
+	bytes += frame.grid.getMemoryBytes();
+    }
+    return bytes;
+}
+
+// One more tick than the rewind, since the present is kept too
+LagCompensation::LagCompensation(float worldW, float worldH, int maxRewindTicks) : history(worldW, worldH, maxRewindTicks + 1) {}
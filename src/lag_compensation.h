@@ -0,0 +1,78 @@
+#ifndef LAG_COMPENSATION_H
+#define LAG_COMPENSATION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "world.h"
+#include "latency_histogram.h"
+#include "game_constants.h"
+
+// Where every asteroid was on each of the last few ticks: a copy of the broadphase each tick's
+// collisions were tested against, in a ring. Each frame of the ring keeps its buffers, so once
+// they've grown to the most asteroids there have been, recording stops allocating and the
+// memory used stays put
+class AsteroidHistory {
+    public:
+	AsteroidHistory(float worldW, float worldH, int ticks);
+
+	void Clear();
+	// Keep the broadphase just built for tick, in place of the oldest
+	void Record(uint64_t tick, const AsteroidIndex& index, const SpatialGrid& grid);
+	// Call visit(entity, position, radius) for every asteroid whose centre may have been
+	// within radius of centre on tick, like SpatialGrid::Query. The entities may since have
+	// been destroyed. Returns false if tick isn't kept
+	template <typename VisitFn>
+	bool Query(uint64_t tick, Vector2 centre, float radius, VisitFn&& visit) const {
+	    const Frame& frame = frames[tick % frames.size()];
+	    if (frame.tick != tick) return false;
+	    const AsteroidIndex& index = frame.index;
+	    frame.grid.Query(centre, radius, [&](int a) { visit(index.entities[a], index.positions[a], index.radii[a]); });
+	    return true;
+	}
+
+	int getTicks() const { return (int)frames.size(); }
+	// Bytes held by every frame's buffers
+	size_t getMemoryBytes() const;
+    private:
+	static constexpr uint64_t NO_TICK = UINT64_MAX;
+
+	struct Frame {
+	    uint64_t tick = NO_TICK;
+	    AsteroidIndex index;
+	    SpatialGrid grid;
+	};
+
+	std::vector<Frame> frames;
+};
+
+struct LagCompensationStats {
+    // Bullets tested against the asteroids of an earlier tick, and how many of those hit
+    uint64_t rewoundTests = 0;
+    uint64_t rewoundHits = 0;
+    // Bullets whose shooter was further behind than the history goes back, tested against the
+    // oldest tick kept instead
+    uint64_t clamped = 0;
+    // One rewound test, history lookup and broadphase query included
+    LatencyHistogram queryTimes;
+};
+
+// Server-side lag compensation for shots. A client draws the asteroids a few ticks in the past
+// (its latency plus its interpolation delay, see client_view.h) while its own ship is
+// predicted in the present, so it aims at where asteroids were. Left to the present-day
+// broadphase, a well-aimed shot misses an asteroid that has moved on.
+//
+// Each tick the world records its broadphase here, and each bullet is tested against the
+// asteroids as they were rewindTicks[owner] ticks ago: its shooter's view of them. Only an
+// asteroid still alive now can be hit, and it breaks up from where it is now. Set a slot's
+// rewind to 0 for shots to be tested against the present as usual
+struct LagCompensation {
+    LagCompensation(float worldW, float worldH, int maxRewindTicks = GC::MAX_REWIND_TICKS);
+
+    // Ticks each slot's shots are rewound by, set before each tick
+    int rewindTicks[GC::MAX_PLAYERS] = {};
+    AsteroidHistory history;
+    LagCompensationStats stats;
+};
+
+#endif // LAG_COMPENSATION_H
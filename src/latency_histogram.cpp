@@ -0,0 +1,45 @@
+#include <algorithm>
+#include <cmath>
+#include "latency_histogram.h"
+
+static constexpr int numBuckets = 1024;
+static constexpr double bucketBaseSeconds = 1e-6;
+static const double bucketRatioLog = std::log(1.02);
+
+LatencyHistogram::LatencyHistogram() : buckets(numBuckets, 0) {}
+
+void LatencyHistogram::Record(double seconds) {
+    int bucket = 0;
+    if (seconds > bucketBaseSeconds) {
+        bucket = std::min(numBuckets - 1, (int)(std::log(seconds / bucketBaseSeconds) / bucketRatioLog));
+    }
+    buckets[bucket]++;
+    count++;
+    totalSeconds += seconds;
+    maxSeconds = std::max(maxSeconds, seconds);
+}
+
+void LatencyHistogram::Merge(const LatencyHistogram& other) {
+    for (int b = 0; b < numBuckets; b++) buckets[b] += other.buckets[b];
+    count += other.count;
+    totalSeconds += other.totalSeconds;
+    maxSeconds = std::max(maxSeconds, other.maxSeconds);
+}
+
+void LatencyHistogram::Clear() {
+    std::fill(buckets.begin(), buckets.end(), 0);
+    count = 0;
+    totalSeconds = 0;
+    maxSeconds = 0;
+}
+
+double LatencyHistogram::PercentileMs(double fraction) const {
+    if (count == 0) return 0;
+    uint64_t target = (uint64_t)std::ceil(fraction * count);
+    uint64_t seen = 0;
+    for (int b = 0; b < numBuckets; b++) {
+        seen += buckets[b];
+	if (seen >= target) return std::min(1000 * bucketBaseSeconds * std::exp((b + 1) * bucketRatioLog), getMaxMs());
+    }
+    return getMaxMs();
+}
@@ -0,0 +1,38 @@
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+// Log-scale histogram of durations, so recording is O(1) and never allocates however many
+// samples go by. Buckets grow by 2% each, starting at 1 microsecond; 1024 of them reach well
+// past 10 seconds
+class LatencyHistogram {
+    public:
+	LatencyHistogram();
+
+	void Record(double seconds);
+	// Add another histogram's samples to this one
+	void Merge(const LatencyHistogram& other);
+	void Clear();
+
+	uint64_t getCount() const { return count; }
+	double getMaxMs() const { return 1000 * maxSeconds; }
+	double getMeanMs() const { return count ? 1000 * totalSeconds / count : 0; }
+	// The duration fraction of the samples are at or below. Reports the top of the bucket so
+	// percentiles err on the slow side, though never past the slowest sample
+	double PercentileMs(double fraction) const;
+    private:
+	std::vector<uint32_t> buckets;
+	uint64_t count = 0;
+	double totalSeconds = 0;
+	double maxSeconds = 0;
+};
+
+// Seconds from start until now on the steady clock, the way durations for a histogram are taken
+inline double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+#endif // LATENCY_HISTOGRAM_H
@@ -0,0 +1,145 @@
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include "lookahead.h"
+#include "world.h"
+#include "game_constants.h"
+
+bool capture_sim_state(World& world, Entity ship, float radius, SimState& state) {
+    if (ship == NULL_ENTITY || !world.registry.IsAlive(ship)) return false;
+
+    state.ship = world.registry.get<Player>(ship);
+    state.width = (float)world.width;
+    state.height = (float)world.height;
+    state.ticks = 0;
+    state.score = 0;
+    state.lost = false;
+
+    // The nearest asteroids, as a max-heap on distance while it's being filled
+    const AsteroidIndex& index = world.asteroidIndex;
+    Vector2 centre = state.ship.getMidpoint();
+    std::pair<float, int> nearest[SimState::MAX_ASTEROIDS];
+    int count = 0;
+    query_nearby_asteroids(world, centre, radius, [&](int a) {
+        if (!world.registry.IsAlive(index.entities[a])) return;
+	float dx = wrapped(index.positions[a].x - centre.x, state.width);
+	float dy = wrapped(index.positions[a].y - centre.y, state.height);
+	float distance2 = dx * dx + dy * dy;
+	if (distance2 > radius * radius) return;
+	if (count == SimState::MAX_ASTEROIDS && distance2 >= nearest[0].first) return;
+	// The same asteroid seen through two edges is only taken the first time
+	for (int i = 0; i < count; i++) {
+	    if (nearest[i].second == a) return;
+	}
+	if (count == SimState::MAX_ASTEROIDS) {
+	    std::pop_heap(nearest, nearest + count);
+	    count--;
+	}
+	nearest[count++] = {distance2, a};
+	std::push_heap(nearest, nearest + count);
+    });
+
+    state.numAsteroids = count;
+    for (int i = 0; i < count; i++) {
+        int a = nearest[i].second;
+	const Asteroid& asteroid = world.registry.get<Asteroid>(index.entities[a]);
+	const Velocity& velocity = world.registry.get<Velocity>(index.entities[a]);
+	state.asteroidX[i] = centre.x + wrapped(index.positions[a].x - centre.x, state.width);
+	state.asteroidY[i] = centre.y + wrapped(index.positions[a].y - centre.y, state.height);
+	state.asteroidVelocX[i] = velocity.x;
+	state.asteroidVelocY[i] = velocity.y;
+	state.asteroidRadius[i] = (float)asteroid.getRadius();
+	state.asteroidPoints[i] = (int16_t)GC::ASTEROID_SCORES[asteroid.getSize() - 1];
+    }
+
+    int slot = world.registry.get<PlayerSlot>(ship).index;
+    state.numBullets = 0;
+    world.bullets.ForEach([&](Entity e, Position& position, Bullet& bullet) {
+        if (bullet.getOwner() != slot || state.numBullets == SimState::MAX_BULLETS) return;
+	const Velocity& velocity = world.registry.get<Velocity>(e);
+	int i = state.numBullets++;
+	state.bulletX[i] = position.x;
+	state.bulletY[i] = position.y;
+	state.bulletVelocX[i] = velocity.x;
+	state.bulletVelocY[i] = velocity.y;
+    });
+    return true;
+}
+
+static void remove_asteroid(SimState& s, int i) {
+    int last = --s.numAsteroids;
+    s.asteroidX[i] = s.asteroidX[last];
+    s.asteroidY[i] = s.asteroidY[last];
+    s.asteroidVelocX[i] = s.asteroidVelocX[last];
+    s.asteroidVelocY[i] = s.asteroidVelocY[last];
+    s.asteroidRadius[i] = s.asteroidRadius[last];
+    s.asteroidPoints[i] = s.asteroidPoints[last];
+}
+
+static void remove_bullet(SimState& s, int i) {
+    int last = --s.numBullets;
+    s.bulletX[i] = s.bulletX[last];
+    s.bulletY[i] = s.bulletY[last];
+    s.bulletVelocX[i] = s.bulletVelocX[last];
+    s.bulletVelocY[i] = s.bulletVelocY[last];
+}
+
+void sim_step(SimState& s, const PlayerInput& input) {
+    if (s.lost) return;
+
+    // As ship_system. The gun only cools down if there's room for the bullet
+    Player& p = s.ship;
+    if (input.fire && s.numBullets < SimState::MAX_BULLETS && p.TryFire(GC::BULLET_FRAMES_PER_SPAWN)) {
+        int i = s.numBullets++;
+	s.bulletX[i] = p.getPoints()[0].x;
+	s.bulletY[i] = p.getPoints()[0].y;
+	s.bulletVelocX[i] = p.getDeltaXShip() * (float)(GC::BULLET_SPEED / p.getLength());
+	s.bulletVelocY[i] = p.getDeltaYShip() * (float)(GC::BULLET_SPEED / p.getLength());
+    }
+    p.Update(input, s.width, s.height);
+
+    for (int i = 0; i < s.numAsteroids; i++) {
+        s.asteroidX[i] += s.asteroidVelocX[i];
+	s.asteroidY[i] += s.asteroidVelocY[i];
+    }
+    for (int i = 0; i < s.numBullets; i++) {
+        s.bulletX[i] += s.bulletVelocX[i];
+	s.bulletY[i] += s.bulletVelocY[i];
+    }
+
+    // A bullet takes out the first asteroid it's inside, then bullets off the screen go
+    for (int b = 0; b < s.numBullets; b++) {
+        for (int a = 0; a < s.numAsteroids; a++) {
+	    float dx = s.asteroidX[a] - s.bulletX[b];
+	    float dy = s.asteroidY[a] - s.bulletY[b];
+	    if (dx * dx + dy * dy >= s.asteroidRadius[a] * s.asteroidRadius[a]) continue;
+	    s.score += s.asteroidPoints[a];
+	    remove_asteroid(s, a);
+	    remove_bullet(s, b);
+	    b--;
+	    break;
+	}
+    }
+    for (int b = 0; b < s.numBullets; b++) {
+        if (s.bulletX[b] < 0 || s.bulletX[b] > s.width || s.bulletY[b] < 0 || s.bulletY[b] > s.height) remove_bullet(s, b--);
+    }
+
+    // Only asteroids that could reach a point of the ship get the exact test
+    Vector2 centre = p.getMidpoint();
+    float length = p.getLength();
+    for (int a = 0; a < s.numAsteroids; a++) {
+        float dx = s.asteroidX[a] - centre.x;
+	float dy = s.asteroidY[a] - centre.y;
+	float reach = length + s.asteroidRadius[a];
+	if (dx * dx + dy * dy > reach * reach) continue;
+	if (p.CollidedWithAsteroid({s.asteroidX[a], s.asteroidY[a]}, (int)s.asteroidRadius[a])) {
+	    s.lost = true;
+	    return;
+	}
+    }
+    s.ticks++;
+}
+
+void sim_step_batch(SimState* states, const PlayerInput* inputs, int n) {
+    for (int i = 0; i < n; i++) sim_step(states[i], inputs[i]);
+}
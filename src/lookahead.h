@@ -0,0 +1,61 @@
+#ifndef LOOKAHEAD_H
+#define LOOKAHEAD_H
+
+#include <cstdint>
+#include <type_traits>
+#include "components.h"
+#include "ecs.h"
+#include "player.h"
+
+struct World;
+
+// A cut-down copy of one ship's surroundings, for bots that search over what the ship could do
+// next by playing many short futures out. It's a fixed size and trivially copyable, so a clone
+// is a plain copy of a couple of kilobytes with no allocation, and a batch of clones sits in
+// one array.
+//
+// The ship is a real Player, so it flies exactly as in the game. Only the nearest
+// MAX_ASTEROIDS asteroids and the ship's own bullets come along, and the rules are simplified
+// where it doesn't matter over a second or two: a hit asteroid just disappears rather than
+// splitting, and nothing wraps, the asteroids being placed on whichever side of the arena's
+// edges is nearest the ship to begin with
+struct SimState {
+    static constexpr int MAX_ASTEROIDS = 64;
+    static constexpr int MAX_BULLETS = 16;
+
+    Player ship;
+    float width;
+    float height;
+    // Ticks simulated since the capture, which stop counting when the ship is lost
+    int ticks;
+    int score;
+    bool lost;
+
+    // Asteroids and bullets a field to an array, the live ones first
+    int numAsteroids;
+    float asteroidX[MAX_ASTEROIDS];
+    float asteroidY[MAX_ASTEROIDS];
+    float asteroidVelocX[MAX_ASTEROIDS];
+    float asteroidVelocY[MAX_ASTEROIDS];
+    float asteroidRadius[MAX_ASTEROIDS];
+    int16_t asteroidPoints[MAX_ASTEROIDS];
+
+    int numBullets;
+    float bulletX[MAX_BULLETS];
+    float bulletY[MAX_BULLETS];
+    float bulletVelocX[MAX_BULLETS];
+    float bulletVelocY[MAX_BULLETS];
+};
+
+static_assert(std::is_trivially_copyable<SimState>::value, "SimState is cloned by copying");
+
+// Fill state from ship's surroundings in world, taking the nearest asteroids within radius.
+// Returns false if there's no such ship
+bool capture_sim_state(World& world, Entity ship, float radius, SimState& state);
+// Advance one tick with the ship given input, as World::Tick would. Does nothing once the
+// ship is lost
+void sim_step(SimState& state, const PlayerInput& input);
+// Advance states[i] with inputs[i] for each of n states
+void sim_step_batch(SimState* states, const PlayerInput* inputs, int n);
+
+#endif // LOOKAHEAD_H
@@ -3,60 +3,49 @@
 #include <cmath>
 #include <algorithm>
 #include <random>
-#include "asteroid.h"
-#include "player.h"
-#include "bullet.h"
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <string>
 #include "game_constants.h"
+#include "hud.h"
+#include "particles.h"
+#include "alloc_counter.h"
+#include "world.h"
+#include "controllers.h"
+#include "soak_monitor.h"
+#include "snapshot.h"
+#include "rollback.h"
+#include "rewind.h"
+#include "netplay.h"
+#include "match_client.h"
+#include "client_view.h"
+#include "capture.h"
+
+// Read the local player's controls
+PlayerInput read_keyboard() {
+    PlayerInput input;
+    input.left = IsKeyDown(KEY_LEFT);
+    input.right = IsKeyDown(KEY_RIGHT);
+    input.thrust = IsKeyDown(KEY_UP);
+    input.fire = IsKeyDown(KEY_SPACE);
+    return input;
+}
 
-enum GameStatus {
-    MENU,
-    PLAYING,
-    NEXT_LEVEL,
-    GAME_OVER
-};
-    
-struct GameState {
-    
-    int level = 1;
-    int bulletFramesUntilNextSpawn = 0;
-
-    GameStatus status;
-
-    // Create random number generators for uniform real distribution and gaussian distribution
-    // TODO: Move this somewhere else
-    std::random_device rd; // Create seed
-    std::mt19937 gen;
-    std::uniform_real_distribution<> uniformDis;
-
-    //std::vector<Bullet> bullets = {};
-    //Player player;
-    //std::vector<Asteroid> asteroids = {}; // TODO: Length is already known so no need to declare with dynamic length
-    
-    GameState(): status(MENU), rd(), gen(rd()), uniformDis(0.0, 1.0) {}
-};
+// F11 takes a screenshot and ctrl+F11 starts and stops recording a GIF, written off the frame
+// loop (unlike raylib's own F12). Set once the window is open
+static FrameCapture* frameCapture = nullptr;
 
-std::vector<Asteroid> create_asteroids(GameState& state, int numAsteroids) {
-    
-    std::vector<Asteroid> asteroids {};
-
-    Vector2 position;
-    float xSpeed;
-    float ySpeed;
-    // TODO: This should not be hardcoded here
-    int size = 3;
-    int numVertices;
-    
-    for (int i = 0; i < numAsteroids; i++) {
-	position = {state.uniformDis(state.gen) * GC::SCREEN_WIDTH, state.uniformDis(state.gen) * GC::SCREEN_HEIGHT};
-	// Select speed from uniform random distribution between -3 and 3
-	xSpeed = (state.uniformDis(state.gen) * 6 - 3);
-        ySpeed = (state.uniformDis(state.gen) * 6 - 3);
-	Asteroid ast = Asteroid(position, xSpeed, ySpeed, 3, 12, WHITE, GC::SCREEN_WIDTH, GC::SCREEN_HEIGHT);
-        asteroids.push_back(ast);
+// EndDrawing(), capturing the frame first if one is wanted
+void end_drawing() {
+    if (frameCapture) {
+        if (IsKeyPressed(KEY_F11)) {
+	    if (IsKeyDown(KEY_LEFT_CONTROL) || IsKeyDown(KEY_RIGHT_CONTROL)) frameCapture->ToggleRecording();
+	    else frameCapture->TakeScreenshot();
+	}
+	frameCapture->Capture();
     }
-
-    return asteroids;    
-
+    EndDrawing();
 }
 
 void menu_screen(GameState& state) {
@@ -80,7 +69,7 @@ void menu_screen(GameState& state) {
     DrawText(text, (GC::SCREEN_WIDTH/2) - (textWidth/2), GC::SCREEN_HEIGHT/2 - 70, textFontSize, WHITE);
     DrawText(subText, (GC::SCREEN_WIDTH/2) - (subTextWidth/2), GC::SCREEN_HEIGHT/2, subTextFontSize, WHITE);
     
-    EndDrawing();
+    end_drawing();
 }
 
 void next_level_screen(GameState& state) {
@@ -105,7 +94,7 @@ void next_level_screen(GameState& state) {
     DrawText(text, (GC::SCREEN_WIDTH/2) - (textWidth/2), GC::SCREEN_HEIGHT/2 - 50, textFontSize, WHITE);
     DrawText(subText, (GC::SCREEN_WIDTH/2) - (subTextWidth/2), GC::SCREEN_HEIGHT/2, subTextFontSize, WHITE);
 
-    EndDrawing();
+    end_drawing();
 }
 
 bool game_over_screen(GameState& state) {
@@ -132,134 +121,283 @@ bool game_over_screen(GameState& state) {
     DrawText(text, (GC::SCREEN_WIDTH/2) - (textWidth/2), GC::SCREEN_HEIGHT/2 - 50, textFontSize, WHITE);
     DrawText(subText, (GC::SCREEN_WIDTH/2) - (subTextWidth/2), GC::SCREEN_HEIGHT/2, subTextFontSize, WHITE);
 
-    EndDrawing();
+    end_drawing();
 
     // New game not started
     return false;
 }
 
-void playing_screen(GameState& state, Player& p, std::vector<Bullet>& bullets, std::vector<Asteroid>& asteroids, raylib::Color& textColor) {
-
-	if (IsKeyDown(KEY_SPACE)) {
-	            //Create a new bullet if enough frames have passed since the last spawn
-                    if (state.bulletFramesUntilNextSpawn <= 0) {
-	    
-                        // Quick way to get the bullet x & y deltas
-	                float bVelocX = p.getDeltaXShip() * (GC::BULLET_SPEED/p.getLength());
-	                float bVelocY = p.getDeltaYShip() * (GC::BULLET_SPEED/p.getLength());
-	    
-	                bullets.push_back(Bullet({p.getPoints()[0].x, p.getPoints()[0].y}, bVelocX, bVelocY));
-	                state.bulletFramesUntilNextSpawn = GC::BULLET_FRAMES_PER_SPAWN;
-	             }
-	        }
-
-	        // Decrement the frame count between bullet spawning
-	        if (state.bulletFramesUntilNextSpawn > 0) state.bulletFramesUntilNextSpawn--;
-
-                // DRAW------------------------------------------------------------------------------
-                BeginDrawing();
-                ClearBackground(BLACK);
-
-	        // Draw all bullets
-	        for (auto& bullet : bullets) {
-	            bullet.Draw();
-	        }
-
-	        // Split or remove asteroids that have been hit by a bullet depending on their size
-	        std::vector<Asteroid> newAsteroids = {};
-	
-	        for (auto it = bullets.begin(); it != bullets.end(); ++it) {
-	            // Check if bullet is inside any asteroid
-	            for (auto asteroid_it = asteroids.begin(); asteroid_it != asteroids.end();) {
-	                if (asteroid_it->ContainsBullet(it->getPosition())) {
-		            // Remove the asteroid, spawn new smaller asteroids to resemble the
-		            // breaking up of the old, larger one
-		            if (asteroid_it->getSize() > 1) {
-		         
-			        int newSize = asteroid_it->getSize() - 1;
-			
-			        for (int i=0; i<GC::ASTEROID_SPAWN_FACTOR; i++){
-			     
-			            // Vary the position to within +- 1% of screen dimensions compared with original asteroid
-			            Vector2 newPosition = {asteroid_it->getPosition().x + (GC::SCREEN_WIDTH/100) * state.uniformDis(state.gen) , asteroid_it->getPosition().y + (GC::SCREEN_HEIGHT/100) * state.uniformDis(state.gen)};
-			            // Choose new x and y components of velocity within +-10% of the original asteroid's values
-			            float newVelocX = asteroid_it->getVelocX() + asteroid_it->getVelocX() * state.uniformDis(state.gen) * 0.1;
-			            float newVelocY = asteroid_it->getVelocY() + asteroid_it->getVelocY() * state.uniformDis(state.gen) * 0.1;
-			            int newNumVertices = asteroid_it->getNumVertices();
-			      
-                                    Asteroid newAsteroid = Asteroid(newPosition, newVelocX, newVelocY, newSize, newNumVertices, WHITE, GC::SCREEN_WIDTH, GC::SCREEN_HEIGHT);
-			            newAsteroids.push_back(newAsteroid);
-			        }
-		            } 
-		            asteroid_it = asteroids.erase(asteroid_it);
-		        } else {
-	                    ++asteroid_it;
-		        }
-	            }
-	        }
-
-	        // Add new asteroids to the full list
-	        asteroids.insert(asteroids.end(), newAsteroids.begin(), newAsteroids.end());
-
-	        // Remove bullets that are off screen
-	        bullets.erase(std::remove_if(bullets.begin(), bullets.end(),
-	            [](Bullet& bullet) {
-	                return bullet.IsOffScreen(GC::SCREEN_WIDTH, GC::SCREEN_HEIGHT);
-	            }), bullets.end());
-
-                // Check if any asteroids have hit the player
-
-	        // Draw all asteroids and check if any are hitting the player
-                for (auto& asteroid : asteroids) {
-	            if (p.CollidedWithAsteroid(asteroid)) {
-		        state.status = GAME_OVER;		
-		    }
-	            asteroid.Draw();
-	        }
+// The world as it stands. allocs is the heap allocations made during the previous frame, and
+// ticksBack how far the world has been rewound, if at all
+void draw_playing_screen(World& world, ParticleSystem& particles, Hud& hud, int allocs, int ticksBack = 0) {
+
+        BeginDrawing();
+        ClearBackground(BLACK);
+
+	world.Draw();
+
+	particles.Update();
+	particles.Draw();
+
+	GameState& state = world.state;
+	hud.Update({state.level, state.score, GetFPS(), world.getNumAsteroids(), world.getNumBullets(), particles.getCount(), allocs});
+	hud.Draw();
+	if (ticksBack > 0) {
+	    const char* text = TextFormat("<< %.1f s", (float)ticksBack / GC::FPS);
+	    DrawText(text, (GC::SCREEN_WIDTH/2) - (MeasureText(text, 30)/2), 20, 30, WHITE);
+	}
+	end_drawing();
+}
+
+void playing_screen(World& world, ParticleSystem& particles, Hud& hud, int allocs, const PlayerInput& input) {
+
+	world.Tick(input);
+	draw_playing_screen(world, particles, hud, allocs);
+}
+
+// Each ship's score, top right
+void draw_player_scores(World& world) {
+    world.players.ForEach([](Entity, Player&, PlayerInput&, PlayerSlot& slot) {
+        const char* text = TextFormat("P%d: %d", slot.index + 1, slot.score);
+	DrawText(text, GC::SCREEN_WIDTH - 10 - MeasureText(text, 20), 10 + slot.index * 22, 20, GREEN);
+    });
+}
+
+// Shown until the other player answers. Returns false if the window is closed first
+bool wait_for_peer(raylib::Window& w, NetplayPeer& peer) {
+    std::string textStr = "WAITING FOR " + format_address(peer.getSettings().peer);
+    while (!w.ShouldClose()) {
+        if (peer.Handshake()) return true;
+
+	BeginDrawing();
+	ClearBackground(BLACK);
+	int textWidth = MeasureText(textStr.c_str(), 20);
+	DrawText(textStr.c_str(), (GC::SCREEN_WIDTH/2) - (textWidth/2), GC::SCREEN_HEIGHT/2, 20, WHITE);
+	end_drawing();
+    }
+    return false;
+}
 
-	        p.Draw();
+// Two-player rollback game against the peer. There are no menus: the game carries on through
+// levels and restarts by itself when it's over
+void netplay_loop(raylib::Window& w, World& world, ParticleSystem& particles, Hud& hud, NetplayPeer& peer) {
+    const NetplaySettings& settings = peer.getSettings();
+    RollbackSession session(world, 2, settings.slot, settings.inputDelay, settings.maxRollback);
+    // Global heap allocations made during the previous frame, for the HUD
+    int allocsLastFrame = 0;
+
+    while (!w.ShouldClose()) {
+	uint64_t allocsAtFrameStart = AllocCounter::getCount();
+
+        peer.Receive(session);
+	if (peer.isTimedOut()) {
+	    std::cerr << "netplay: lost " << format_address(settings.peer) << std::endl;
+	    break;
+	}
+	// Waiting for the peer's input freezes the game rather than predicting too far ahead
+	if (session.CanAdvance()) session.AdvanceFrame(read_keyboard());
+	peer.SendInputs(session);
+
+	BeginDrawing();
+	ClearBackground(BLACK);
+	world.Draw();
+	particles.Update();
+	particles.Draw();
+	GameState& state = world.state;
+	hud.Update({state.level, state.score, GetFPS(), world.getNumAsteroids(), world.getNumBullets(), particles.getCount(), allocsLastFrame});
+	hud.Draw();
+	draw_player_scores(world);
+	end_drawing();
+
+	allocsLastFrame = (int)(AllocCounter::getCount() - allocsAtFrameStart);
+    }
+}
 
-	        textColor.DrawText("Level: " + std::to_string(state.level) + "", 10, 10, 20);	
-	        EndDrawing();
+// Playing on a match server. The local ship is predicted and everything else is drawn a few
+// ticks behind, between snapshots. When a match ends the client joins the next one
+void server_loop(raylib::Window& w, Hud& hud, MatchClient& client, ClientView& view) {
+    int joined = 0;
+    while (!w.ShouldClose()) {
+	uint64_t allocsAtFrameStart = AllocCounter::getCount();
+
+        bool newer = client.Poll();
+	if (client.getStats().matchesJoined != joined) {
+	    joined = client.getStats().matchesJoined;
+	    view.Reset(client.getSlot());
+	}
+	if (newer) view.AddSnapshot(client.getSnapshotTick(), client.getLastAppliedInput(), client.getSnapshot());
+	if (client.isTimedOut()) {
+	    std::cerr << "client: lost the server" << std::endl;
+	    break;
+	}
 
-	        // Check if asteroids vector is empty and move to next level if so
-	        if (asteroids.empty()) {
-	            state.level++;
-                    // Load in the next set of asteroids
-                    asteroids = create_asteroids(state, 3);
-		    state.status = NEXT_LEVEL;
-	        }
+	PlayerInput input = read_keyboard();
+	uint32_t frame = client.SendInput(input, view.hasView() ? view.getRenderTick() : -1);
+	if (frame != MATCH_NONE) view.Update(frame, input);
+
+	BeginDrawing();
+	ClearBackground(BLACK);
+	if (!view.hasView()) {
+	    const char* text = "WAITING FOR SERVER";
+	    DrawText(text, (GC::SCREEN_WIDTH/2) - (MeasureText(text, 20)/2), GC::SCREEN_HEIGHT/2, 20, WHITE);
+	} else {
+	    World& world = view.getView();
+	    world.Draw();
+	    GameState& state = world.state;
+	    int allocs = (int)(AllocCounter::getCount() - allocsAtFrameStart);
+	    hud.Update({state.level, state.score, GetFPS(), world.getNumAsteroids(), world.getNumBullets(), 0, allocs});
+	    hud.Draw();
+	    draw_player_scores(world);
+	}
+	end_drawing();
+	view.Presented();
+    }
+    client.Close();
 }
 
-int main() {
+void print_usage(const char* program) {
+    std::cerr << "usage: " << program << " [--soak SECONDS] [--bot NAME] [--soak-sample SECONDS] [--net SLOT PORT PEER] [--mode coop|versus] [--connect SERVER] [--interp TICKS]" << std::endl;
+    std::cerr << "  --soak SECONDS         let a bot play for SECONDS, then fail if memory or frame times crept up" << std::endl;
+    std::cerr << "  --bot NAME             bot to play with in soak mode (none, spinner, random, autopilot or search)" << std::endl;
+    std::cerr << "  --soak-sample SECONDS  time between soak samples (default 60)" << std::endl;
+    std::cerr << "  --net SLOT PORT PEER   play a two-player rollback game from slot 0 (host) or 1, on UDP PORT, against PEER (IP:PORT)" << std::endl;
+    std::cerr << "  --mode coop|versus     whether the host's game has the ships' bullets hit each other (default coop)" << std::endl;
+    std::cerr << "  --connect SERVER       play on a match server (IP:PORT) with the local ship predicted" << std::endl;
+    std::cerr << "  --interp TICKS         how far behind the server other ships and asteroids are drawn (default 3)" << std::endl;
+}
 
-    GameState state;
+int main(int argc, char** argv) {
+
+    SoakConfig soakConfig;
+    bool soaking = false;
+    std::string botName = "random";
+    NetplaySettings netSettings;
+    bool netplay = false;
+    NetAddress server;
+    bool connecting = false;
+    ClientViewSettings viewSettings;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+	if (arg == "--soak" && i + 1 < argc) {
+	    soaking = true;
+	    soakConfig.durationSeconds = std::atof(argv[++i]);
+	} else if (arg == "--soak-sample" && i + 1 < argc) {
+	    soakConfig.sampleSeconds = std::atof(argv[++i]);
+	} else if (arg == "--bot" && i + 1 < argc) {
+	    botName = argv[++i];
+	} else if (arg == "--net" && i + 3 < argc) {
+	    netplay = true;
+	    netSettings.slot = std::atoi(argv[++i]);
+	    netSettings.port = (uint16_t)std::atoi(argv[++i]);
+	    if (!parse_address(argv[++i], netSettings.peer) || (netSettings.slot != 0 && netSettings.slot != 1)) {
+	        print_usage(argv[0]);
+		return 1;
+	    }
+	} else if (arg == "--connect" && i + 1 < argc) {
+	    connecting = true;
+	    if (!parse_address(argv[++i], server)) {
+	        print_usage(argv[0]);
+		return 1;
+	    }
+	} else if (arg == "--interp" && i + 1 < argc) {
+	    viewSettings.interpolationTicks = (float)std::atof(argv[++i]);
+	} else if (arg == "--mode" && i + 1 < argc) {
+	    std::string mode = argv[++i];
+	    if (mode != "coop" && mode != "versus") {
+	        print_usage(argv[0]);
+		return 1;
+	    }
+	    netSettings.mode = mode == "coop" ? COOP : VERSUS;
+	} else {
+	    print_usage(argv[0]);
+	    return 1;
+	}
+    }
+    if (soaking && !check_soak_config(soakConfig)) return 1;
+
+    // In soak mode a bot plays instead of the keyboard
+    std::unique_ptr<Controller> bot;
+    if (soaking) {
+        bot = make_controller(botName, std::random_device()());
+	if (!bot) {
+	    std::cerr << "unknown bot '" << botName << "'" << std::endl;
+	    return 1;
+	}
+    }
 
-    raylib::Color textColor(GREEN);
     raylib::Window w(GC::SCREEN_WIDTH, GC::SCREEN_HEIGHT, "Asteroids");
     
     SetTargetFPS(GC::FPS);
+
+    // Declared after the window so it's gone before the window closes
+    FrameCapture capture;
+    frameCapture = &capture;
    
-    // TODO: Can't find how to make Player p; work. Think something to do with how class is defined
-    Player p = Player();
-    std::vector<Bullet> bullets;// = {};
-    
-    std::vector<Asteroid> asteroids;// = create_asteroids(state, 3);
+    Hud hud(GREEN);
+    ParticleSystem particles(GC::MAX_PARTICLES);
+
+    if (connecting) {
+        MatchClient client;
+	if (!client.Open(server)) return 1;
+	ClientView view(viewSettings);
+	server_loop(w, hud, client, view);
+	return 0;
+    }
+
+    // Both players have to simulate the same game, so the host's seed is used
+    unsigned int seed = std::random_device()();
+    NetplayPeer peer;
+    if (netplay) {
+        netSettings.seed = seed;
+	if (!peer.Open(netSettings)) return 1;
+	if (!wait_for_peer(w, peer)) return 0;
+	seed = peer.getSettings().seed;
+    }
+
+    World world(GC::SCREEN_WIDTH, GC::SCREEN_HEIGHT, seed);
+    world.particles = &particles;
+    if (netplay) {
+        world.mode = peer.getSettings().mode;
+	netplay_loop(w, world, particles, hud, peer);
+	return 0;
+    }
+
+    GameState& state = world.state;
+    Entity ship = NULL_ENTITY;
+
+    // Hold backspace to run time backwards, four times as fast with shift held too
+    RewindHistory rewind;
+    int ticksBack = 0;
+    // Global heap allocations made during the previous frame, for the HUD
+    int allocsLastFrame = 0;
+
+    SoakMonitor soak(soakConfig);
+    auto soakStart = std::chrono::steady_clock::now();
+    auto lastFrame = soakStart;
    
     bool isNewGame = true;
 
     // Main game loop
     while (!w.ShouldClose()) // Detect window close button or ESC key
     {
-	if (isNewGame == true) {
-	    p = Player();
-    	    bullets = {};
-	    asteroids = create_asteroids(state, 3);
-	    state.level = 1;
+	uint64_t allocsAtFrameStart = AllocCounter::getCount();
 
+	if (isNewGame == true) {
+	    ship = world.NewGame();
+	    // Nothing from the last game to go back to
+	    rewind.Clear();
+	    ticksBack = 0;
 	    isNewGame = false;	    
 	}
 
+	// The bot doesn't need the menus. Go straight back into the game
+	if (soaking && state.status != PLAYING) {
+	    if (state.status == GAME_OVER) isNewGame = true;
+	    state.status = PLAYING;
+	    continue;
+	}
+
 	switch (state.status)
 	{
 	    case MENU:
@@ -272,10 +410,41 @@ int main() {
 	        isNewGame = game_over_screen(state);
 	        break;
 	    case PLAYING:
-		playing_screen(state, p, bullets, asteroids, textColor);
+	        // Quicksave and quickload
+		if (IsKeyPressed(KEY_F5)) save_snapshot_file(world, "quicksave.snap");
+		if (IsKeyPressed(KEY_F9) && load_snapshot_file(world, "quicksave.snap")) {
+		    ship = world.getShip();
+		    // The history is of a game that is gone now
+		    rewind.Clear();
+		    ticksBack = 0;
+		}
+		if (IsKeyDown(KEY_BACKSPACE)) {
+		    int speed = IsKeyDown(KEY_LEFT_SHIFT) || IsKeyDown(KEY_RIGHT_SHIFT) ? GC::REWIND_FAST_TICKS : 1;
+		    int back = std::min(ticksBack + speed, rewind.getDepth());
+		    if (back != ticksBack && rewind.Seek(world, back)) {
+		        ticksBack = back;
+			ship = world.getShip();
+		    }
+		    draw_playing_screen(world, particles, hud, allocsLastFrame, ticksBack);
+		    break;
+		}
+		// Letting go carries on from wherever time had got back to
+		ticksBack = 0;
+		playing_screen(world, particles, hud, allocsLastFrame, bot ? bot->Decide(world, ship) : read_keyboard());
+		rewind.Record(world);
 		break;
         }
+
+	allocsLastFrame = (int)(AllocCounter::getCount() - allocsAtFrameStart);
+
+	if (soaking) {
+	    auto now = std::chrono::steady_clock::now();
+	    soak.RecordFrame(std::chrono::duration<double>(now - lastFrame).count());
+	    lastFrame = now;
+	    if (!soak.Update(std::chrono::duration<double>(now - soakStart).count())) break;
+	}
     }
 
+    if (soaking) return soak.Passed() ? 0 : 1;
     return 0;
 }
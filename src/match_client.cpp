@@ -0,0 +1,176 @@
+#include <algorithm>
+#include <random>
+#include "match_client.h"
+
+using Clock = std::chrono::steady_clock;
+
+// How often to ask to join while waiting for an answer
+static constexpr double CONNECT_RETRY_SECONDS = 0.1;
+
+bool MatchClient::Open(const NetAddress& address, uint16_t localPort) {
+    server = address;
+    buffer.resize(MATCH_MAX_PACKET_BYTES);
+    nonce = std::random_device()();
+    reset();
+    lastHeard = Clock::now();
+    spectating = false;
+    return socket.Open(localPort);
+}
+
+bool MatchClient::OpenSpectator(const NetAddress& address, uint32_t matchId, uint16_t localPort) {
+    if (!Open(address, localPort)) return false;
+    spectating = true;
+    watchId = matchId;
+    return true;
+}
+
+void MatchClient::Close() {
+    if (connected) {
+        BitWriter writer(packet);
+	write_match_header(writer, MATCH_DISCONNECT);
+	writer.Write(matchId, 32);
+	writer.Write(DISCONNECT_LEFT, 8);
+	writer.Flush();
+	send();
+    }
+    reset();
+    socket.Close();
+}
+
+void MatchClient::reset() {
+    // A fresh nonce, so the server can tell this join from the last
+    nonce++;
+    connected = false;
+    slot = -1;
+    nextFrame = 0;
+    latestTick = MATCH_NONE;
+    lastApplied = MATCH_NONE;
+    std::fill(snapshotTicks.begin(), snapshotTicks.end(), MATCH_NONE);
+    lastConnect = Clock::time_point();
+}
+
+void MatchClient::send() {
+    if (socket.SendTo(server, packet.data(), packet.size())) {
+        stats.packetsSent++;
+	stats.bytesSent += packet.size();
+    }
+}
+
+bool MatchClient::isTimedOut(double seconds) const {
+    return std::chrono::duration<double>(Clock::now() - lastHeard).count() > seconds;
+}
+
+void MatchClient::sendSpectate() {
+    BitWriter writer(packet);
+    write_match_header(writer, MATCH_SPECTATE);
+    writer.Write(nonce, 32);
+    writer.Write(watchId, 32);
+    writer.Flush();
+    send();
+    lastConnect = Clock::now();
+}
+
+bool MatchClient::Poll() {
+    bool newer = false;
+    NetAddress from;
+    int size;
+    while ((size = socket.Receive(buffer.data(), buffer.size(), from)) >= 0) {
+        if (from != server) continue;
+	stats.packetsReceived++;
+	stats.bytesReceived += size;
+	lastHeard = Clock::now();
+
+	BitReader reader(buffer.data(), size);
+	int type = read_match_header(reader);
+	if (type == MATCH_ACCEPT) {
+	    uint32_t acceptedNonce = (uint32_t)reader.Read(32);
+	    uint32_t id = (uint32_t)reader.Read(32);
+	    int acceptedSlot = (int)reader.Read(8);
+	    int players = (int)reader.Read(8);
+	    if (!reader.isGood() || acceptedNonce != nonce || connected || (acceptedSlot == MATCH_SPECTATOR_SLOT) != spectating) continue;
+	    connected = true;
+	    matchId = id;
+	    slot = acceptedSlot;
+	    numPlayers = players;
+	    stats.matchesJoined++;
+	} else if (type == MATCH_SNAPSHOT) {
+	    uint32_t id = (uint32_t)reader.Read(32);
+	    uint32_t tick = (uint32_t)reader.Read(32);
+	    uint32_t base = (uint32_t)reader.Read(32);
+	    uint32_t applied = (uint32_t)reader.Read(32);
+	    if (!reader.isGood() || !connected || id != matchId) continue;
+	    stats.snapshots++;
+
+	    // Older than what we've got, or made against a tick we no longer have
+	    if (latestTick != MATCH_NONE && tick <= latestTick) {
+	        stats.snapshotsSkipped++;
+		continue;
+	    }
+	    const std::vector<std::byte>* reference = nullptr;
+	    if (base != MATCH_NONE) {
+	        if (base >= tick || tick - base >= MATCH_SNAPSHOT_HISTORY || snapshotTicks[base % MATCH_SNAPSHOT_HISTORY] != base) {
+		    stats.snapshotsSkipped++;
+		    continue;
+		}
+		reference = &snapshots[base % MATCH_SNAPSHOT_HISTORY];
+	    }
+
+	    // The base is less than the history older than tick, so this isn't the slot it's in
+	    uint32_t h = tick % MATCH_SNAPSHOT_HISTORY;
+	    if (size < (int)MATCH_SNAPSHOT_HEADER_BYTES || !codec.Decode(reference ? reference->data() : nullptr, reference ? reference->size() : 0,
+	        buffer.data() + MATCH_SNAPSHOT_HEADER_BYTES, size - MATCH_SNAPSHOT_HEADER_BYTES, snapshots[h])) {
+	        stats.decodeFailures++;
+		snapshotTicks[h] = MATCH_NONE;
+		continue;
+	    }
+	    snapshotTicks[h] = tick;
+	    latestTick = tick;
+	    lastApplied = applied;
+	    newer = true;
+	} else if (type == MATCH_DISCONNECT) {
+	    uint32_t id = (uint32_t)reader.Read(32);
+	    if (!reader.isGood() || (connected && id != matchId)) continue;
+	    // The match is over, or the server has given up on us. Ask for another
+	    reset();
+	    watchId = MATCH_NONE;
+	}
+    }
+
+    if (spectating) {
+        double since = std::chrono::duration<double>(Clock::now() - lastConnect).count();
+	if (since >= (connected ? MATCH_SPECTATE_KEEPALIVE_SECONDS : CONNECT_RETRY_SECONDS)) sendSpectate();
+    }
+    return newer;
+}
+
+uint32_t MatchClient::SendInput(const PlayerInput& input, double viewTick) {
+    if (spectating) return MATCH_NONE;
+    if (!connected) {
+        if (std::chrono::duration<double>(Clock::now() - lastConnect).count() >= CONNECT_RETRY_SECONDS) {
+	    BitWriter writer(packet);
+	    write_match_header(writer, MATCH_CONNECT);
+	    writer.Write(nonce, 32);
+	    writer.Flush();
+	    send();
+	    lastConnect = Clock::now();
+	}
+	return MATCH_NONE;
+    }
+
+    uint32_t frame = nextFrame++;
+    inputs[frame % MATCH_INPUT_REDUNDANCY] = input;
+    uint32_t count = std::min<uint32_t>(nextFrame, MATCH_INPUT_REDUNDANCY);
+    uint32_t first = nextFrame - count;
+
+    BitWriter writer(packet);
+    write_match_header(writer, MATCH_INPUT);
+    writer.Write(matchId, 32);
+    writer.Write(latestTick, 32);
+    writer.Write(viewTick < 0 ? MATCH_NONE : (uint32_t)(viewTick * (1 << MATCH_VIEW_TICK_BITS)), 32);
+    writer.Write(first, 32);
+    writer.Write(count, 8);
+    for (uint32_t f = first; f < nextFrame; f++) writer.Write(pack_input(inputs[f % MATCH_INPUT_REDUNDANCY]), 4);
+    writer.Flush();
+    send();
+    return frame;
+}
@@ -0,0 +1,95 @@
+#ifndef MATCH_CLIENT_H
+#define MATCH_CLIENT_H
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include "components.h"
+#include "snapshot_delta.h"
+#include "udp_socket.h"
+#include "match_protocol.h"
+
+struct MatchClientStats {
+    uint64_t packetsSent = 0;
+    uint64_t packetsReceived = 0;
+    uint64_t bytesSent = 0;
+    uint64_t bytesReceived = 0;
+    uint64_t snapshots = 0;
+    // Snapshots that arrived after a newer one, or against a tick we no longer have
+    uint64_t snapshotsSkipped = 0;
+    uint64_t decodeFailures = 0;
+    int matchesJoined = 0;
+};
+
+// A player's connection to a MatchServer (see match_protocol.h). Joins a match, sends one
+// input a frame and rebuilds the server's snapshots. When a match ends it joins another.
+// Opened as a spectator it only watches, and moves on to the most watched match when the one
+// it's watching ends
+class MatchClient {
+    public:
+	// Bind a socket (on any free port if localPort is 0) to talk to the server at address
+	bool Open(const NetAddress& server, uint16_t localPort = 0);
+	// Watch matchId, or whichever match most people are watching, instead of playing
+	bool OpenSpectator(const NetAddress& server, uint32_t matchId = MATCH_NONE, uint16_t localPort = 0);
+	// Tell the server we're going
+	void Close();
+
+	// Take in everything the server has sent. Returns true if a newer snapshot arrived. A
+	// spectator also asks to watch, and keeps its place, from here
+	bool Poll();
+	// Send this frame's input along with the last few, or ask to join while not in a match.
+	// viewTick is the tick of the world on screen when the input was chosen (see
+	// ClientView::getRenderTick), or negative if there wasn't one. Returns the frame number
+	// the input was given. Spectators send nothing
+	uint32_t SendInput(const PlayerInput& input, double viewTick = -1);
+
+	bool isConnected() const { return connected; }
+	uint32_t getMatchId() const { return matchId; }
+	int getSlot() const { return slot; }
+	int getNumPlayers() const { return numPlayers; }
+	bool isSpectator() const { return spectating; }
+	// Nothing heard from the server for this long
+	bool isTimedOut(double seconds = MATCH_TIMEOUT_SECONDS) const;
+
+	// The newest snapshot and its tick, or MATCH_NONE if there isn't one yet
+	uint32_t getSnapshotTick() const { return latestTick; }
+	const std::vector<std::byte>& getSnapshot() const { return snapshots[latestTick % MATCH_SNAPSHOT_HISTORY]; }
+	// The newest of our input frames the server had used when it made that snapshot
+	uint32_t getLastAppliedInput() const { return lastApplied; }
+
+	const MatchClientStats& getStats() const { return stats; }
+    private:
+	void send();
+	void reset();
+	void sendSpectate();
+
+	UdpSocket socket;
+	NetAddress server;
+	uint32_t nonce = 0;
+	bool connected = false;
+	bool spectating = false;
+	// What a spectator asked to watch
+	uint32_t watchId = MATCH_NONE;
+	uint32_t matchId = 0;
+	int slot = -1;
+	int numPlayers = 0;
+	std::chrono::steady_clock::time_point lastConnect;
+	std::chrono::steady_clock::time_point lastHeard = std::chrono::steady_clock::now();
+
+	// Our inputs for the last MATCH_INPUT_REDUNDANCY frames, at [frame % size]
+	PlayerInput inputs[MATCH_INPUT_REDUNDANCY];
+	uint32_t nextFrame = 0;
+
+	// Decoded snapshots of recent ticks, at [tick % size], to decode later deltas against
+	std::vector<std::vector<std::byte>> snapshots = std::vector<std::vector<std::byte>>(MATCH_SNAPSHOT_HISTORY);
+	std::vector<uint32_t> snapshotTicks = std::vector<uint32_t>(MATCH_SNAPSHOT_HISTORY, MATCH_NONE);
+	uint32_t latestTick = MATCH_NONE;
+	uint32_t lastApplied = MATCH_NONE;
+	SnapshotDeltaCodec codec = SnapshotDeltaCodec(LOSSLESS_PRECISION);
+
+	std::vector<uint8_t> buffer;
+	std::vector<uint8_t> packet;
+	MatchClientStats stats;
+};
+
+#endif // MATCH_CLIENT_H
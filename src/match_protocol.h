@@ -0,0 +1,87 @@
+#ifndef MATCH_PROTOCOL_H
+#define MATCH_PROTOCOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include "bit_stream.h"
+
+// Packets between the match server and its clients. Each starts with MATCH_MAGIC and a type
+// byte; the rest is bit-packed with bit_stream.h.
+//
+//     CONNECT     client -> server  u32 nonce
+//     ACCEPT      server -> client  u32 nonce, u32 match, u8 slot, u8 players
+//     INPUT       client -> server  u32 match, u32 newest snapshot tick received (or none),
+//                                   u32 tick the client was drawing when it chose the newest
+//                                   input, in 256ths (or none), u32 first frame, u8 count,
+//                                   count inputs of 4 bits
+//     SNAPSHOT    server -> client  u32 match, u32 tick, u32 base tick (or none), u32 newest
+//                                   input frame applied (or none), then byte-aligned, a
+//                                   lossless snapshot delta (snapshot_delta.h) against base
+//     DISCONNECT  either way        u32 match, u8 reason
+//     SPECTATE    client -> server  u32 nonce, u32 match to watch (or none for the most
+//                                   watched one)
+//
+// A client sends CONNECT until it's accepted, then one INPUT a frame. Every INPUT repeats the
+// last few inputs, so a lost packet costs nothing as long as the next one arrives. The server
+// sends every client a SNAPSHOT each tick, delta-encoded against the newest tick that client
+// says it has, or against nothing if it has none the server still remembers. The tick a client
+// was drawing tells the server how far in the past it saw the asteroids, so its shots can be
+// tested against them there (lag_compensation.h).
+//
+// A spectator sends SPECTATE until it's accepted (with slot MATCH_SPECTATOR_SLOT), then again
+// every MATCH_SPECTATE_KEEPALIVE_SECONDS to stay on. Spectators all get the same SNAPSHOT each
+// tick, built once: a delta against the tick before, or a keyframe every
+// MATCH_SPECTATOR_KEYFRAME_TICKS so anyone who joined or lost a packet can pick up again
+
+static constexpr uint32_t MATCH_MAGIC = 0x4843544d; // "MTCH"
+// Used for "none" in tick and frame fields
+static constexpr uint32_t MATCH_NONE = UINT32_MAX;
+
+enum MatchPacketType {
+    MATCH_CONNECT = 1,
+    MATCH_ACCEPT,
+    MATCH_INPUT,
+    MATCH_SNAPSHOT,
+    MATCH_DISCONNECT,
+    MATCH_SPECTATE
+};
+
+enum MatchDisconnectReason {
+    DISCONNECT_LEFT,
+    DISCONNECT_MATCH_OVER,
+    DISCONNECT_TIMED_OUT,
+    DISCONNECT_SERVER_FULL
+};
+
+// Largest packet either side sends. Keyframes of big worlds can exceed a network MTU and rely
+// on IP fragmentation, which loopback handles fine
+static constexpr size_t MATCH_MAX_PACKET_BYTES = 60000;
+// Inputs repeated in every INPUT packet
+static constexpr int MATCH_INPUT_REDUNDANCY = 8;
+// Ticks of snapshots the server keeps to encode deltas against, and the client keeps to decode
+// them with
+static constexpr uint32_t MATCH_SNAPSHOT_HISTORY = 32;
+// Either side gives up on the other after this long without a packet
+static constexpr double MATCH_TIMEOUT_SECONDS = 5.0;
+// The slot an ACCEPT gives a spectator
+static constexpr int MATCH_SPECTATOR_SLOT = 255;
+static constexpr uint32_t MATCH_SPECTATOR_KEYFRAME_TICKS = 60;
+static constexpr double MATCH_SPECTATE_KEEPALIVE_SECONDS = 1.0;
+// INPUT's view tick is fixed point with this many fractional bits
+static constexpr int MATCH_VIEW_TICK_BITS = 8;
+// Bytes before the delta in a SNAPSHOT packet
+static constexpr size_t MATCH_SNAPSHOT_HEADER_BYTES = 21;
+
+inline void write_match_header(BitWriter& writer, MatchPacketType type) {
+    writer.Write(MATCH_MAGIC, 32);
+    writer.Write(type, 8);
+}
+
+// The packet's type, or -1 if it isn't one of ours
+inline int read_match_header(BitReader& reader) {
+    if (reader.Read(32) != MATCH_MAGIC) return -1;
+    int type = (int)reader.Read(8);
+    return reader.isGood() ? type : -1;
+}
+
+#endif // MATCH_PROTOCOL_H
@@ -0,0 +1,729 @@
+#include <algorithm>
+#include <iostream>
+#include <random>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+#include "match_server.h"
+#include "snapshot.h"
+
+using Clock = std::chrono::steady_clock;
+
+static uint64_t address_key(const NetAddress& address) {
+    return ((uint64_t)address.ip << 16) | address.port;
+}
+
+Match::Match(uint32_t matchId, unsigned int seed, const ServerConfig& config) :
+    id(matchId),
+    world(config.arenaWidth, config.arenaHeight, seed),
+    lagCompensation(config.lagCompensation ? std::make_unique<LagCompensation>(config.arenaWidth, config.arenaHeight) : nullptr),
+    numPlayers(config.playersPerMatch),
+    clients(config.playersPerMatch),
+    bots(config.playersPerMatch),
+    history(MATCH_SNAPSHOT_HISTORY),
+    historyTicks(MATCH_SNAPSHOT_HISTORY, MATCH_NONE),
+    codec(LOSSLESS_PRECISION)
+{
+    world.mode = config.mode;
+    world.lagCompensation = lagCompensation.get();
+    world.NewGame(numPlayers);
+    create_asteroids(world, config.extraAsteroids);
+    world.state.status = PLAYING;
+}
+
+MatchServer::MatchServer(const ServerConfig& c) : config(c), nextSeed(std::random_device()()) {
+    config.playersPerMatch = std::clamp(config.playersPerMatch, 1, GC::MAX_PLAYERS);
+    config.arenaWidth = std::max(config.arenaWidth, 1);
+    config.arenaHeight = std::max(config.arenaHeight, 1);
+    buffer.resize(MATCH_MAX_PACKET_BYTES);
+}
+
+MatchServer::~MatchServer() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+	stopping = true;
+    }
+    roundStart.notify_all();
+    for (auto& worker : workers) worker->thread.join();
+    fanout.Stop();
+}
+
+bool MatchServer::Start() {
+    if (!socket.Open(config.port)) return false;
+    fanout.Start();
+
+    int numWorkers = config.workers > 0 ? config.workers : (int)std::max(1u, std::thread::hardware_concurrency());
+    for (int i = 0; i < numWorkers; i++) workers.push_back(std::make_unique<Worker>());
+    for (int i = 0; i < numWorkers; i++) {
+        workers[i]->thread = std::thread(&MatchServer::workerLoop, this, i);
+#ifdef __linux__
+	if (config.pinWorkers) {
+	    cpu_set_t cpus;
+	    CPU_ZERO(&cpus);
+	    CPU_SET(i % std::max(1u, std::thread::hardware_concurrency()), &cpus);
+	    pthread_setaffinity_np(workers[i]->thread.native_handle(), sizeof(cpus), &cpus);
+	}
+#endif
+    }
+    return true;
+}
+
+void MatchServer::workerLoop(int index) {
+    Worker& worker = *workers[index];
+    uint64_t seen = 0;
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        roundStart.wait(lock, [&] { return round != seen || stopping; });
+	if (stopping) return;
+	seen = round;
+	lock.unlock();
+
+	for (Match* match : worker.matches) tickMatch(*match, worker);
+
+	lock.lock();
+	if (--workersBusy == 0) roundDone.notify_one();
+    }
+}
+
+void MatchServer::RunRound() {
+    auto start = Clock::now();
+
+    receivePackets();
+    dropTimedOutClients();
+    updateAudiences();
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+	workersBusy = (int)workers.size();
+	round++;
+	roundStart.notify_all();
+	roundDone.wait(lock, [&] { return workersBusy == 0; });
+    }
+
+    retireMatches();
+    stats.rounds.Record(seconds_since(start));
+}
+
+// Next input for a client's ship: the one for the frame due this tick if it's arrived,
+// otherwise the last one again
+static PlayerInput take_input(ServerClient& client, ServerStats& stats) {
+    if (client.nextFrame == MATCH_NONE) return PlayerInput();
+
+    // A client that has got well ahead (its packets bunched up) is brought back to a couple of
+    // frames of buffer, so its inputs don't sit here adding latency
+    if (client.newestFrame != MATCH_NONE && client.newestFrame > client.nextFrame + 4) {
+        stats.inputsDropped += client.newestFrame - 2 - client.nextFrame;
+	client.nextFrame = client.newestFrame - 2;
+    }
+
+    int i = client.nextFrame % ServerClient::INPUT_BUFFER;
+    if (client.inputFrames[i] == client.nextFrame) {
+        client.lastInput = client.inputs[i];
+	client.viewTick = client.viewTicks[i];
+	stats.inputsApplied++;
+    } else {
+        stats.inputsMissing++;
+    }
+    client.lastApplied = client.nextFrame;
+    client.nextFrame++;
+    return client.lastInput;
+}
+
+void MatchServer::tickMatch(Match& match, Worker& worker) {
+    auto start = Clock::now();
+    World& world = match.world;
+
+    PlayerInput inputs[GC::MAX_PLAYERS];
+    for (int slot = 0; slot < match.numPlayers; slot++) {
+        if (match.bots[slot]) inputs[slot] = match.bots[slot]->Decide(world, world.getShip(slot));
+	else if (match.clients[slot].connected) inputs[slot] = take_input(match.clients[slot], worker.stats);
+    }
+    if (match.lagCompensation) setRewinds(match, worker);
+    world.Tick(inputs, match.numPlayers);
+    match.tick++;
+    if (match.lagCompensation) takeRewindStats(*match.lagCompensation, worker);
+
+    if (world.state.status == NEXT_LEVEL) world.state.status = PLAYING;
+    if (world.state.status == GAME_OVER || (config.matchTicks > 0 && match.tick >= config.matchTicks)) match.finished = true;
+
+    uint32_t h = match.tick % MATCH_SNAPSHOT_HISTORY;
+    auto& snapshot = match.history[h];
+    if (!snapshot || snapshot.use_count() > 1) snapshot = std::make_shared<std::vector<std::byte>>();
+    save_snapshot(world, *snapshot);
+    match.historyTicks[h] = match.tick;
+    for (int slot = 0; slot < match.numPlayers; slot++) {
+        if (match.clients[slot].connected) sendSnapshot(match, slot, worker);
+    }
+    if (match.audience) sendSpectatorSnapshot(match, worker);
+
+    double seconds = seconds_since(start);
+    worker.stats.matchTicks.Record(seconds);
+    match.cost = match.cost == 0 ? seconds : 0.95 * match.cost + 0.05 * seconds;
+}
+
+void MatchServer::setRewinds(Match& match, Worker& worker) {
+    LagCompensation& lag = *match.lagCompensation;
+    // The tick about to be simulated is the one the next snapshot is of. A client drawing tick
+    // view sees the asteroids that many ticks behind it
+    uint32_t tick = match.tick + 1;
+    for (int slot = 0; slot < GC::MAX_PLAYERS; slot++) {
+        lag.rewindTicks[slot] = 0;
+	if (slot >= match.numPlayers || match.bots[slot] || !match.clients[slot].connected) continue;
+	uint32_t view = match.clients[slot].viewTick;
+	if (view == MATCH_NONE) continue;
+	int64_t behind = ((int64_t)tick << MATCH_VIEW_TICK_BITS) - view;
+	int rewind = (int)std::clamp<int64_t>((behind + (1 << (MATCH_VIEW_TICK_BITS - 1))) >> MATCH_VIEW_TICK_BITS, 0, GC::MAX_REWIND_TICKS);
+	lag.rewindTicks[slot] = rewind;
+	worker.stats.rewinds.Record((double)rewind / GC::FPS);
+    }
+}
+
+void MatchServer::takeRewindStats(LagCompensation& lag, Worker& worker) {
+    LagCompensationStats& s = lag.stats;
+    if (s.rewoundTests == 0 && s.clamped == 0) return;
+    worker.stats.rewoundTests += s.rewoundTests;
+    worker.stats.rewoundHits += s.rewoundHits;
+    worker.stats.rewindsClamped += s.clamped;
+    worker.stats.rewindQueries.Merge(s.queryTimes);
+    s = LagCompensationStats();
+}
+
+void MatchServer::sendSnapshot(Match& match, int slot, Worker& worker) {
+    ServerClient& client = match.clients[slot];
+    // The match's snapshots, or the client's own under interest management
+    bool own = config.interestManagement;
+    if (own && !client.interest) {
+        client.interest = std::make_unique<ClientInterest>(config.interest);
+	client.history.resize(MATCH_SNAPSHOT_HISTORY);
+	client.historyTicks.assign(MATCH_SNAPSHOT_HISTORY, MATCH_NONE);
+    }
+    auto snapshotAt = [&](uint32_t h) { return own ? &client.history[h] : match.history[h].get(); };
+    const std::vector<uint32_t>& historyTicks = own ? client.historyTicks : match.historyTicks;
+
+    // Against the newest tick the client has, if we still have it too
+    uint32_t base = MATCH_NONE;
+    const std::vector<std::byte>* reference = nullptr;
+    if (client.ackTick != MATCH_NONE && client.ackTick < match.tick && match.tick - client.ackTick < MATCH_SNAPSHOT_HISTORY) {
+        uint32_t h = client.ackTick % MATCH_SNAPSHOT_HISTORY;
+	if (historyTicks[h] == client.ackTick) {
+	    base = client.ackTick;
+	    reference = snapshotAt(h);
+	}
+    }
+    if (own) saveClientSnapshot(match, slot, !reference, worker);
+    const std::vector<std::byte>& current = *snapshotAt(match.tick % MATCH_SNAPSHOT_HISTORY);
+    match.codec.Encode(reference ? reference->data() : nullptr, reference ? reference->size() : 0, current.data(), current.size(), match.delta);
+    if (MATCH_SNAPSHOT_HEADER_BYTES + match.delta.size() > MATCH_MAX_PACKET_BYTES) {
+        worker.stats.oversized++;
+	return;
+    }
+    if (reference) worker.stats.deltas++;
+    else worker.stats.keyframes++;
+
+    BitWriter writer(match.packet);
+    write_match_header(writer, MATCH_SNAPSHOT);
+    writer.Write(match.id, 32);
+    writer.Write(match.tick, 32);
+    writer.Write(base, 32);
+    writer.Write(client.lastApplied, 32);
+    writer.Flush();
+    match.packet.insert(match.packet.end(), match.delta.begin(), match.delta.end());
+
+    // Sending on a UDP socket from several threads at once is safe
+    if (socket.SendTo(client.address, match.packet.data(), match.packet.size())) {
+        worker.stats.packetsOut++;
+	worker.stats.bytesOut += match.packet.size();
+    }
+}
+
+void MatchServer::saveClientSnapshot(Match& match, int slot, bool keyframe, Worker& worker) {
+    ServerClient& client = match.clients[slot];
+    World& world = match.world;
+    // A keyframe carries everything the client is told about in full, so it starts again from
+    // what's nearby and fills in within the budget like anything else new
+    if (keyframe) client.interest->Reset();
+    Entity ship = world.getShip(slot);
+    Vector2 focus = ship != NULL_ENTITY ? world.registry.get<Player>(ship).getMidpoint() : Vector2{world.width / 2.0f, world.height / 2.0f};
+    client.interest->Update(world, focus);
+
+    uint32_t h = match.tick % MATCH_SNAPSHOT_HISTORY;
+    save_snapshot(world, client.history[h], &client.interest->getFilter());
+    client.historyTicks[h] = match.tick;
+
+    InterestStats s = client.interest->TakeStats();
+    worker.stats.interestSnapshots++;
+    worker.stats.interestEntities += s.entities;
+    worker.stats.interestUpdates += s.updates;
+    worker.stats.interestDeferred += s.deferred;
+}
+
+void MatchServer::sendSpectatorSnapshot(Match& match, Worker& worker) {
+    // Against the tick before, which every spectator who's keeping up has. The fanout does the
+    // encoding, so all this costs the match is a couple of references
+    SpectatorFrame frame;
+    frame.matchId = match.id;
+    frame.tick = match.tick;
+    frame.snapshot = match.history[match.tick % MATCH_SNAPSHOT_HISTORY];
+    uint32_t previous = match.tick - 1;
+    bool keyframe = match.spectatorKeyframeDue || match.tick % MATCH_SPECTATOR_KEYFRAME_TICKS == 0 || match.historyTicks[previous % MATCH_SNAPSHOT_HISTORY] != previous;
+    if (!keyframe) {
+        frame.baseTick = previous;
+	frame.base = match.history[previous % MATCH_SNAPSHOT_HISTORY];
+    }
+    match.spectatorKeyframeDue = false;
+    worker.stats.spectatorSnapshots++;
+    if (keyframe) worker.stats.spectatorKeyframes++;
+    fanout.Publish(std::move(frame), match.audience);
+}
+
+void MatchServer::receivePackets() {
+    NetAddress from;
+    int size;
+    while ((size = socket.Receive(buffer.data(), buffer.size(), from)) >= 0) {
+        stats.packetsIn++;
+	stats.bytesIn += size;
+	BitReader reader(buffer.data(), size);
+	switch (read_match_header(reader)) {
+	    case MATCH_CONNECT:
+	        handleConnect(reader, from);
+		break;
+	    case MATCH_INPUT:
+	        handleInput(reader, from);
+		break;
+	    case MATCH_DISCONNECT:
+	        handleDisconnect(reader, from);
+		break;
+	    case MATCH_SPECTATE:
+	        handleSpectate(reader, from);
+		break;
+	    default:
+	        stats.packetsIgnored++;
+		break;
+	}
+    }
+}
+
+void MatchServer::handleConnect(BitReader& reader, const NetAddress& from) {
+    uint32_t nonce = (uint32_t)reader.Read(32);
+    if (!reader.isGood()) {
+        stats.packetsIgnored++;
+	return;
+    }
+
+    // A repeat of a CONNECT we've already accepted, because the ACCEPT went missing
+    Match* match = nullptr;
+    int slot = -1;
+    for (auto& m : matches) {
+        for (int s = 0; s < m->numPlayers && !match; s++) {
+	    const ServerClient& client = m->clients[s];
+	    if (client.connected && client.address == from && client.nonce == nonce) {
+	        match = m.get();
+		slot = s;
+	    }
+	}
+    }
+
+    // Otherwise the first free slot, in a new match if need be
+    for (auto& m : matches) {
+        if (match || m->finished || m->bots[0]) continue;
+	for (int s = 0; s < m->numPlayers && !match; s++) {
+	    if (!m->clients[s].connected) {
+	        match = m.get();
+		slot = s;
+	    }
+	}
+    }
+    if (!match) {
+        match = startMatch();
+	slot = 0;
+    }
+    if (!match) {
+        sendDisconnect(from, 0, DISCONNECT_SERVER_FULL);
+	return;
+    }
+
+    ServerClient& client = match->clients[slot];
+    if (!client.connected) {
+        client = ServerClient();
+	client.address = from;
+	client.nonce = nonce;
+	client.connected = true;
+	std::fill(std::begin(client.inputFrames), std::end(client.inputFrames), MATCH_NONE);
+    }
+    client.lastHeard = Clock::now();
+
+    BitWriter writer(reply);
+    write_match_header(writer, MATCH_ACCEPT);
+    writer.Write(nonce, 32);
+    writer.Write(match->id, 32);
+    writer.Write(slot, 8);
+    writer.Write(match->numPlayers, 8);
+    writer.Flush();
+    if (socket.SendTo(from, reply.data(), reply.size())) {
+        stats.packetsOut++;
+	stats.bytesOut += reply.size();
+    }
+}
+
+bool MatchServer::findClient(const NetAddress& address, uint32_t matchId, Match*& match, int& slot) {
+    auto it = matchesById.find(matchId);
+    if (it == matchesById.end()) return false;
+    match = it->second;
+    for (slot = 0; slot < match->numPlayers; slot++) {
+        if (match->clients[slot].connected && match->clients[slot].address == address) return true;
+    }
+    return false;
+}
+
+void MatchServer::handleInput(BitReader& reader, const NetAddress& from) {
+    uint32_t matchId = (uint32_t)reader.Read(32);
+    uint32_t ackTick = (uint32_t)reader.Read(32);
+    uint32_t viewTick = (uint32_t)reader.Read(32);
+    uint32_t first = (uint32_t)reader.Read(32);
+    int count = (int)reader.Read(8);
+    PlayerInput inputs[MATCH_INPUT_REDUNDANCY];
+    for (int i = 0; i < count && i < MATCH_INPUT_REDUNDANCY; i++) inputs[i] = unpack_input((unsigned int)reader.Read(4));
+
+    Match* match;
+    int slot;
+    if (!reader.isGood() || count > MATCH_INPUT_REDUNDANCY || !findClient(from, matchId, match, slot)) {
+        stats.packetsIgnored++;
+	return;
+    }
+
+    ServerClient& client = match->clients[slot];
+    client.lastHeard = Clock::now();
+    if (ackTick != MATCH_NONE && (client.ackTick == MATCH_NONE || ackTick > client.ackTick)) client.ackTick = ackTick;
+
+    for (int i = 0; i < count; i++) {
+        uint32_t frame = first + i;
+	// The first input a client sends starts its clock
+	if (client.nextFrame == MATCH_NONE) client.nextFrame = frame;
+	if (frame < client.nextFrame) continue;
+	if (frame >= client.nextFrame + ServerClient::INPUT_BUFFER) {
+	    stats.inputsDropped++;
+	    continue;
+	}
+	int b = frame % ServerClient::INPUT_BUFFER;
+	// The view tick is for the newest input. The client's render clock runs at about a tick a
+	// frame, so older ones it's repeating for the first time (because the packet with them in
+	// went missing) were chosen about a tick earlier each
+	if (client.inputFrames[b] != frame) {
+	    uint32_t back = (uint32_t)(count - 1 - i) << MATCH_VIEW_TICK_BITS;
+	    client.viewTicks[b] = viewTick == MATCH_NONE || viewTick < back ? MATCH_NONE : viewTick - back;
+	}
+	client.inputs[b] = inputs[i];
+	client.inputFrames[b] = frame;
+	if (client.newestFrame == MATCH_NONE || frame > client.newestFrame) client.newestFrame = frame;
+    }
+}
+
+void MatchServer::handleDisconnect(BitReader& reader, const NetAddress& from) {
+    uint32_t matchId = (uint32_t)reader.Read(32);
+    Match* match;
+    int slot;
+    if (reader.isGood() && findClient(from, matchId, match, slot)) {
+        match->clients[slot].connected = false;
+	return;
+    }
+    auto spectator = spectators.find(address_key(from));
+    if (reader.isGood() && spectator != spectators.end() && spectator->second.matchId == matchId) {
+        dropSpectator(spectator->first);
+	return;
+    }
+    stats.packetsIgnored++;
+}
+
+void MatchServer::handleSpectate(BitReader& reader, const NetAddress& from) {
+    uint32_t nonce = (uint32_t)reader.Read(32);
+    uint32_t matchId = (uint32_t)reader.Read(32);
+    if (!reader.isGood()) {
+        stats.packetsIgnored++;
+	return;
+    }
+
+    uint64_t key = address_key(from);
+    auto it = spectators.find(key);
+    Match* match = nullptr;
+    if (it != spectators.end() && it->second.nonce == nonce) {
+        // Already watching: this is a keepalive, or a repeat because the ACCEPT went missing
+	auto found = matchesById.find(it->second.matchId);
+	if (found != matchesById.end()) match = found->second;
+    } else if (matchId != MATCH_NONE) {
+        auto found = matchesById.find(matchId);
+	if (found != matchesById.end() && !found->second->finished) match = found->second;
+    } else {
+        // The match most people are watching already, or failing that the oldest
+	size_t most = 0;
+	for (auto& m : matches) {
+	    size_t watching = m->audience ? m->audience->size() : 0;
+	    if (!m->finished && (!match || watching > most)) {
+	        match = m.get();
+		most = watching;
+	    }
+	}
+    }
+    if (!match) {
+        sendDisconnect(from, matchId == MATCH_NONE ? 0 : matchId, DISCONNECT_MATCH_OVER);
+	return;
+    }
+
+    if (it == spectators.end() || it->second.nonce != nonce) {
+        if (it == spectators.end() && (int)spectators.size() >= config.maxSpectators) {
+	    sendDisconnect(from, match->id, DISCONNECT_SERVER_FULL);
+	    return;
+	}
+	// Watching something else before
+	if (it != spectators.end()) dropSpectator(key);
+	Spectator& spectator = spectators[key];
+	spectator.address = from;
+	spectator.nonce = nonce;
+	spectator.matchId = match->id;
+	match->audienceChanged = true;
+	match->spectatorKeyframeDue = true;
+    }
+    spectators[key].lastHeard = Clock::now();
+
+    BitWriter writer(reply);
+    write_match_header(writer, MATCH_ACCEPT);
+    writer.Write(nonce, 32);
+    writer.Write(match->id, 32);
+    writer.Write(MATCH_SPECTATOR_SLOT, 8);
+    writer.Write(match->numPlayers, 8);
+    writer.Flush();
+    if (socket.SendTo(from, reply.data(), reply.size())) {
+        stats.packetsOut++;
+	stats.bytesOut += reply.size();
+    }
+}
+
+void MatchServer::dropSpectator(uint64_t key) {
+    auto it = spectators.find(key);
+    if (it == spectators.end()) return;
+    auto match = matchesById.find(it->second.matchId);
+    if (match != matchesById.end()) match->second->audienceChanged = true;
+    spectators.erase(it);
+}
+
+void MatchServer::updateAudiences() {
+    bool anyChanged = false;
+    for (auto& match : matches) anyChanged |= match->audienceChanged;
+    if (!anyChanged) return;
+
+    // Made afresh rather than edited, since the fanout may still be sending to the old ones
+    std::unordered_map<uint32_t, std::vector<NetAddress>> gathered;
+    for (auto& entry : spectators) {
+        auto match = matchesById.find(entry.second.matchId);
+	if (match != matchesById.end() && match->second->audienceChanged) gathered[entry.second.matchId].push_back(entry.second.address);
+    }
+    for (auto& match : matches) {
+        if (!match->audienceChanged) continue;
+	auto it = gathered.find(match->id);
+	if (it == gathered.end()) match->audience = nullptr;
+	else match->audience = std::make_shared<const std::vector<NetAddress>>(std::move(it->second));
+	match->audienceChanged = false;
+    }
+}
+
+void MatchServer::dropTimedOutClients() {
+    auto now = Clock::now();
+    for (auto& match : matches) {
+        for (ServerClient& client : match->clients) {
+	    if (client.connected && std::chrono::duration<double>(now - client.lastHeard).count() > MATCH_TIMEOUT_SECONDS) {
+	        client.connected = false;
+		sendDisconnect(client.address, match->id, DISCONNECT_TIMED_OUT);
+	    }
+	}
+    }
+
+    std::vector<uint64_t> gone;
+    for (auto& entry : spectators) {
+        if (std::chrono::duration<double>(now - entry.second.lastHeard).count() > MATCH_TIMEOUT_SECONDS) gone.push_back(entry.first);
+    }
+    for (uint64_t key : gone) {
+        sendDisconnect(spectators[key].address, spectators[key].matchId, DISCONNECT_TIMED_OUT);
+	dropSpectator(key);
+    }
+}
+
+void MatchServer::sendDisconnect(const NetAddress& to, uint32_t matchId, MatchDisconnectReason reason) {
+    BitWriter writer(reply);
+    write_match_header(writer, MATCH_DISCONNECT);
+    writer.Write(matchId, 32);
+    writer.Write(reason, 8);
+    writer.Flush();
+    if (socket.SendTo(to, reply.data(), reply.size())) {
+        stats.packetsOut++;
+	stats.bytesOut += reply.size();
+    }
+}
+
+Match* MatchServer::startMatch() {
+    if ((int)matches.size() >= config.maxMatches) return nullptr;
+    matches.push_back(std::make_unique<Match>(nextMatchId++, nextSeed++, config));
+    Match* match = matches.back().get();
+    matchesById[match->id] = match;
+    stats.matchesStarted++;
+    assignToWorker(match);
+    return match;
+}
+
+bool MatchServer::AddBotMatch(const std::string& botName) {
+    Match* match = startMatch();
+    if (!match) return false;
+    for (int slot = 0; slot < match->numPlayers; slot++) match->bots[slot] = make_controller(botName, match->id * GC::MAX_PLAYERS + slot);
+    return true;
+}
+
+void MatchServer::assignToWorker(Match* match) {
+    // A new match hasn't got a cost of its own yet, so guess it's like the others
+    if (match->cost == 0) {
+        double total = 0;
+	int n = 0;
+	for (auto& m : matches) {
+	    if (m->cost > 0) {
+	        total += m->cost;
+		n++;
+	    }
+	}
+	match->cost = n ? total / n : 0;
+    }
+
+    int least = 0;
+    for (int i = 1; i < (int)workers.size(); i++) {
+        const Worker& w = *workers[i];
+	const Worker& l = *workers[least];
+        if (w.load < l.load || (w.load == l.load && w.matches.size() < l.matches.size())) least = i;
+    }
+    workers[least]->matches.push_back(match);
+    workers[least]->load += match->cost;
+    match->worker = least;
+}
+
+static int count_connected(const Match& match) {
+    int n = 0;
+    for (const ServerClient& client : match.clients) n += client.connected;
+    return n;
+}
+
+void MatchServer::retireMatches() {
+    bool anyFinished = false;
+    for (auto& match : matches) {
+        // Everyone has left
+        if (!match->bots[0] && count_connected(*match) == 0) match->finished = true;
+        if (!match->finished) continue;
+	anyFinished = true;
+	for (ServerClient& client : match->clients) {
+	    if (client.connected) sendDisconnect(client.address, match->id, DISCONNECT_MATCH_OVER);
+	}
+    }
+    if (!anyFinished) return;
+
+    // Spectators of finished matches are told, and go and find something else to watch
+    std::vector<uint64_t> gone;
+    for (auto& entry : spectators) {
+        auto match = matchesById.find(entry.second.matchId);
+	if (match == matchesById.end() || match->second->finished) gone.push_back(entry.first);
+    }
+    for (uint64_t key : gone) {
+        sendDisconnect(spectators[key].address, spectators[key].matchId, DISCONNECT_MATCH_OVER);
+	spectators.erase(key);
+    }
+
+    for (auto& worker : workers) {
+        auto& list = worker->matches;
+	list.erase(std::remove_if(list.begin(), list.end(), [](Match* m) { return m->finished; }), list.end());
+    }
+    for (auto& match : matches) {
+        if (match->finished) {
+	    matchesById.erase(match->id);
+	    stats.matchesFinished++;
+	}
+    }
+    matches.erase(std::remove_if(matches.begin(), matches.end(), [](const std::unique_ptr<Match>& m) { return m->finished; }), matches.end());
+    rebalance();
+}
+
+void MatchServer::rebalance() {
+    // Loads change as matches get busier, so they're summed afresh
+    for (auto& worker : workers) {
+        worker->load = 0;
+	for (Match* match : worker->matches) worker->load += match->cost;
+    }
+
+    auto byLoad = [](const std::unique_ptr<Worker>& a, const std::unique_ptr<Worker>& b) { return a->load < b->load; };
+    while (true) {
+	Worker& busiest = **std::max_element(workers.begin(), workers.end(), byLoad);
+	int idlestIndex = (int)(std::min_element(workers.begin(), workers.end(), byLoad) - workers.begin());
+	Worker& idlest = *workers[idlestIndex];
+	double gap = busiest.load - idlest.load;
+
+	// Move the biggest match that narrows the gap, if any does. One that costs nothing yet
+	// (it hasn't been timed) wouldn't, and moving it would only spend a migration
+	auto best = busiest.matches.end();
+	for (auto it = busiest.matches.begin(); it != busiest.matches.end(); ++it) {
+	    if ((*it)->cost > 0 && (*it)->cost < gap && (best == busiest.matches.end() || (*it)->cost > (*best)->cost)) best = it;
+	}
+	// Only worth it if the gap is more than that match would make the other way
+	if (best == busiest.matches.end() || gap - 2 * (*best)->cost < 0) break;
+
+	Match* match = *best;
+	busiest.matches.erase(best);
+	busiest.load -= match->cost;
+	idlest.matches.push_back(match);
+	idlest.load += match->cost;
+	match->worker = idlestIndex;
+	stats.migrations++;
+    }
+}
+
+int MatchServer::getNumClients() const {
+    int n = 0;
+    for (auto& match : matches) n += count_connected(*match);
+    return n;
+}
+
+void MatchServer::getWorkerLoads(std::vector<int>& counts, std::vector<double>& costMs) const {
+    counts.clear();
+    costMs.clear();
+    for (auto& worker : workers) {
+        counts.push_back((int)worker->matches.size());
+	double load = 0;
+	for (Match* match : worker->matches) load += match->cost;
+	costMs.push_back(1000 * load);
+    }
+}
+
+void MatchServer::ClearStats() {
+    stats = ServerStats();
+    for (auto& worker : workers) worker->stats = ServerStats();
+}
+
+ServerStats MatchServer::getStats() const {
+    ServerStats total = stats;
+    for (auto& worker : workers) {
+        const ServerStats& w = worker->stats;
+	total.matchTicks.Merge(w.matchTicks);
+	total.packetsOut += w.packetsOut;
+	total.bytesOut += w.bytesOut;
+	total.inputsApplied += w.inputsApplied;
+	total.inputsMissing += w.inputsMissing;
+	total.inputsDropped += w.inputsDropped;
+	total.deltas += w.deltas;
+	total.keyframes += w.keyframes;
+	total.oversized += w.oversized;
+	total.spectatorSnapshots += w.spectatorSnapshots;
+	total.spectatorKeyframes += w.spectatorKeyframes;
+	total.rewoundTests += w.rewoundTests;
+	total.rewoundHits += w.rewoundHits;
+	total.rewindsClamped += w.rewindsClamped;
+	total.rewindQueries.Merge(w.rewindQueries);
+	total.rewinds.Merge(w.rewinds);
+	total.interestSnapshots += w.interestSnapshots;
+	total.interestEntities += w.interestEntities;
+	total.interestUpdates += w.interestUpdates;
+	total.interestDeferred += w.interestDeferred;
+    }
+    return total;
+}
@@ -0,0 +1,272 @@
+#ifndef MATCH_SERVER_H
+#define MATCH_SERVER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "world.h"
+#include "lag_compensation.h"
+#include "interest.h"
+#include "controllers.h"
+#include "snapshot_delta.h"
+#include "udp_socket.h"
+#include "latency_histogram.h"
+#include "spectator_fanout.h"
+#include "match_protocol.h"
+
+struct ServerConfig {
+    uint16_t port = 7777;
+    // Worker threads. 0 makes one per hardware thread
+    int workers = 0;
+    // Pin each worker to its own core where the platform allows it
+    bool pinWorkers = true;
+    int playersPerMatch = 2;
+    GameMode mode = COOP;
+    int maxMatches = 1024;
+    int maxSpectators = 4096;
+    // End a match after this many ticks even if the game isn't over. 0 runs it until it is
+    uint32_t matchTicks = 0;
+    // Test each player's shots against the asteroids as that player saw them
+    bool lagCompensation = true;
+    // Size of each match's arena, which can be bigger than the screen, and asteroids added to
+    // the first level's on top of the usual few
+    int arenaWidth = GC::SCREEN_WIDTH;
+    int arenaHeight = GC::SCREEN_HEIGHT;
+    int extraAsteroids = 0;
+    // Send each client only what's near its ship, within a byte budget, rather than the whole
+    // match (see interest.h)
+    bool interestManagement = true;
+    InterestSettings interest;
+};
+
+// Counters are totals since the server started
+struct ServerStats {
+    // Simulating one match for one tick, and encoding and sending its snapshots
+    LatencyHistogram matchTicks;
+    // A whole scheduling round: taking in packets, ticking every match, retiring finished ones
+    LatencyHistogram rounds;
+    uint64_t matchesStarted = 0;
+    uint64_t matchesFinished = 0;
+    // Matches moved to another worker to even out the load
+    uint64_t migrations = 0;
+    uint64_t packetsIn = 0;
+    uint64_t packetsOut = 0;
+    uint64_t bytesIn = 0;
+    uint64_t bytesOut = 0;
+    // Packets that didn't parse or came from no one we know
+    uint64_t packetsIgnored = 0;
+    // Inputs used on their tick, ticks a client's input hadn't arrived for (its last input
+    // was repeated), and inputs thrown away because they arrived too late or too far ahead
+    uint64_t inputsApplied = 0;
+    uint64_t inputsMissing = 0;
+    uint64_t inputsDropped = 0;
+    // Snapshots sent as deltas against a tick the client had, and against nothing
+    uint64_t deltas = 0;
+    uint64_t keyframes = 0;
+    // Snapshots too big for a packet, which weren't sent
+    uint64_t oversized = 0;
+    // Snapshots built for the spectators of a match, each shared by all of them, and how many of
+    // those were keyframes
+    uint64_t spectatorSnapshots = 0;
+    uint64_t spectatorKeyframes = 0;
+    // Players' bullets tested against the past by lag compensation, and the hits, tests cut
+    // short by the length of the history, and the time each took (see lag_compensation.h)
+    uint64_t rewoundTests = 0;
+    uint64_t rewoundHits = 0;
+    uint64_t rewindsClamped = 0;
+    LatencyHistogram rewindQueries;
+    // How far back players' shots were tested, per tick a player's input was used
+    LatencyHistogram rewinds;
+    // Client snapshots cut down by interest management, the asteroids and bullets they held
+    // between them, the entities sent anew or corrected and the ones left for a later snapshot
+    // by the byte budget
+    uint64_t interestSnapshots = 0;
+    uint64_t interestEntities = 0;
+    uint64_t interestUpdates = 0;
+    uint64_t interestDeferred = 0;
+};
+
+// A client's place in a match, as the server sees it
+struct ServerClient {
+    NetAddress address;
+    uint32_t nonce = 0;
+    bool connected = false;
+    // Inputs by client frame, waiting for the tick they're used on
+    static constexpr int INPUT_BUFFER = 64;
+    PlayerInput inputs[INPUT_BUFFER];
+    uint32_t inputFrames[INPUT_BUFFER];
+    // The tick the client was drawing when it chose each input, in 256ths, and the one for the
+    // input last used
+    uint32_t viewTicks[INPUT_BUFFER];
+    uint32_t viewTick = MATCH_NONE;
+    // The frame whose input the next tick uses, and the newest frame received
+    uint32_t nextFrame = MATCH_NONE;
+    uint32_t newestFrame = MATCH_NONE;
+    uint32_t lastApplied = MATCH_NONE;
+    PlayerInput lastInput;
+    // Newest snapshot tick the client has told us it has
+    uint32_t ackTick = MATCH_NONE;
+    std::chrono::steady_clock::time_point lastHeard;
+    // With interest management, what the client is told about and its own snapshots of the
+    // last MATCH_SNAPSHOT_HISTORY ticks, made on the first snapshot it's sent
+    std::unique_ptr<ClientInterest> interest;
+    std::vector<std::vector<std::byte>> history;
+    std::vector<uint32_t> historyTicks;
+};
+
+// One game, owned by one worker at a time
+struct Match {
+    // Set up as the config says: its players, mode, arena and lag compensation
+    Match(uint32_t id, unsigned int seed, const ServerConfig& config);
+
+    uint32_t id;
+    World world;
+    // Null without lag compensation
+    std::unique_ptr<LagCompensation> lagCompensation;
+    int numPlayers;
+    // Ticks since the match started
+    uint32_t tick = 0;
+    bool finished = false;
+    // Per slot: a remote player, or a server-side bot if the match was made with bots
+    std::vector<ServerClient> clients;
+    std::vector<std::unique_ptr<Controller>> bots;
+
+    // Snapshots of the last MATCH_SNAPSHOT_HISTORY ticks, at [tick % size]. Shared with the
+    // fanout, so one it still holds is replaced rather than written over
+    std::vector<std::shared_ptr<std::vector<std::byte>>> history;
+    std::vector<uint32_t> historyTicks;
+    SnapshotDeltaCodec codec;
+    std::vector<uint8_t> delta;
+    std::vector<uint8_t> packet;
+
+    // Where the spectators' snapshots go. Replaced by the server between rounds when spectators
+    // come and go, and handed to the fanout with each snapshot
+    Audience audience;
+    bool audienceChanged = false;
+    // Someone new is watching, so the next spectator snapshot is a keyframe
+    bool spectatorKeyframeDue = false;
+
+    int worker = -1;
+    // Running average of the seconds a tick takes, for load balancing
+    double cost = 0;
+};
+
+// Hosts many independent matches in one process.
+//
+// Each match belongs to one of a pool of worker threads, pinned to their own cores. Every
+// scheduling round the server takes in all waiting packets on the calling thread, then each
+// worker ticks each of its matches exactly once and sends their snapshots while the calling
+// thread waits. A match stays on its worker, keeping its memory in that core's caches, unless
+// the load has to be evened out: new matches go to the least loaded worker, and when matches
+// finish, matches are moved from the most to the least loaded worker until they're within
+// one match's cost of each other. Load is each match's running average tick time.
+//
+// Clients are matched up as they connect, filling the first match with a free slot or
+// starting a new one. A match ends when its game is over (or after ServerConfig::matchTicks),
+// and its clients are told to connect again for a new one. Each client is sent its own
+// snapshots, holding only what's near its ship (see interest.h), so in a big arena what it
+// costs to send stays the same however many asteroids there are.
+//
+// Any number of spectators can watch a match. Its worker builds one snapshot packet a tick for
+// all of them and hands it to a SpectatorFanout, whose thread does the sending, so a match
+// with a thousand spectators ticks as fast as one with one
+class MatchServer {
+    public:
+	MatchServer(const ServerConfig& config);
+	MatchServer(const MatchServer&) = delete;
+	MatchServer& operator=(const MatchServer&) = delete;
+	~MatchServer();
+
+	// Bind the socket and start the workers. Returns false if the socket can't be opened
+	bool Start();
+	// One scheduling round. Call once a tick
+	void RunRound();
+	// Start a match whose every ship is flown by a server-side bot. Returns false if the
+	// server is full
+	bool AddBotMatch(const std::string& botName);
+
+	int getNumMatches() const { return (int)matches.size(); }
+	int getNumClients() const;
+	int getNumSpectators() const { return (int)spectators.size(); }
+	int getNumWorkers() const { return (int)workers.size(); }
+	uint16_t getPort() const { return socket.getPort(); }
+	// Matches on each worker and their summed cost in milliseconds, for reports
+	void getWorkerLoads(std::vector<int>& counts, std::vector<double>& costMs) const;
+	// Combines every worker's counters. Cheap enough to call once a second, not every round
+	ServerStats getStats() const;
+	// Zero every counter, for reporting a run in stages. Call between rounds
+	void ClearStats();
+	FanoutStats getFanoutStats() const { return fanout.getStats(); }
+    private:
+	struct Worker {
+	    std::thread thread;
+	    std::vector<Match*> matches;
+	    double load = 0;
+	    // Touched only by the worker during a round, read by the server between rounds
+	    ServerStats stats;
+	};
+
+	struct Spectator {
+	    NetAddress address;
+	    uint32_t nonce = 0;
+	    uint32_t matchId = 0;
+	    std::chrono::steady_clock::time_point lastHeard;
+	};
+
+	void workerLoop(int index);
+	void tickMatch(Match& match, Worker& worker);
+	void sendSnapshot(Match& match, int slot, Worker& worker);
+	// Save the snapshot of this tick the client in slot is sent under interest management.
+	// keyframe says it goes against nothing
+	void saveClientSnapshot(Match& match, int slot, bool keyframe, Worker& worker);
+	void sendSpectatorSnapshot(Match& match, Worker& worker);
+	// Set how far back each player's shots are tested this tick, from the tick they were
+	// drawing, and move the lag compensation's stats into the worker's
+	void setRewinds(Match& match, Worker& worker);
+	void takeRewindStats(LagCompensation& lag, Worker& worker);
+	void receivePackets();
+	void handleConnect(BitReader& reader, const NetAddress& from);
+	void handleInput(BitReader& reader, const NetAddress& from);
+	void handleDisconnect(BitReader& reader, const NetAddress& from);
+	void handleSpectate(BitReader& reader, const NetAddress& from);
+	// Hand each match whose spectators changed a new audience
+	void updateAudiences();
+	void dropSpectator(uint64_t key);
+	Match* startMatch();
+	void assignToWorker(Match* match);
+	void retireMatches();
+	void rebalance();
+	void dropTimedOutClients();
+	void sendDisconnect(const NetAddress& to, uint32_t matchId, MatchDisconnectReason reason);
+	// The match and slot of the client at address, or false
+	bool findClient(const NetAddress& address, uint32_t matchId, Match*& match, int& slot);
+
+	ServerConfig config;
+	UdpSocket socket;
+	std::vector<std::unique_ptr<Match>> matches;
+	std::unordered_map<uint32_t, Match*> matchesById;
+	uint32_t nextMatchId = 1;
+	unsigned int nextSeed;
+	std::vector<uint8_t> buffer;
+	std::vector<uint8_t> reply;
+	// Counters kept by the server thread itself
+	ServerStats stats;
+	// By address (see address_key in match_server.cpp)
+	std::unordered_map<uint64_t, Spectator> spectators;
+	SpectatorFanout fanout{socket};
+
+	std::vector<std::unique_ptr<Worker>> workers;
+	std::mutex mutex;
+	std::condition_variable roundStart;
+	std::condition_variable roundDone;
+	uint64_t round = 0;
+	int workersBusy = 0;
+	bool stopping = false;
+};
+
+#endif // MATCH_SERVER_H
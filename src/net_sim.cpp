@@ -0,0 +1,220 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include "net_sim.h"
+
+using Clock = SimulatedLink::Clock;
+
+static Clock::duration from_ms(double ms) {
+    return std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(ms));
+}
+
+const std::vector<LinkProfile>& link_presets() {
+    //                                         latency jitter loss reorder kbit/s queue
+    static const std::vector<LinkProfile> presets = {
+        {"perfect",   0,   0,   0,   0,    0, 200},
+	{"lan",       1, 0.5,   0,   0,    0, 200},
+	{"broadband",20,   3, 0.1,   0,    0, 200},
+	{"wifi",     15,  12,   1, 0.5,    0, 200},
+	{"congested",30,   5, 0.5,   0,  128, 100},
+	{"mobile",   60,  25,   2,   1, 2000, 300},
+	{"bad",     120,  60,   8,   3,  512, 500},
+    };
+    return presets;
+}
+
+static bool parse_number(const std::string& text, double& value) {
+    char* end;
+    value = std::strtod(text.c_str(), &end);
+    return !text.empty() && *end == '\0' && value >= 0;
+}
+
+bool parse_link_profile(const std::string& text, LinkProfile& profile) {
+    LinkProfile result;
+    result.name = text;
+    size_t begin = 0;
+    bool first = true;
+    while (begin <= text.size()) {
+        size_t end = std::min(text.find(',', begin), text.size());
+	std::string item = text.substr(begin, end - begin);
+	begin = end + 1;
+	size_t equals = item.find('=');
+
+	// Only the first item can be a preset to start from
+	if (equals == std::string::npos) {
+	    if (!first) return false;
+	    auto preset = std::find_if(link_presets().begin(), link_presets().end(), [&](const LinkProfile& p) { return p.name == item; });
+	    if (preset == link_presets().end()) return false;
+	    result = *preset;
+	    result.name = text;
+	    first = false;
+	    continue;
+	}
+	first = false;
+
+	std::string key = item.substr(0, equals);
+	double value;
+	if (!parse_number(item.substr(equals + 1), value)) return false;
+	if (key == "latency") result.latencyMs = value;
+	else if (key == "jitter") result.jitterMs = value;
+	else if (key == "loss" && value <= 100) result.lossPercent = value;
+	else if (key == "reorder" && value <= 100) result.reorderPercent = value;
+	else if (key == "bandwidth") result.bandwidthKbps = value;
+	else if (key == "queue") result.queueMs = value;
+	else return false;
+    }
+    profile = result;
+    return true;
+}
+
+std::string describe_link_profile(const LinkProfile& profile) {
+    char text[160];
+    int n = std::snprintf(text, sizeof(text), "%g", profile.latencyMs);
+    if (profile.jitterMs > 0) n += std::snprintf(text + n, sizeof(text) - n, "+%g", profile.jitterMs);
+    n += std::snprintf(text + n, sizeof(text) - n, " ms");
+    if (profile.lossPercent > 0) n += std::snprintf(text + n, sizeof(text) - n, ", %g%% lost", profile.lossPercent);
+    if (profile.reorderPercent > 0) n += std::snprintf(text + n, sizeof(text) - n, ", %g%% reordered", profile.reorderPercent);
+    if (profile.bandwidthKbps > 0) std::snprintf(text + n, sizeof(text) - n, ", %g kbit/s", profile.bandwidthKbps);
+    return text;
+}
+
+const LinkProfile& NetScript::getProfile(double seconds) const {
+    static const LinkProfile perfect = {"perfect"};
+    const LinkProfile* profile = &perfect;
+    for (const Phase& phase : phases) {
+        if (phase.startSeconds > seconds) break;
+	profile = &phase.profile;
+    }
+    return *profile;
+}
+
+bool parse_net_script(const std::string& text, NetScript& script) {
+    NetScript result;
+    size_t begin = 0;
+    while (begin <= text.size()) {
+        size_t end = std::min(text.find('/', begin), text.size());
+	std::string item = text.substr(begin, end - begin);
+	begin = end + 1;
+
+	NetScript::Phase phase;
+	size_t at = item.find('@');
+	if (at != std::string::npos && !parse_number(item.substr(0, at), phase.startSeconds)) return false;
+	if (!parse_link_profile(at == std::string::npos ? item : item.substr(at + 1), phase.profile)) return false;
+	// Phases have to be in order, and the first has to start the run
+	if (result.phases.empty() ? phase.startSeconds != 0 : phase.startSeconds <= result.phases.back().startSeconds) return false;
+	result.phases.push_back(std::move(phase));
+    }
+    script = std::move(result);
+    return true;
+}
+
+void LinkStats::Merge(const LinkStats& other) {
+    packets += other.packets;
+    delivered += other.delivered;
+    bytes += other.bytes;
+    lost += other.lost;
+    queueDrops += other.queueDrops;
+    reordered += other.reordered;
+    delay.Merge(other.delay);
+}
+
+// Soonest first on a std heap, and in the order sent when due at the same time
+static bool due_later(const SimulatedLink::Clock::time_point& a, uint64_t aOrder, const SimulatedLink::Clock::time_point& b, uint64_t bOrder) {
+    return a != b ? a > b : aOrder > bOrder;
+}
+
+SimulatedLink::SimulatedLink(uint64_t seed) : rng(seed) {}
+
+double SimulatedLink::uniform() {
+    return rng() * (1.0 / 4294967296.0);
+}
+
+void SimulatedLink::Send(const LinkProfile& profile, Clock::time_point now, const void* data, size_t size) {
+    stats.packets++;
+    if (profile.lossPercent > 0 && uniform() * 100 < profile.lossPercent) {
+        stats.lost++;
+	return;
+    }
+
+    // Wait for the packets ahead to finish going out, then take as long as the bandwidth allows
+    Clock::time_point leaves = now;
+    if (profile.bandwidthKbps > 0) {
+        Clock::time_point starts = std::max(now, linkFree);
+	if (starts - now > from_ms(profile.queueMs)) {
+	    stats.queueDrops++;
+	    return;
+	}
+	leaves = starts + from_ms(size * 8 / profile.bandwidthKbps);
+	linkFree = leaves;
+    }
+
+    Clock::time_point due = leaves + from_ms(profile.latencyMs + uniform() * profile.jitterMs);
+    if (profile.reorderPercent > 0 && uniform() * 100 < profile.reorderPercent) {
+        // Held back without holding anything else back
+	due += from_ms(REORDER_DELAY_MS);
+	stats.reordered++;
+    } else {
+        // Jitter alone doesn't reorder packets, it bunches them up
+	due = std::max(due, lastDue);
+	lastDue = due;
+    }
+
+    Held h;
+    h.due = due;
+    h.sent = now;
+    h.order = sent++;
+    if (!spare.empty()) {
+        h.data = std::move(spare.back());
+	spare.pop_back();
+    }
+    h.data.assign((const uint8_t*)data, (const uint8_t*)data + size);
+    held.push_back(std::move(h));
+    std::push_heap(held.begin(), held.end(), [](const Held& a, const Held& b) { return due_later(a.due, a.order, b.due, b.order); });
+}
+
+bool SimulatedLink::Receive(Clock::time_point now, std::vector<uint8_t>& packet) {
+    if (held.empty() || held.front().due > now) return false;
+    std::pop_heap(held.begin(), held.end(), [](const Held& a, const Held& b) { return due_later(a.due, a.order, b.due, b.order); });
+    Held& h = held.back();
+    packet.assign(h.data.begin(), h.data.end());
+    stats.delivered++;
+    stats.bytes += h.data.size();
+    stats.delay.Record(std::chrono::duration<double>(now - h.sent).count());
+    spare.push_back(std::move(h.data));
+    held.pop_back();
+    return true;
+}
+
+NetSimRelay::NetSimRelay(const NetScript& s, uint64_t seed) : script(s), up(seed), down(seed + 1) {}
+
+bool NetSimRelay::Open(const NetAddress& to) {
+    far = to;
+    haveNear = false;
+    start = Clock::now();
+    buffer.resize(65536);
+    return nearSide.Open(0) && farSide.Open(0);
+}
+
+const LinkProfile& NetSimRelay::getProfile() const {
+    return script.getProfile(std::chrono::duration<double>(Clock::now() - start).count());
+}
+
+void NetSimRelay::Pump() {
+    auto now = Clock::now();
+    const LinkProfile& profile = script.getProfile(std::chrono::duration<double>(now - start).count());
+    NetAddress from;
+    int size;
+    while ((size = nearSide.Receive(buffer.data(), buffer.size(), from)) >= 0) {
+        near = from;
+	haveNear = true;
+	up.Send(profile, now, buffer.data(), size);
+    }
+    while ((size = farSide.Receive(buffer.data(), buffer.size(), from)) >= 0) {
+        if (from == far) down.Send(profile, now, buffer.data(), size);
+    }
+
+    while (up.Receive(now, packet)) farSide.SendTo(far, packet.data(), packet.size());
+    while (down.Receive(now, packet)) {
+        if (haveNear) nearSide.SendTo(near, packet.data(), packet.size());
+    }
+}
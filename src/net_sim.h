@@ -0,0 +1,149 @@
+#ifndef NET_SIM_H
+#define NET_SIM_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "udp_socket.h"
+#include "latency_histogram.h"
+#include "rng.h"
+
+// What a simulated network does to the packets crossing it, the same each way
+struct LinkProfile {
+    std::string name;
+    // Added to every packet one way, and the most a packet is randomly held on top of that
+    double latencyMs = 0;
+    double jitterMs = 0;
+    // Chance in percent a packet is lost, or held back long enough for later ones to overtake it
+    double lossPercent = 0;
+    double reorderPercent = 0;
+    // Kilobits per second each way, or 0 for no limit. A packet that would have to queue for
+    // longer than queueMs behind the ones before it is dropped
+    double bandwidthKbps = 0;
+    double queueMs = 200;
+};
+
+// The named profiles, best network first
+const std::vector<LinkProfile>& link_presets();
+// A preset's name, a list of changes to a perfect network like "latency=40,jitter=5,loss=1",
+// or a preset with changes like "mobile,loss=5". The keys are latency, jitter, loss, reorder,
+// bandwidth and queue, in the units above. Returns false if it isn't one
+bool parse_link_profile(const std::string& text, LinkProfile& profile);
+// "40+5 ms, 1% lost, 256 kbit/s" and so on
+std::string describe_link_profile(const LinkProfile& profile);
+
+// Profiles that take over from one another as a run goes on
+struct NetScript {
+    struct Phase {
+        double startSeconds = 0;
+	LinkProfile profile;
+    };
+    // In order of start time. The first starts at 0
+    std::vector<Phase> phases;
+
+    // The profile in force seconds into the run
+    const LinkProfile& getProfile(double seconds) const;
+};
+
+// A single profile, or phases separated by '/' each starting at SECONDS@, like
+// "lan/10@mobile/20@latency=200,loss=10". Returns false if it isn't one
+bool parse_net_script(const std::string& text, NetScript& script);
+
+struct LinkStats {
+    // Packets sent into the link, and the ones that came out and their size
+    uint64_t packets = 0;
+    uint64_t delivered = 0;
+    uint64_t bytes = 0;
+    // Packets lost at random, dropped because the bandwidth queue was full, and held back
+    uint64_t lost = 0;
+    uint64_t queueDrops = 0;
+    uint64_t reordered = 0;
+    // How long the packets delivered were held
+    LatencyHistogram delay;
+
+    void Merge(const LinkStats& other);
+};
+
+// One direction of a simulated network. Packets go in with Send and come out of Receive once
+// they're due, which is in the order they went in except for the ones picked to be reordered.
+// Random choices come from a generator of its own, so a run with the same seed and the same
+// traffic loses and reorders the same packets
+class SimulatedLink {
+    public:
+	using Clock = std::chrono::steady_clock;
+
+	SimulatedLink(uint64_t seed = 1);
+
+	void Send(const LinkProfile& profile, Clock::time_point now, const void* data, size_t size);
+	// Copy out the packet due soonest if it's due by now. Returns false if none is
+	bool Receive(Clock::time_point now, std::vector<uint8_t>& packet);
+	size_t getHeld() const { return held.size(); }
+	const LinkStats& getStats() const { return stats; }
+
+	// How much longer a reordered packet is held than it would have been
+	static constexpr double REORDER_DELAY_MS = 20;
+    private:
+	struct Held {
+	    Clock::time_point due;
+	    Clock::time_point sent;
+	    uint64_t order;
+	    std::vector<uint8_t> data;
+	};
+
+	double uniform();
+
+	Pcg32 rng;
+	// A heap on due time, soonest first
+	std::vector<Held> held;
+	// Buffers of packets already delivered, to reuse
+	std::vector<std::vector<uint8_t>> spare;
+	uint64_t sent = 0;
+	// When the last packet that keeps its place is due, and when the link is free to start
+	// sending another
+	Clock::time_point lastDue;
+	Clock::time_point linkFree;
+	LinkStats stats;
+};
+
+// Puts a simulated network between two UDP endpoints on this machine, such as a client and a
+// server, without either of them knowing. The near end sends to getPort() instead of to the
+// far end, and the far end sees the packets come from getFarSidePort() and answers there.
+// Everything crossing goes through a SimulatedLink each way, with the profile the script has
+// in force. The script's clock starts when the relay is opened
+class NetSimRelay {
+    public:
+	NetSimRelay(const NetScript& script, uint64_t seed = 1);
+	NetSimRelay(const NetSimRelay&) = delete;
+	NetSimRelay& operator=(const NetSimRelay&) = delete;
+
+	// Open both sockets on free ports, to relay to far. Returns false if they can't be
+	bool Open(const NetAddress& far);
+	uint16_t getPort() const { return nearSide.getPort(); }
+	uint16_t getFarSidePort() const { return farSide.getPort(); }
+
+	// Move everything waiting on either socket into the links, and send on everything due.
+	// Call it often, every quarter of a millisecond or so: packets can't come out more
+	// precisely than that
+	void Pump();
+	const LinkProfile& getProfile() const;
+	// Near to far, and far to near
+	const LinkStats& getUpStats() const { return up.getStats(); }
+	const LinkStats& getDownStats() const { return down.getStats(); }
+    private:
+	NetScript script;
+	UdpSocket nearSide;
+	UdpSocket farSide;
+	NetAddress far;
+	// Where the near end last sent from, and so where answers go
+	NetAddress near;
+	bool haveNear = false;
+	SimulatedLink up;
+	SimulatedLink down;
+	SimulatedLink::Clock::time_point start;
+	std::vector<uint8_t> buffer;
+	std::vector<uint8_t> packet;
+};
+
+#endif // NET_SIM_H
@@ -0,0 +1,181 @@
+#include <algorithm>
+#include "netplay.h"
+#include "rollback.h"
+#include "latency_histogram.h"
+
+static constexpr uint32_t PACKET_MAGIC = 0x54454e41; // "ANET"
+static constexpr size_t MAX_PACKET_BYTES = 1200;
+
+enum PacketType {
+    PACKET_HELLO = 1,
+    PACKET_INPUT = 2
+};
+
+bool NetplayPeer::Open(const NetplaySettings& s) {
+    settings = s;
+    buffer.resize(MAX_PACKET_BYTES);
+    heard = false;
+    connected = false;
+    acked = 0;
+    lastHeard = std::chrono::steady_clock::now();
+    return socket.Open(settings.port);
+}
+
+void NetplayPeer::send() {
+    if (socket.SendTo(settings.peer, packet.data(), packet.size())) {
+        stats.packetsSent++;
+	stats.bytesSent += packet.size();
+    }
+}
+
+void NetplayPeer::sendHello() {
+    BitWriter writer(packet);
+    writer.Write(PACKET_MAGIC, 32);
+    writer.Write(PACKET_HELLO, 8);
+    writer.Write(settings.slot, 8);
+    writer.WriteBit(heard);
+    writer.Write(settings.seed, 32);
+    writer.Write(settings.mode, 8);
+    writer.Write(settings.inputDelay, 8);
+    writer.Write(settings.maxRollback, 8);
+    writer.Flush();
+    send();
+}
+
+bool NetplayPeer::readHello(BitReader& reader) {
+    bool peerHeard = reader.ReadBit();
+    unsigned int seed = (unsigned int)reader.Read(32);
+    int mode = (int)reader.Read(8);
+    int inputDelay = (int)reader.Read(8);
+    int maxRollback = (int)reader.Read(8);
+    if (!reader.isGood() || (mode != COOP && mode != VERSUS)) return false;
+
+    // The guest plays whatever game the host has set up
+    if (settings.slot != 0) {
+        settings.seed = seed;
+	settings.mode = (GameMode)mode;
+	settings.inputDelay = inputDelay;
+	settings.maxRollback = maxRollback;
+    }
+    heard = true;
+    if (peerHeard) connected = true;
+    return true;
+}
+
+// Check the packet is from the peer and starts with our header. Returns its type, or -1
+static int read_header(BitReader& reader, const NetAddress& from, const NetplaySettings& settings) {
+    if (from != settings.peer) return -1;
+    if (reader.Read(32) != PACKET_MAGIC) return -1;
+    int type = (int)reader.Read(8);
+    int slot = (int)reader.Read(8);
+    // Two players, so the peer has to be in the other slot
+    if (!reader.isGood() || slot == settings.slot || slot > 1) return -1;
+    return type;
+}
+
+bool NetplayPeer::Handshake() {
+    NetAddress from;
+    int size;
+    while ((size = socket.Receive(buffer.data(), buffer.size(), from)) >= 0) {
+        BitReader reader(buffer.data(), size);
+	if (read_header(reader, from, settings) != PACKET_HELLO || !readHello(reader)) {
+	    stats.packetsIgnored++;
+	    continue;
+	}
+	stats.packetsReceived++;
+	stats.bytesReceived += size;
+	lastHeard = std::chrono::steady_clock::now();
+    }
+    sendHello();
+    return connected;
+}
+
+void NetplayPeer::Receive(RollbackSession& session) {
+    int peerSlot = 1 - settings.slot;
+    NetAddress from;
+    int size;
+    while ((size = socket.Receive(buffer.data(), buffer.size(), from)) >= 0) {
+        BitReader reader(buffer.data(), size);
+	int type = read_header(reader, from, settings);
+	bool good = false;
+
+	if (type == PACKET_HELLO) {
+	    // Our last HELLO went missing, so the peer is still waiting to hear that we've heard it
+	    good = readHello(reader);
+	    if (good) sendHello();
+	} else if (type == PACKET_INPUT) {
+	    uint32_t ack = (uint32_t)reader.Read(32);
+	    uint32_t frame = (uint32_t)reader.Read(32);
+	    uint32_t first = (uint32_t)reader.Read(32);
+	    int count = (int)reader.Read(8);
+	    PlayerInput inputs[MAX_INPUTS_PER_PACKET];
+	    for (int i = 0; i < count && i < MAX_INPUTS_PER_PACKET; i++) inputs[i] = unpack_input((uint32_t)reader.Read(4));
+	    bool hasChecksum = reader.ReadBit();
+	    uint32_t checksumFrame = hasChecksum ? (uint32_t)reader.Read(32) : 0;
+	    uint64_t checksum = hasChecksum ? reader.Read(64) : 0;
+
+	    good = reader.isGood() && count <= MAX_INPUTS_PER_PACKET;
+	    if (good) {
+	        acked = std::max(acked, ack);
+		remoteFrame = std::max(remoteFrame, frame);
+		for (int i = 0; i < count; i++) session.AddRemoteInput(peerSlot, first + i, inputs[i]);
+		if (hasChecksum && (remoteChecksumFrame == UINT32_MAX || checksumFrame > remoteChecksumFrame)) {
+		    remoteChecksumFrame = checksumFrame;
+		    remoteChecksum = checksum;
+		    session.CheckChecksum(checksumFrame, checksum);
+		}
+	    }
+	}
+
+	if (!good) {
+	    stats.packetsIgnored++;
+	    continue;
+	}
+	stats.packetsReceived++;
+	stats.bytesReceived += size;
+	lastHeard = std::chrono::steady_clock::now();
+    }
+}
+
+void NetplayPeer::SendInputs(const RollbackSession& session) {
+    int localSlot = settings.slot;
+    uint32_t last = session.getConfirmedCount(localSlot);
+    uint32_t first = std::min(acked, last);
+    int count = (int)std::min<uint32_t>(last - first, MAX_INPUTS_PER_PACKET);
+
+    BitWriter writer(packet);
+    writer.Write(PACKET_MAGIC, 32);
+    writer.Write(PACKET_INPUT, 8);
+    writer.Write(localSlot, 8);
+    writer.Write(session.getConfirmedCount(1 - localSlot), 32);
+    writer.Write(session.getFrame(), 32);
+    writer.Write(first, 32);
+    writer.Write(count, 8);
+    for (int i = 0; i < count; i++) writer.Write(pack_input(session.getInput(localSlot, first + i)), 4);
+
+    uint32_t checksumFrame;
+    uint64_t checksum;
+    bool hasChecksum = session.getLatestChecksum(checksumFrame, checksum);
+    writer.WriteBit(hasChecksum);
+    if (hasChecksum) {
+        writer.Write(checksumFrame, 32);
+	writer.Write(checksum, 64);
+    }
+    writer.Flush();
+    send();
+}
+
+bool NetplayPeer::isTimedOut(double seconds) const {
+    return seconds_since(lastHeard) > seconds;
+}
+
+int NetplayPeer::getFrameAdvantage(const RollbackSession& session) const {
+    return (int)session.getFrame() - (int)remoteFrame;
+}
+
+bool NetplayPeer::getRemoteChecksum(uint32_t& checksumFrame, uint64_t& checksum) const {
+    if (remoteChecksumFrame == UINT32_MAX) return false;
+    checksumFrame = remoteChecksumFrame;
+    checksum = remoteChecksum;
+    return true;
+}
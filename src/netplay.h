@@ -0,0 +1,92 @@
+#ifndef NETPLAY_H
+#define NETPLAY_H
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include "bit_stream.h"
+#include "udp_socket.h"
+#include "game_constants.h"
+#include "world.h"
+
+class RollbackSession;
+
+// How a two-player netplay game is set up. The host (slot 0) decides the seed, mode, input
+// delay and rollback window; the guest (slot 1) takes on whatever the host sends
+struct NetplaySettings {
+    int slot = 0;
+    uint16_t port = 0;
+    NetAddress peer;
+    unsigned int seed = 0;
+    GameMode mode = COOP;
+    int inputDelay = GC::NETPLAY_INPUT_DELAY;
+    int maxRollback = GC::ROLLBACK_FRAMES;
+};
+
+struct NetplayStats {
+    uint64_t packetsSent = 0;
+    uint64_t packetsReceived = 0;
+    uint64_t bytesSent = 0;
+    uint64_t bytesReceived = 0;
+    // Packets that weren't from the peer or didn't parse
+    uint64_t packetsIgnored = 0;
+};
+
+// One end of a two-player rollback game over UDP.
+//
+// Both ends send HELLO until each has heard the other say it has heard them; the host's HELLO
+// carries the game settings. After that each end sends an INPUT packet every frame holding
+// every local input the other hasn't acknowledged yet, so lost packets are made up for by the
+// next one and nothing is ever resent on a timer. INPUT packets also carry the sender's
+// frame, so each end can tell if it's running ahead, and its latest checksum, so desyncs are
+// caught. Packets are bit-packed: an input is 4 bits
+class NetplayPeer {
+    public:
+	// Bind the socket. Returns false if it can't be
+	bool Open(const NetplaySettings& settings);
+	// Send and receive HELLOs. Call once a frame until it returns true, then start the
+	// session with getSettings()
+	bool Handshake();
+	// Hand every input and checksum that has arrived to the session
+	void Receive(RollbackSession& session);
+	// Send the peer the local inputs it hasn't acknowledged
+	void SendInputs(const RollbackSession& session);
+
+	// Nothing heard from the peer for this long
+	bool isTimedOut(double seconds = TIMEOUT_SECONDS) const;
+	// How many frames ahead of the peer we are, going by the last frame it told us about
+	int getFrameAdvantage(const RollbackSession& session) const;
+	// The last frame the peer told us it had reached
+	uint32_t getRemoteFrame() const { return remoteFrame; }
+	// The latest checksum the peer sent us. Returns false if it hasn't sent one
+	bool getRemoteChecksum(uint32_t& checksumFrame, uint64_t& checksum) const;
+
+	const NetplaySettings& getSettings() const { return settings; }
+	const NetplayStats& getStats() const { return stats; }
+
+	static constexpr double TIMEOUT_SECONDS = 3.0;
+	// Most inputs one packet holds. A peer further behind than this catches up a packet at a time
+	static constexpr int MAX_INPUTS_PER_PACKET = 64;
+    private:
+	void sendHello();
+	void send();
+	// Take in a HELLO. Returns false if it doesn't parse
+	bool readHello(BitReader& reader);
+
+	UdpSocket socket;
+	NetplaySettings settings;
+	std::vector<uint8_t> packet;
+	std::vector<uint8_t> buffer;
+	// We've had a HELLO from the peer, and one saying it has had ours
+	bool heard = false;
+	bool connected = false;
+	// Local inputs the peer has confirmed it has, from frame 0
+	uint32_t acked = 0;
+	uint32_t remoteFrame = 0;
+	uint32_t remoteChecksumFrame = UINT32_MAX;
+	uint64_t remoteChecksum = 0;
+	std::chrono::steady_clock::time_point lastHeard = std::chrono::steady_clock::now();
+	NetplayStats stats;
+};
+
+#endif // NETPLAY_H
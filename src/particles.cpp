@@ -0,0 +1,111 @@
+#include <raylib-cpp.hpp>
+#include <cmath>
+#include <cstring>
+#include "particles.h"
+#include "game_constants.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define PARTICLES_SSE2
+#endif
+
+// Number of particles processed per iteration of the integration kernel. Columns are
+// padded to a multiple of this so the kernel never needs a scalar tail
+static constexpr int laneWidth = 4;
+static constexpr int numColumns = 7;
+
+ParticleSystem::ParticleSystem(int cap) {
+    capacity = (cap + laneWidth - 1) / laneWidth * laneWidth;
+    storage = std::make_unique<float[]>((size_t)capacity * numColumns);
+    std::memset(storage.get(), 0, sizeof(float) * capacity * numColumns);
+
+    posX = storage.get();
+    posY = posX + capacity;
+    velocX = posY + capacity;
+    velocY = velocX + capacity;
+    life = velocY + capacity;
+    fade = life + capacity;
+    static_assert(sizeof(uint32_t) == sizeof(float), "colours share the float storage block");
+    colours = reinterpret_cast<uint32_t*>(fade + capacity);
+}
+
+float ParticleSystem::randomUnit() {
+    // xorshift32. Particles are purely cosmetic so they keep their own generator
+    // rather than consuming numbers from the game's
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return (seed >> 8) * (1.0f / 16777216.0f);
+}
+
+void ParticleSystem::Emit(Vector2 pos, Vector2 baseVeloc, int n, float spread, int lifeFrames, Color col) {
+    if (n > capacity - count) n = capacity - count;
+
+    uint32_t packed = (uint32_t)col.r | ((uint32_t)col.g << 8) | ((uint32_t)col.b << 16);
+
+    for (int i = 0; i < n; i++) {
+        float angle = randomUnit() * 2 * GC::pi;
+        float speed = spread * (0.2f + 0.8f * randomUnit());
+        // Vary the lifetime by up to 50% so a burst doesn't disappear all at once
+        float lifetime = lifeFrames * (0.5f + 0.5f * randomUnit()) + 1;
+
+        posX[count] = pos.x;
+        posY[count] = pos.y;
+        velocX[count] = baseVeloc.x + speed * std::cos(angle);
+        velocY[count] = baseVeloc.y + speed * std::sin(angle);
+        life[count] = lifetime;
+        fade[count] = 1.0f / lifetime;
+        colours[count] = packed;
+        count++;
+    }
+}
+
+void ParticleSystem::Update() {
+    // Round up to whole lanes. The padding past count holds dead or unused slots, which
+    // is harmless to integrate
+    int n = (count + laneWidth - 1) / laneWidth * laneWidth;
+
+#ifdef PARTICLES_SSE2
+    const __m128 drag = _mm_set1_ps(GC::PARTICLE_DRAG);
+    const __m128 one = _mm_set1_ps(1.0f);
+    for (int i = 0; i < n; i += laneWidth) {
+        __m128 vx = _mm_loadu_ps(velocX + i);
+        __m128 vy = _mm_loadu_ps(velocY + i);
+        _mm_storeu_ps(posX + i, _mm_add_ps(_mm_loadu_ps(posX + i), vx));
+        _mm_storeu_ps(posY + i, _mm_add_ps(_mm_loadu_ps(posY + i), vy));
+        _mm_storeu_ps(velocX + i, _mm_mul_ps(vx, drag));
+        _mm_storeu_ps(velocY + i, _mm_mul_ps(vy, drag));
+        _mm_storeu_ps(life + i, _mm_sub_ps(_mm_loadu_ps(life + i), one));
+    }
+#else
+    for (int i = 0; i < n; i++) {
+        posX[i] += velocX[i];
+        posY[i] += velocY[i];
+        velocX[i] *= GC::PARTICLE_DRAG;
+        velocY[i] *= GC::PARTICLE_DRAG;
+        life[i] -= 1.0f;
+    }
+#endif
+
+    // Swap-and-pop expired particles so the live ones stay contiguous
+    int i = 0;
+    while (i < count) {
+        if (life[i] > 0) {
+            i++;
+            continue;
+        }
+        count--;
+        posX[i] = posX[count];
+        posY[i] = posY[count];
+        velocX[i] = velocX[count];
+        velocY[i] = velocY[count];
+        life[i] = life[count];
+        fade[i] = fade[count];
+        colours[i] = colours[count];
+    }
+}
+
+void ParticleSystem::Clear() { count = 0; }
+
+int ParticleSystem::getCount() const { return count; }
+int ParticleSystem::getCapacity() const { return capacity; }
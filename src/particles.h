@@ -0,0 +1,44 @@
+#ifndef PARTICLES_H
+#define PARTICLES_H
+
+#include <raylib-cpp.hpp>
+#include <cstdint>
+#include <memory>
+
+// Fixed-capacity pool of short-lived visual particles (asteroid explosions, ship thruster).
+// Particles are stored as a structure of arrays so the integration kernel can process
+// several particles per instruction. Dead particles are removed with swap-and-pop, so
+// live particles are always packed into [0, count). Nothing is allocated after construction
+class ParticleSystem {
+    public:
+	ParticleSystem(int cap);
+
+	// Spawn up to n particles at pos moving with baseVeloc plus a random direction
+	// with speed up to spread. Particles that don't fit in the pool are dropped
+	void Emit(Vector2 pos, Vector2 baseVeloc, int n, float spread, int lifeFrames, Color col);
+	void Update();
+	// Submit all live particles as one batch of line segments
+	void Draw() const;
+	void Clear();
+
+	int getCount() const;
+	int getCapacity() const;
+    private:
+	float randomUnit();
+
+	int capacity;
+	int count = 0;
+	uint32_t seed = 0x9e3779b9u;
+
+	// Single block backing all of the columns below
+	std::unique_ptr<float[]> storage;
+	float* posX;
+	float* posY;
+	float* velocX;
+	float* velocY;
+	float* life; // frames left to live
+	float* fade; // 1 / lifetime, used to fade the particle out
+	uint32_t* colours; // packed RGB
+};
+
+#endif // PARTICLES_H
@@ -1,49 +1,80 @@
 #include <raylib-cpp.hpp>
-#include "asteroid.h"
+#include <cmath>
 #include "player.h"
 #include "game_constants.h"
 
-Player::Player() {
+Player::Player() : Player({GC::SCREEN_WIDTH/2, GC::SCREEN_HEIGHT/2}) {}
+
+Player::Player(Vector2 centre) {
 	
     // Main line down the middle of the ship
-    Vector2 point0 = {GC::SCREEN_WIDTH/2, GC::SCREEN_HEIGHT/2 - length/2};
-    Vector2 point1 = {GC::SCREEN_WIDTH/2, GC::SCREEN_HEIGHT/2 + length/2};
+    Vector2 point0 = {centre.x, centre.y - length/2};
+    Vector2 point1 = {centre.x, centre.y + length/2};
 
     // Perpendicular bar at the back of the ship
-    Vector2 point2 = {GC::SCREEN_WIDTH/2 - width/2, GC::SCREEN_HEIGHT/2 + length/2};
-    Vector2 point3 = {GC::SCREEN_WIDTH/2 + width/2, GC::SCREEN_HEIGHT/2 + length/2};
+    Vector2 point2 = {centre.x - width/2, centre.y + length/2};
+    Vector2 point3 = {centre.x + width/2, centre.y + length/2};
 
     // Side panels
     Vector2 point4 = point0;
-    Vector2 point5 = {GC::SCREEN_WIDTH/2 - width/2 - (width * 0.1), GC::SCREEN_HEIGHT/2 + length/2 + (length * 0.1)};
+    Vector2 point5 = {centre.x - width/2 - (width * 0.1), centre.y + length/2 + (length * 0.1)};
     Vector2 point6 = point0;
-    Vector2 point7 = {GC::SCREEN_WIDTH/2 + width/2 + (width * 0.1), GC::SCREEN_HEIGHT/2 + length/2 + (length * 0.1)};
+    Vector2 point7 = {centre.x + width/2 + (width * 0.1), centre.y + length/2 + (length * 0.1)};
     
     // Thruster
-    Vector2 point8 = {GC::SCREEN_WIDTH/2 - width/4, GC::SCREEN_HEIGHT/2 + length/2};
-    Vector2 point9 = {GC::SCREEN_WIDTH/2 + width/4, GC::SCREEN_HEIGHT/2 + length/2};
-    Vector2 point10 = {GC::SCREEN_WIDTH/2, GC::SCREEN_HEIGHT/2 + 3*length/4};
+    Vector2 point8 = {centre.x - width/4, centre.y + length/2};
+    Vector2 point9 = {centre.x + width/4, centre.y + length/2};
+    Vector2 point10 = {centre.x, centre.y + 3*length/4};
 
     points = {point0, point1, point2, point3, point4, point5, point6, point7, point8, point9, point10};
 
     // Take the centre of rotation as the centre of the line running down the centre of the ship
     midpoint = {(point0.x + point1.x)/2 - (point0.x - point1.x)/4, (point0.y + point1.y)/2 - (point0.y - point1.y) / 4}; // Shift back to 1/4 along midline
 
+    // Direction of travel before the first update
+    deltaXShip = point0.x - point1.x;
+    deltaYShip = point0.y - point1.y;
 }
 
-bool Player::CollidedWithAsteroid(Asteroid& asteroid) {
+bool Player::CollidedWithAsteroid(Position asteroidPosition, int asteroidRadius) const {
 	     
     for (const auto& point : points) {
         // Calculate distance from point to midpoint of asteroid
-	float distance = std::sqrt(std::pow((point.x - asteroid.getPosition().x), 2) + std::pow((point.y - asteroid.getPosition().y), 2));
-	    if (distance <= asteroid.getRadius()) return true;
+	float distance = std::sqrt(std::pow((point.x - asteroidPosition.x), 2) + std::pow((point.y - asteroidPosition.y), 2));
+	    if (distance <= asteroidRadius) return true;
 	}
             return false;
 	}
+
+bool Player::HitByBullet(Position bulletPosition) const {
+    // Inside the triangle made by the nose and the two back corners of the side panels. The
+    // point is on the same side of each edge as the triangle's other corner
+    const Vector2& a = points[0];
+    const Vector2& b = points[5];
+    const Vector2& c = points[7];
+    auto side = [&](const Vector2& from, const Vector2& to) {
+        return (to.x - from.x) * (bulletPosition.y - from.y) - (to.y - from.y) * (bulletPosition.x - from.x);
+    };
+    float ab = side(a, b);
+    float bc = side(b, c);
+    float ca = side(c, a);
+    return (ab >= 0 && bc >= 0 && ca >= 0) || (ab <= 0 && bc <= 0 && ca <= 0);
+}
+
+bool Player::TryFire(int framesPerSpawn) {
+    if (bulletFramesUntilNextSpawn > 0) return false;
+    bulletFramesUntilNextSpawn = framesPerSpawn;
+    return true;
+}
         
-void Player::Draw() {
+void Player::Update(const PlayerInput& input, float arenaWidth, float arenaHeight) {
+    // Decrement the frame count between bullet spawning
+    if (bulletFramesUntilNextSpawn > 0) bulletFramesUntilNextSpawn--;
+
+    thrusting = input.thrust;
+
     // Update variables
-    if (IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_LEFT)) {
+    if (input.right || input.left) {
         // Rotate player by chosen number of radians
 	// Translate points so that midpoint is at origin
 	Vector2 pointsOrigin[numPoints];
@@ -57,7 +88,7 @@ void Player::Draw() {
 
 	Vector2 pointsOriginRot[numPoints];
 	// Rotate points using appropriate rotation matrix relative to the origin
-	if (IsKeyDown(KEY_RIGHT)) {
+	if (input.right) {
 	    // Clockwise rotation
 	    for (int i = 0; i < numPoints; i++) {
 	        pointsOriginRot[i] = {cos(theta)*pointsOrigin[i].x -sin(theta)*pointsOrigin[i].y, sin(theta)*pointsOrigin[i].x + cos(theta)*pointsOrigin[i].y};
@@ -81,28 +112,28 @@ void Player::Draw() {
 	    
     // To avoid extra computations, just loop back if midpoint is at least the ship's length off the screen
     // TODO: Avoid repetition here
-    if (midpoint.x > GC::SCREEN_WIDTH + length) {
+    if (midpoint.x > arenaWidth + length) {
         for (int i = 0; i < numPoints; i++) {
-	    points[i].x -= GC::SCREEN_WIDTH + length*2;
+	    points[i].x -= arenaWidth + length*2;
 	}
     } else if (midpoint.x < -length) {
         for (int i = 0; i < numPoints; i++) {
-	    points[i].x += GC::SCREEN_WIDTH + length*2;
+	    points[i].x += arenaWidth + length*2;
 	}
     }
 
-    if (midpoint.y > GC::SCREEN_HEIGHT + length) {
+    if (midpoint.y > arenaHeight + length) {
 	for (int i = 0; i < numPoints; i++) {
-	    points[i].y -= GC::SCREEN_HEIGHT + length*2;
+	    points[i].y -= arenaHeight + length*2;
 	}
     } else if (midpoint.y < -length) {
 	for (int i = 0; i < numPoints; i++) {
-	    points[i].y += GC::SCREEN_HEIGHT + length*2;
+	    points[i].y += arenaHeight + length*2;
         }
     }
 
     // Move ship forwards
-    if (IsKeyDown(KEY_UP)) {
+    if (input.thrust) {
                 
 	float accelByShipLength = accel / length;
 
@@ -141,18 +172,34 @@ void Player::Draw() {
     // Decay the speed
     velocX *= dragCoeff;
     velocY *= dragCoeff;	
+}
 
-    DrawTriangle(points[10], points[9], points[8], IsKeyDown(KEY_UP) ? ORANGE : BLACK);
-    DrawLine(points[0].x, points[0].y, points[1].x, points[1].y, BLACK);
-    DrawLine(points[2].x, points[2].y, points[3].x, points[3].y, WHITE);
-    DrawLine(points[4].x, points[4].y, points[5].x, points[5].y, WHITE);
-    DrawLine(points[6].x, points[6].y, points[7].x, points[7].y, WHITE);
+void Player::Blend(const Player& other, float t) {
+    for (int i = 0; i < numPoints; i++) {
+        points[i].x += (other.points[i].x - points[i].x) * t;
+	points[i].y += (other.points[i].y - points[i].y) * t;
+    }
+    midpoint.x += (other.midpoint.x - midpoint.x) * t;
+    midpoint.y += (other.midpoint.y - midpoint.y) * t;
+    if (t >= 0.5f) thrusting = other.thrusting;
+}
+
+void Player::Offset(Vector2 offset) {
+    for (int i = 0; i < numPoints; i++) {
+        points[i].x += offset.x;
+	points[i].y += offset.y;
+    }
+    midpoint.x += offset.x;
+    midpoint.y += offset.y;
 }
 
 // Getters and setters
 
-float Player::getDeltaXShip() { return deltaXShip; };
-float Player::getDeltaYShip() { return deltaYShip; };
-float Player::getLength() { return length; };
-std::vector<Vector2> Player::getPoints() { return points; };
+float Player::getDeltaXShip() const { return deltaXShip; };
+Vector2 Player::getVelocity() const { return {velocX, velocY}; }
+bool Player::isThrusting() const { return thrusting; }
+float Player::getDeltaYShip() const { return deltaYShip; };
+float Player::getLength() const { return length; };
+Vector2 Player::getMidpoint() const { return midpoint; };
+const std::array<Vector2, Player::numPoints>& Player::getPoints() const { return points; };
 
@@ -1,17 +1,41 @@
 #ifndef PLAYER_H
 #define PLAYER_H
 
+#include <raylib-cpp.hpp>
+#include <array>
+#include "components.h"
 #include "game_constants.h"
 
+// The player's ship. Player entities pair this with the PlayerInput that drives it
 class Player {
     public:
+	// Points in the ship's outline. Fixed, so a snapshot can't size the loops over them
+	static constexpr int numPoints = 11;
+
+	// Pointing up, centred on the middle of the screen or on centre
 	Player();
-	bool CollidedWithAsteroid(Asteroid& asteroid);
-	void Draw();
-	float getDeltaXShip();
-	float getDeltaYShip();
-	float getLength();
-	std::vector<Vector2> getPoints();
+	Player(Vector2 centre);
+	bool CollidedWithAsteroid(Position asteroidPosition, int asteroidRadius) const;
+	bool HitByBullet(Position bulletPosition) const;
+	// Advance the ship one frame: rotate, thrust, move and wrap around an arena of width by
+	// height
+	void Update(const PlayerInput& input, float arenaWidth, float arenaHeight);
+	void Draw() const;
+	// Returns true, and starts the gun cooling down for framesPerSpawn frames, if a bullet
+	// can be fired this frame
+	bool TryFire(int framesPerSpawn);
+	// Move the outline t of the way towards other's, for drawing a ship between two snapshots
+	void Blend(const Player& other, float t);
+	// Shift the outline by offset without touching the velocity, for drawing only
+	void Offset(Vector2 offset);
+	float getDeltaXShip() const;
+	float getDeltaYShip() const;
+	float getLength() const;
+	Vector2 getMidpoint() const;
+	const std::array<Vector2, numPoints>& getPoints() const;
+	// Pixels per frame
+	Vector2 getVelocity() const;
+	bool isThrusting() const;
     private:
 	//int SCREEN_WIDTH;
 	//int SCREEN_HEIGHT;
@@ -19,18 +43,24 @@ class Player {
         float dragCoeff = 0.99;
 	int length = 50;
         int width = 20;
-        int numPoints = 11;
         // x and y components of player velocity
         float velocX = 0;
         float velocY = 0;
 
-	float deltaXShip;
-	float deltaYShip;
+	float deltaXShip = 0;
+	float deltaYShip = 0;
          
 	// Radians to rotate by per frame (0.02 radians)
         float theta = (2 * GC::pi / 50);
 
-	std::vector<Vector2> points;
+	// Frames left before the gun can fire again
+	int bulletFramesUntilNextSpawn = 0;
+	bool thrusting = false;
+	// Spelled out so every byte of a ship is set and identical ships snapshot, and so
+	// checksum, identically
+	char padding[3] = {};
+
+	std::array<Vector2, numPoints> points;
 	Vector2 midpoint;
 };
 
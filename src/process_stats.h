@@ -0,0 +1,15 @@
+#ifndef PROCESSSTATS_H
+#define PROCESSSTATS_H
+
+#include <cstddef>
+
+// Largest resident set size the process has had, in bytes. 0 where it isn't available
+size_t peak_rss_bytes();
+// Current resident set size, in bytes. 0 where it isn't available
+size_t current_rss_bytes();
+// Only let the calling thread run when nothing else wants the CPU, for background work that
+// mustn't take the frame loop's time slices on a machine with few cores. Does nothing where
+// that isn't available
+void run_at_idle_priority();
+
+#endif // PROCESSSTATS_H
@@ -0,0 +1,141 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include "raster.h"
+#include "world.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define RASTER_SSE2
+#endif
+
+// Brighten the pixels of one row from x0 up to x1 to at least shade
+static void max_span(uint8_t* row, int x0, int x1, uint8_t shade) {
+#ifdef RASTER_SSE2
+    const __m128i s = _mm_set1_epi8((char)shade);
+    for (; x0 + 16 <= x1; x0 += 16) {
+        __m128i* p = reinterpret_cast<__m128i*>(row + x0);
+	_mm_storeu_si128(p, _mm_max_epu8(_mm_loadu_si128(p), s));
+    }
+#endif
+    for (; x0 < x1; x0++) row[x0] = std::max(row[x0], shade);
+}
+
+// Fill the pixels of row y whose centres lie between left and right
+static void fill_span(GrayImage& image, int y, float left, float right, uint8_t shade) {
+    int x0 = std::max((int)std::ceil(left - 0.5f), 0);
+    int x1 = std::min((int)std::floor(right - 0.5f) + 1, image.width);
+    if (x0 < x1) max_span(image.pixels + (size_t)y * image.stride, x0, x1, shade);
+}
+
+// The rows whose centres lie between top and bottom, clipped to the image
+static void row_range(const GrayImage& image, float top, float bottom, int& y0, int& y1) {
+    y0 = std::max((int)std::ceil(top - 0.5f), 0);
+    y1 = std::min((int)std::floor(bottom - 0.5f) + 1, image.height);
+}
+
+static void plot(GrayImage& image, int x, int y, uint8_t shade) {
+    uint8_t& pixel = image.pixels[(size_t)y * image.stride + x];
+    pixel = std::max(pixel, shade);
+}
+
+void raster_clear(GrayImage& image, uint8_t shade) {
+    for (int y = 0; y < image.height; y++) std::memset(image.pixels + (size_t)y * image.stride, shade, image.width);
+}
+
+void raster_line(GrayImage& image, Vector2 a, Vector2 b, uint8_t shade) {
+    // A sample per pixel along the longer axis, both ends included, each lighting the pixel
+    // it falls in
+    float dx = b.x - a.x;
+    float dy = b.y - a.y;
+    int steps = std::max((int)std::ceil(std::max(std::fabs(dx), std::fabs(dy))), 1);
+    float stepX = dx / steps;
+    float stepY = dy / steps;
+    float w = (float)image.width;
+    float h = (float)image.height;
+    int i = 0;
+#ifdef RASTER_SSE2
+    const __m128 lanes = _mm_set_ps(3, 2, 1, 0);
+    const __m128 zero = _mm_setzero_ps();
+    for (; i + 4 <= steps + 1; i += 4) {
+        __m128 t = _mm_add_ps(_mm_set1_ps((float)i), lanes);
+	__m128 x = _mm_add_ps(_mm_set1_ps(a.x), _mm_mul_ps(t, _mm_set1_ps(stepX)));
+	__m128 y = _mm_add_ps(_mm_set1_ps(a.y), _mm_mul_ps(t, _mm_set1_ps(stepY)));
+	// Inside the image, where truncating is flooring
+	__m128 inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(x, zero), _mm_cmplt_ps(x, _mm_set1_ps(w))), _mm_and_ps(_mm_cmpge_ps(y, zero), _mm_cmplt_ps(y, _mm_set1_ps(h))));
+	int mask = _mm_movemask_ps(inside);
+	if (mask == 0) continue;
+	alignas(16) int32_t xs[4];
+	alignas(16) int32_t ys[4];
+	_mm_store_si128(reinterpret_cast<__m128i*>(xs), _mm_cvttps_epi32(x));
+	_mm_store_si128(reinterpret_cast<__m128i*>(ys), _mm_cvttps_epi32(y));
+	for (int k = 0; k < 4; k++) {
+	    if (mask & (1 << k)) plot(image, xs[k], ys[k], shade);
+	}
+    }
+#endif
+    for (; i <= steps; i++) {
+        float x = a.x + i * stepX;
+	float y = a.y + i * stepY;
+	if (x >= 0 && x < w && y >= 0 && y < h) plot(image, (int)x, (int)y, shade);
+    }
+}
+
+void raster_circle(GrayImage& image, Vector2 centre, float radius, uint8_t shade) {
+    int y0, y1;
+    row_range(image, centre.y - radius, centre.y + radius, y0, y1);
+    for (int y = y0; y < y1; y++) {
+        float dy = y + 0.5f - centre.y;
+	float half = std::sqrt(std::max(radius * radius - dy * dy, 0.0f));
+	fill_span(image, y, centre.x - half, centre.x + half, shade);
+    }
+    // Smaller than a pixel. Lighting the pixel it's in again does no harm if it did cover one
+    if (radius < 1 && centre.x >= 0 && centre.x < image.width && centre.y >= 0 && centre.y < image.height) plot(image, (int)centre.x, (int)centre.y, shade);
+}
+
+void raster_triangle(GrayImage& image, Vector2 a, Vector2 b, Vector2 c, uint8_t shade) {
+    const Vector2 corners[3] = {a, b, c};
+    int y0, y1;
+    row_range(image, std::min({a.y, b.y, c.y}), std::max({a.y, b.y, c.y}), y0, y1);
+    for (int y = y0; y < y1; y++) {
+        // Where the row's centre line crosses the edges
+	float centreY = y + 0.5f;
+	float left = INFINITY;
+	float right = -INFINITY;
+	for (int e = 0; e < 3; e++) {
+	    Vector2 p = corners[e];
+	    Vector2 q = corners[(e + 1) % 3];
+	    if ((p.y <= centreY) == (q.y <= centreY)) continue;
+	    float x = p.x + (centreY - p.y) * (q.x - p.x) / (q.y - p.y);
+	    left = std::min(left, x);
+	    right = std::max(right, x);
+	}
+	if (left <= right) fill_span(image, y, left, right, shade);
+    }
+}
+
+static uint8_t luma(Color colour) {
+    return (uint8_t)((colour.r * 77 + colour.g * 150 + colour.b * 29) >> 8);
+}
+
+void raster_world(World& world, GrayImage& image) {
+    raster_clear(image);
+    float scaleX = (float)image.width / world.width;
+    float scaleY = (float)image.height / world.height;
+    auto scaled = [&](Vector2 v) { return Vector2{v.x * scaleX, v.y * scaleY}; };
+
+    world.shapedAsteroids.ForEach([&](Entity, Position& position, Asteroid& asteroid, const auto& shape) {
+        auto vertices = shape.getVertices(position);
+	uint8_t shade = luma(asteroid.getColour());
+	for (size_t i = 0; i < vertices.size(); i++) raster_line(image, scaled(vertices[i]), scaled(vertices[(i + 1) % vertices.size()]), shade);
+    });
+    world.bullets.ForEach([&](Entity, Position& position, Bullet& bullet) {
+        raster_circle(image, scaled({position.x, position.y}), bullet.getRadius() * std::min(scaleX, scaleY), luma(bullet.getColour()));
+    });
+    // As Player::Draw, leaving out what it draws in black
+    world.players.ForEach([&](Entity, Player& player, PlayerInput&, PlayerSlot&) {
+        const auto& points = player.getPoints();
+	if (player.isThrusting()) raster_triangle(image, scaled(points[10]), scaled(points[9]), scaled(points[8]), luma(ORANGE));
+	for (int i = 2; i < 8; i += 2) raster_line(image, scaled(points[i]), scaled(points[i + 1]), luma(WHITE));
+    });
+}
@@ -0,0 +1,37 @@
+#ifndef RASTER_H
+#define RASTER_H
+
+#include <raylib-cpp.hpp>
+#include <cstdint>
+
+struct World;
+
+// A grayscale image in memory the caller owns, one byte a pixel, rows stride bytes apart
+struct GrayImage {
+    uint8_t* pixels;
+    int width;
+    int height;
+    int stride;
+};
+
+// Software rasteriser for the shapes the game draws, for pixel observations on machines with
+// no GPU. Coordinates are in pixels, with pixel (x, y) covering x to x + 1 and y to y + 1;
+// filled shapes cover the pixels whose centres they contain. There's no antialiasing. Shapes
+// are combined by keeping the brighter of the pixel and the shade drawn, so the picture
+// doesn't depend on the order they're drawn in. Everything is clipped to the image.
+//
+// Filled shapes are drawn a row span at a time, sixteen pixels to an SSE2 instruction where
+// there is SSE2, and lines work out four pixels' positions at a time
+void raster_clear(GrayImage& image, uint8_t shade = 0);
+// One pixel wide
+void raster_line(GrayImage& image, Vector2 a, Vector2 b, uint8_t shade);
+// Filled. A circle under a pixel across always lights the pixel it's in
+void raster_circle(GrayImage& image, Vector2 centre, float radius, uint8_t shade);
+// Filled, either winding
+void raster_triangle(GrayImage& image, Vector2 a, Vector2 b, Vector2 c, uint8_t shade);
+
+// Draw what World::Draw does, scaled to fill the image, in shades of grey: the asteroids'
+// outlines, the bullets and the ships. Visual effects are left out
+void raster_world(World& world, GrayImage& image);
+
+#endif // RASTER_H
@@ -0,0 +1,266 @@
+#include <algorithm>
+#include <chrono>
+#include "rewind.h"
+#include "process_stats.h"
+#include "snapshot.h"
+#include "world.h"
+
+using Clock = std::chrono::steady_clock;
+
+// Snapshots waiting to be encoded, past which Record() waits for the thread
+static constexpr size_t MAX_QUEUED = 1;
+
+static size_t slot_bytes(const std::vector<uint8_t>& delta, const std::vector<uint8_t>& skipDelta, const std::vector<std::byte>& keyframe) {
+    return delta.capacity() + skipDelta.capacity() + keyframe.capacity();
+}
+
+RewindHistory::RewindHistory(RewindSettings s) : settings(s), codec(LOSSLESS_PRECISION), slots(std::max(s.maxTicks, 1)) {
+    settings.keyframeInterval = std::max(settings.keyframeInterval, 1);
+    settings.skipTicks = std::max(settings.skipTicks, 1);
+    thread = std::thread(&RewindHistory::run, this);
+}
+
+RewindHistory::~RewindHistory() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+	stopping = true;
+    }
+    ready.notify_one();
+    thread.join();
+}
+
+void RewindHistory::Clear() {
+    Flush();
+    reset();
+    recording = false;
+    hasCursor = false;
+    seeked = false;
+    std::lock_guard<std::mutex> lock(mutex);
+    stats.depth = 0;
+    stats.keyframes = 0;
+}
+
+void RewindHistory::reset() {
+    for (Slot& slot : slots) {
+        slot.hasKeyframe = false;
+	slot.hasSkip = false;
+    }
+    depth = 0;
+    numKeyframes = 0;
+    hasSkipFrom = false;
+}
+
+void RewindHistory::dropOldest(bool release) {
+    Slot& slot = slotFor(latestTick - depth + 1);
+    if (slot.hasKeyframe) numKeyframes--;
+    slot.hasKeyframe = false;
+    slot.hasSkip = false;
+    if (release) {
+        historyBytes -= slot_bytes(slot.delta, slot.skipDelta, slot.keyframe);
+	std::vector<uint8_t>().swap(slot.delta);
+	std::vector<uint8_t>().swap(slot.skipDelta);
+	std::vector<std::byte>().swap(slot.keyframe);
+    }
+    depth--;
+}
+
+void RewindHistory::truncateToCursor() {
+    for (; latestTick > cursorTick; latestTick--, depth--) {
+        Slot& slot = slotFor(latestTick);
+	if (slot.hasKeyframe) numKeyframes--;
+	slot.hasKeyframe = false;
+	slot.hasSkip = false;
+    }
+    latest.swap(cursor);
+    hasCursor = false;
+    // The snapshot kept for the next skip delta has to be from before the latest
+    if (skipFromTick >= latestTick) hasSkipFrom = false;
+}
+
+void RewindHistory::Record(World& world) {
+    auto start = Clock::now();
+    Job job;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+	// Seek() left the thread idle, and nothing has been queued since
+	if (seeked) {
+	    truncateToCursor();
+	    recordedTick = latestTick;
+	}
+	idle.wait(lock, [&] { return queue.size() < MAX_QUEUED; });
+	if (!pool.empty()) {
+	    job.snapshot.swap(pool.back());
+	    pool.pop_back();
+	}
+    }
+    seeked = false;
+
+    // Left to itself a buffer that's a little too small would double, and this one may end up
+    // kept as a keyframe, so make room for a little more than last time instead
+    if (job.snapshot.capacity() < recordedBytes + recordedBytes / 32) {
+        job.snapshot.clear();
+	job.snapshot.reserve(recordedBytes + recordedBytes / 16);
+    }
+    save_snapshot(world, job.snapshot);
+    recordedBytes = job.snapshot.size();
+    job.tick = world.state.tick;
+    job.restart = !recording || job.tick != recordedTick + 1;
+    // The cursor may be at a tick the new history will have too, in another game
+    if (job.restart) hasCursor = false;
+    recording = true;
+    recordedTick = job.tick;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+	queue.push_back(std::move(job));
+	stats.lastRecordSeconds = seconds_since(start);
+    }
+    ready.notify_one();
+}
+
+void RewindHistory::encode(Job& job) {
+    uint64_t tick = job.tick;
+    uint64_t skip = settings.skipTicks;
+    if (job.restart) {
+        reset();
+    } else {
+        // The ring is full, so this tick's slot is the oldest tick's
+	if (depth == (int)slots.size()) dropOldest(false);
+
+	Slot& slot = slotFor(tick);
+	historyBytes -= slot_bytes(slot.delta, slot.skipDelta, slot.keyframe);
+	codec.Encode(job.snapshot.data(), job.snapshot.size(), latest.data(), latest.size(), slot.delta);
+	// The skip delta goes back to a keyframe, or to the snapshot kept for it
+	const std::vector<std::byte>* skipTo = nullptr;
+	if (hasSkipFrom && skipFromTick + skip == tick) {
+	    skipTo = &skipFrom;
+	} else if (tick % skip == 0 && tick >= skip && tick - skip > latestTick - depth && slotFor(tick - skip).hasKeyframe) {
+	    skipTo = &slotFor(tick - skip).keyframe;
+	}
+	slot.hasSkip = tick % skip == 0 && skipTo;
+	if (slot.hasSkip) codec.Encode(job.snapshot.data(), job.snapshot.size(), skipTo->data(), skipTo->size(), slot.skipDelta);
+	historyBytes += slot_bytes(slot.delta, slot.skipDelta, slot.keyframe);
+	depth++;
+    }
+    uint64_t previousTick = latestTick;
+    latest.swap(job.snapshot);
+    latestTick = tick;
+
+    // The snapshot that was the latest is still wanted if it's a keyframe or the next skip
+    // delta goes back to it, and is moved there rather than copied
+    if (!job.restart && previousTick > latestTick - depth) {
+        Slot& slot = slotFor(previousTick);
+	if (previousTick % settings.keyframeInterval == 0) {
+	    historyBytes -= slot_bytes(slot.delta, slot.skipDelta, slot.keyframe);
+	    slot.keyframe.swap(job.snapshot);
+	    historyBytes += slot_bytes(slot.delta, slot.skipDelta, slot.keyframe);
+	    if (!slot.hasKeyframe) numKeyframes++;
+	    slot.hasKeyframe = true;
+	} else if (previousTick % skip == 0) {
+	    skipFrom.swap(job.snapshot);
+	    skipFromTick = previousTick;
+	    hasSkipFrom = true;
+	}
+    }
+
+    // The latest snapshot, the one the next skip delta goes back to, the two seeks decode with
+    // and the ones queued and being encoded are each about a snapshot's size, whether or not
+    // there has been a seek yet
+    workingBytes = (5 + MAX_QUEUED) * latest.capacity();
+    while (depth > 0 && historyBytes + workingBytes > settings.budgetBytes) dropOldest(true);
+}
+
+void RewindHistory::run() {
+    run_at_idle_priority();
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        ready.wait(lock, [&] { return !queue.empty() || stopping; });
+	if (queue.empty()) break;
+	Job job = std::move(queue.front());
+	queue.pop_front();
+	busy = true;
+	lock.unlock();
+	// There's room for the next snapshot already
+	idle.notify_all();
+
+	auto start = Clock::now();
+	encode(job);
+	double seconds = seconds_since(start);
+
+	lock.lock();
+	busy = false;
+	pool.push_back(std::move(job.snapshot));
+	stats.encodeTimes.Record(seconds);
+	stats.depth = depth;
+	stats.keyframes = numKeyframes;
+	stats.bytes = historyBytes + workingBytes;
+	idle.notify_all();
+    }
+}
+
+void RewindHistory::Flush() {
+    std::unique_lock<std::mutex> lock(mutex);
+    idle.wait(lock, [&] { return queue.empty() && !busy; });
+}
+
+int RewindHistory::getDepth() {
+    Flush();
+    return depth;
+}
+
+RewindStats RewindHistory::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
+
+bool RewindHistory::Seek(World& world, int ticksBack) {
+    auto start = Clock::now();
+    Flush();
+    if (!recording || ticksBack < 0 || ticksBack > depth) return false;
+    uint64_t target = latestTick - ticksBack;
+
+    // Start from whichever of the latest snapshot, the first keyframe at or after the target
+    // and the last seek is nearest the target
+    uint64_t from = latestTick;
+    const std::vector<std::byte>* source = &latest;
+    uint64_t interval = settings.keyframeInterval;
+    uint64_t keyframeTick = (target + interval - 1) / interval * interval;
+    // The oldest tick has no slot of its own: the one after it decodes to it
+    if (keyframeTick == latestTick - depth) keyframeTick += interval;
+    if (keyframeTick < latestTick && slotFor(keyframeTick).hasKeyframe) {
+        from = keyframeTick;
+	source = &slotFor(keyframeTick).keyframe;
+    }
+    if (hasCursor && cursorTick >= target && cursorTick <= from) {
+        from = cursorTick;
+	source = &cursor;
+    }
+    if (source != &cursor) cursor.assign(source->begin(), source->end());
+    cursorTick = from;
+    hasCursor = true;
+
+    int decodes = 0;
+    uint64_t skip = settings.skipTicks;
+    while (cursorTick > target) {
+        const Slot& slot = slotFor(cursorTick);
+	bool skipping = slot.hasSkip && cursorTick - target >= skip;
+	const std::vector<uint8_t>& delta = skipping ? slot.skipDelta : slot.delta;
+	if (!codec.Decode(cursor.data(), cursor.size(), delta.data(), delta.size(), scratch)) {
+	    Clear();
+	    return false;
+	}
+	cursor.swap(scratch);
+	cursorTick -= skipping ? skip : 1;
+	decodes++;
+    }
+    if (!load_snapshot(world, cursor.data(), cursor.size())) {
+        Clear();
+	return false;
+    }
+    seeked = true;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    stats.lastSeekDecodes = decodes;
+    stats.lastSeekSeconds = seconds_since(start);
+    return true;
+}
@@ -0,0 +1,156 @@
+#ifndef REWIND_H
+#define REWIND_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "snapshot_delta.h"
+#include "latency_histogram.h"
+#include "game_constants.h"
+
+struct World;
+
+struct RewindSettings {
+    // Ticks back that are kept
+    int maxTicks = GC::REWIND_HISTORY_SECONDS * GC::FPS;
+    // Ticks between keyframes
+    int keyframeInterval = GC::REWIND_KEYFRAME_INTERVAL;
+    // Ticks spanned by the extra deltas that let a seek this far back decode just one
+    int skipTicks = GC::REWIND_FAST_TICKS;
+    // When the history would take more than this, its oldest ticks are dropped
+    size_t budgetBytes = GC::REWIND_BUDGET_BYTES;
+};
+
+struct RewindStats {
+    // Ticks back that can be reached
+    int depth = 0;
+    int keyframes = 0;
+    // Held by the history, keyframes and scratch buffers included
+    size_t bytes = 0;
+    // What the last Record() cost the caller, and the thread's time encoding each tick
+    double lastRecordSeconds = 0;
+    LatencyHistogram encodeTimes;
+    double lastSeekSeconds = 0;
+    // Deltas decoded by the last seek
+    int lastSeekDecodes = 0;
+};
+
+// The last few seconds of a game, for running time backwards in the game and for stepping back
+// through a bug. Record() is called after every tick, and Seek() puts the world back any number
+// of ticks up to getDepth().
+//
+// Every tick is stored as a lossless delta (see snapshot_delta.h) that turns the tick's snapshot
+// into the one before it, so going back a tick from the latest is one decode, and the oldest
+// ticks can be dropped without touching the rest. Asteroids flying straight are predicted
+// backwards exactly, so a tick costs bytes for what the game changed rather than for how much
+// there is. Every keyframeInterval ticks a full snapshot is kept too, so a seek never decodes
+// more than that many deltas. Seeks also carry on from where the last one ended, so holding a
+// rewind key decodes a delta a frame. Every skipTicks ticks there's a second delta that goes
+// back skipTicks ticks at once, so rewinding that many ticks a frame is one decode a frame too.
+//
+// Record() only takes the snapshot; the deltas are encoded on a thread of its own, which at
+// 50,000 asteroids is most of the cost. It's handed at most a couple of snapshots at a time,
+// so if it falls behind Record() waits for it. Seek() and getDepth() wait for it to catch up.
+//
+// Storage is a ring with a slot per tick whose buffers are reused, so recording stops
+// allocating once the ring has gone round
+class RewindHistory {
+    public:
+	RewindHistory(RewindSettings s = RewindSettings());
+	RewindHistory(const RewindHistory&) = delete;
+	RewindHistory& operator=(const RewindHistory&) = delete;
+	~RewindHistory();
+
+	// Add the world as it is now, which should be one tick on from the last Record(), or from
+	// where the last Seek() left it, in which case the ticks after that are forgotten. Anything
+	// else (a new game, a loaded snapshot) starts the history again from here
+	void Record(World& world);
+	// Load the world as it was ticksBack ticks before the latest Record(), 0 being the latest
+	// itself. Returns false, leaving the world alone, if that's further back than getDepth()
+	bool Seek(World& world, int ticksBack);
+	void Clear();
+
+	// Ticks back that Seek() can go
+	int getDepth();
+	// Wait for every Record() so far to be encoded
+	void Flush();
+	RewindStats getStats() const;
+    private:
+	struct Slot {
+	    // Turns this tick's snapshot into the previous tick's
+	    std::vector<uint8_t> delta;
+	    // On ticks that are a multiple of skipTicks, turns it into the one skipTicks before
+	    std::vector<uint8_t> skipDelta;
+	    bool hasSkip = false;
+	    // This tick's whole snapshot, on keyframe ticks once the next tick has been recorded
+	    std::vector<std::byte> keyframe;
+	    bool hasKeyframe = false;
+	};
+
+	struct Job {
+	    uint64_t tick = 0;
+	    // Pooled
+	    std::vector<std::byte> snapshot;
+	    // Not one tick on from the last: start again from here
+	    bool restart = false;
+	};
+
+	Slot& slotFor(uint64_t tick) { return slots[tick % slots.size()]; }
+	// Forget every tick, without waiting for the thread
+	void reset();
+	// Forget the oldest tick, and with release give its buffers back too
+	void dropOldest(bool release);
+	// Forget the ticks after the one the last seek went to
+	void truncateToCursor();
+	void run();
+	// Add a snapshot to the history, on the thread
+	void encode(Job& job);
+
+	RewindSettings settings;
+
+	// Only used by the caller
+	bool recording = false;
+	uint64_t recordedTick = 0;
+	size_t recordedBytes = 0;
+	// The snapshot the last seek decoded and the tick it's at, which later seeks can carry on
+	// from. seeked is set while the world is still there
+	std::vector<std::byte> cursor;
+	std::vector<std::byte> scratch;
+	uint64_t cursorTick = 0;
+	bool hasCursor = false;
+	bool seeked = false;
+
+	// The history. Used by the thread, and by the caller only once it has waited for the
+	// thread to go idle
+	SnapshotDeltaCodec codec;
+	std::vector<Slot> slots;
+	// Ticks (latestTick - depth, latestTick] have slots
+	uint64_t latestTick = 0;
+	int depth = 0;
+	int numKeyframes = 0;
+	size_t historyBytes = 0;
+	// Snapshot-sized buffers that aren't part of the history but count against the budget
+	size_t workingBytes = 0;
+	std::vector<std::byte> latest;
+	// The last snapshot before the latest at a multiple of skipTicks, for the next skip delta
+	// to go back to. Those that are keyframes are in their slot instead
+	std::vector<std::byte> skipFrom;
+	uint64_t skipFromTick = 0;
+	bool hasSkipFrom = false;
+
+	std::thread thread;
+	mutable std::mutex mutex;
+	std::condition_variable ready;
+	std::condition_variable idle;
+	std::deque<Job> queue;
+	std::vector<std::vector<std::byte>> pool;
+	bool busy = false;
+	bool stopping = false;
+	RewindStats stats;
+};
+
+#endif // REWIND_H
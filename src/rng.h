@@ -0,0 +1,39 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <cstdint>
+
+// PCG32 random number generator (O'Neill, pcg-random.org). Usable anywhere the standard
+// library wants a uniform random bit generator, e.g. with std::uniform_real_distribution.
+//
+// The whole state is two integers, so it can be copied into a snapshot or a rollback buffer
+// byte for byte, unlike std::mt19937's 5 KB of state. inc selects one of 2^63 independent
+// streams, so two generators given the same seed but different streams don't overlap
+struct Pcg32 {
+    using result_type = uint32_t;
+
+    uint64_t state;
+    uint64_t inc;
+
+    explicit Pcg32(uint64_t seed = 0x853c49e6748fea9bULL, uint64_t stream = 0xda3e39cb94b95bdbULL) : state(0), inc((stream << 1) | 1) {
+        (*this)();
+	state += seed;
+	(*this)();
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT32_MAX; }
+
+    result_type operator()() {
+        uint64_t old = state;
+	state = old * 6364136223846793005ULL + inc;
+	uint32_t xorShifted = (uint32_t)(((old >> 18) ^ old) >> 27);
+	uint32_t rot = (uint32_t)(old >> 59);
+	return (xorShifted >> rot) | (xorShifted << ((-rot) & 31));
+    }
+
+    bool operator==(const Pcg32& other) const { return state == other.state && inc == other.inc; }
+    bool operator!=(const Pcg32& other) const { return !(*this == other); }
+};
+
+#endif // RNG_H
@@ -0,0 +1,166 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include "rollback.h"
+#include "snapshot.h"
+#include "world.h"
+
+RollbackSession::RollbackSession(World& w, int players, int local, int delay, int rollback) :
+    world(w),
+    numPlayers(std::clamp(players, 1, GC::MAX_PLAYERS)),
+    localSlot(local),
+    inputDelay(std::clamp(delay, 0, INPUT_HISTORY / 4)),
+    maxRollback(std::clamp(rollback, 1, INPUT_HISTORY / 4)),
+    confirmed(numPlayers * INPUT_HISTORY),
+    used(numPlayers * INPUT_HISTORY),
+    confirmedCount(numPlayers, 0),
+    states(maxRollback + 2),
+    checksums(INPUT_HISTORY / CHECKSUM_INTERVAL)
+{
+    world.NewGame(numPlayers);
+    world.state.status = PLAYING;
+
+    // Nobody has any input for the frames before their first input takes effect
+    for (int slot = 0; slot < numPlayers; slot++) {
+        for (int f = 0; f < inputDelay; f++) confirmed[slot * INPUT_HISTORY + f] = {(uint32_t)f, PlayerInput()};
+	confirmedCount[slot] = inputDelay;
+    }
+}
+
+uint32_t RollbackSession::getConfirmedFrame() const {
+    return *std::min_element(confirmedCount.begin(), confirmedCount.end());
+}
+
+PlayerInput RollbackSession::getInput(int slot, uint32_t f) const {
+    const InputRecord& record = confirmed[slot * INPUT_HISTORY + f % INPUT_HISTORY];
+    return record.frame == f ? record.input : PlayerInput();
+}
+
+PlayerInput RollbackSession::predictInput(int slot, uint32_t f) const {
+    const InputRecord& record = confirmed[slot * INPUT_HISTORY + f % INPUT_HISTORY];
+    if (record.frame == f) return record.input;
+    if (confirmedCount[slot] == 0) return PlayerInput();
+    return getInput(slot, confirmedCount[slot] - 1);
+}
+
+bool RollbackSession::CanAdvance() const {
+    return (int64_t)frame - getConfirmedFrame() < maxRollback;
+}
+
+void RollbackSession::AddRemoteInput(int slot, uint32_t f, const PlayerInput& input) {
+    if (slot < 0 || slot >= numPlayers || slot == localSlot) return;
+    if (f != confirmedCount[slot]) return;
+    // Too far ahead to store without overwriting inputs a rollback might still need
+    if (f + maxRollback + 1 >= frame + INPUT_HISTORY) return;
+
+    confirmed[slot * INPUT_HISTORY + f % INPUT_HISTORY] = {f, input};
+    confirmedCount[slot]++;
+
+    // Already simulated, and with something else
+    if (f < frame && used[slot * INPUT_HISTORY + f % INPUT_HISTORY] != input) rollbackTo = std::min(rollbackTo, f);
+}
+
+void RollbackSession::ForceRollback(int frames) {
+    uint32_t depth = (uint32_t)std::clamp(frames, 0, maxRollback);
+    rollbackTo = std::min(rollbackTo, frame - std::min(depth, frame));
+}
+
+void RollbackSession::simulateFrame(uint32_t f) {
+    save_snapshot(world, states[f % states.size()]);
+
+    PlayerInput inputs[GC::MAX_PLAYERS];
+    for (int slot = 0; slot < numPlayers; slot++) {
+        inputs[slot] = predictInput(slot, f);
+	used[slot * INPUT_HISTORY + f % INPUT_HISTORY] = inputs[slot];
+    }
+    world.Tick(inputs, numPlayers);
+
+    // Carry on without waiting for a key press
+    if (world.state.status == NEXT_LEVEL) {
+        world.state.status = PLAYING;
+    } else if (world.state.status == GAME_OVER) {
+        world.NewGame(numPlayers);
+	world.state.status = PLAYING;
+    }
+}
+
+void RollbackSession::AdvanceFrame(const PlayerInput& localInput) {
+    if (rollbackTo < frame) {
+        auto start = std::chrono::steady_clock::now();
+	const std::vector<std::byte>& state = states[rollbackTo % states.size()];
+
+	// Frames that are played again mustn't make their explosions twice
+	ParticleSystem* particles = world.particles;
+	world.particles = nullptr;
+	if (!load_snapshot(world, state.data(), state.size())) {
+	    std::cerr << "rollback: can't restore frame " << rollbackTo << std::endl;
+	} else {
+	    for (uint32_t f = rollbackTo; f < frame; f++) simulateFrame(f);
+	}
+	world.particles = particles;
+
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	stats.rollbacks++;
+	stats.maxDepth = std::max(stats.maxDepth, (int)(frame - rollbackTo));
+	stats.resimulatedFrames += frame - rollbackTo;
+	stats.rollbackSeconds += seconds;
+	stats.maxRollbackSeconds = std::max(stats.maxRollbackSeconds, seconds);
+	rollbackTo = UINT32_MAX;
+    }
+
+    uint32_t inputFrame = frame + inputDelay;
+    confirmed[localSlot * INPUT_HISTORY + inputFrame % INPUT_HISTORY] = {inputFrame, localInput};
+    confirmedCount[localSlot] = inputFrame + 1;
+
+    simulateFrame(frame);
+    frame++;
+    updateChecksums();
+}
+
+void RollbackSession::updateChecksums() {
+    // Once every input before a checksum frame is known (and any rollback they caused has been
+    // done), the state saved at that frame is final
+    while (nextChecksumFrame < frame && nextChecksumFrame <= getConfirmedFrame()) {
+        uint32_t f = nextChecksumFrame;
+	nextChecksumFrame += CHECKSUM_INTERVAL;
+	if (frame - f > states.size()) continue;
+
+	const std::vector<std::byte>& state = states[f % states.size()];
+	ChecksumRecord& record = checksums[(f / CHECKSUM_INTERVAL) % checksums.size()];
+	record = {f, snapshot_checksum(state.data(), state.size())};
+	latestChecksum = record;
+
+	if (pendingRemote.frame == f) CheckChecksum(pendingRemote.frame, pendingRemote.checksum);
+    }
+}
+
+bool RollbackSession::getLatestChecksum(uint32_t& checksumFrame, uint64_t& checksum) const {
+    if (latestChecksum.frame == UINT32_MAX) return false;
+    checksumFrame = latestChecksum.frame;
+    checksum = latestChecksum.checksum;
+    return true;
+}
+
+bool RollbackSession::getChecksum(uint32_t checksumFrame, uint64_t& checksum) const {
+    const ChecksumRecord& record = checksums[(checksumFrame / CHECKSUM_INTERVAL) % checksums.size()];
+    if (record.frame != checksumFrame) return false;
+    checksum = record.checksum;
+    return true;
+}
+
+bool RollbackSession::CheckChecksum(uint32_t checksumFrame, uint64_t checksum) {
+    if (lastCheckedFrame != UINT32_MAX && checksumFrame <= lastCheckedFrame) return true;
+
+    const ChecksumRecord& record = checksums[(checksumFrame / CHECKSUM_INTERVAL) % checksums.size()];
+    if (record.frame != checksumFrame) {
+        // Ours isn't ready yet. Check it when it is
+	if (checksumFrame >= nextChecksumFrame) pendingRemote = {checksumFrame, checksum};
+	return true;
+    }
+
+    lastCheckedFrame = checksumFrame;
+    if (record.checksum == checksum) return true;
+    desyncs++;
+    std::cerr << "rollback: desync at frame " << checksumFrame << std::endl;
+    return false;
+}
@@ -0,0 +1,125 @@
+#ifndef ROLLBACK_H
+#define ROLLBACK_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "components.h"
+#include "game_constants.h"
+
+struct World;
+
+struct RollbackStats {
+    int rollbacks = 0;
+    int maxDepth = 0;
+    // Frames simulated again because of rollbacks
+    uint64_t resimulatedFrames = 0;
+    double rollbackSeconds = 0;
+    double maxRollbackSeconds = 0;
+};
+
+// GGPO-style rollback over a world that every peer simulates. Each frame the local player's
+// input is queued a few frames ahead (the input delay), inputs that haven't arrived from the
+// other players are predicted by repeating their last one, and the world is ticked straight
+// away. When a remote input turns up that differs from the prediction, the world is restored
+// from the snapshot saved before the first wrong frame and simulated forward again with the
+// right inputs, all before the next frame is drawn.
+//
+// Frame f is the tick that takes the world from its state at f to its state at f + 1.
+// The simulation can run at most maxRollback frames past the last frame every player's input
+// is known for; CanAdvance() says when it has to wait instead.
+//
+// The game carries straight on through levels and game overs, since there's no one to press a
+// key for a peer, so the world isn't left in NEXT_LEVEL or GAME_OVER between frames
+class RollbackSession {
+    public:
+	RollbackSession(World& w, int numPlayers, int localSlot, int inputDelay = GC::NETPLAY_INPUT_DELAY, int maxRollback = GC::ROLLBACK_FRAMES);
+
+	// False if another frame would run too far past the confirmed inputs
+	bool CanAdvance() const;
+	// Catch up on any rollback, then queue localInput and tick the world once. Only call it
+	// when CanAdvance()
+	void AdvanceFrame(const PlayerInput& localInput);
+	// A confirmed input from another player. Inputs for a slot have to arrive in frame order;
+	// repeats and ones that skip ahead are ignored, since the sender repeats them until acked
+	void AddRemoteInput(int slot, uint32_t frame, const PlayerInput& input);
+	// Roll the next AdvanceFrame back this many frames whether or not a prediction was wrong,
+	// to time the worst case
+	void ForceRollback(int frames);
+
+	// The next frame to simulate
+	uint32_t getFrame() const { return frame; }
+	int getLocalSlot() const { return localSlot; }
+	int getNumPlayers() const { return numPlayers; }
+	int getInputDelay() const { return inputDelay; }
+	// Inputs are known for every slot up to (not including) this frame
+	uint32_t getConfirmedFrame() const;
+	// Frames slot's inputs are known for, from frame 0
+	uint32_t getConfirmedCount(int slot) const { return confirmedCount[slot]; }
+	// The confirmed input of slot for frame, which must be one of the last INPUT_HISTORY
+	// before getConfirmedCount(slot)
+	PlayerInput getInput(int slot, uint32_t frame) const;
+
+	// Checksum of the world's state at the most recent multiple of CHECKSUM_INTERVAL whose
+	// inputs were all confirmed. Returns false before there is one
+	bool getLatestChecksum(uint32_t& checksumFrame, uint64_t& checksum) const;
+	// Our checksum for a multiple of CHECKSUM_INTERVAL. Returns false if it isn't (or is no
+	// longer) in our history
+	bool getChecksum(uint32_t checksumFrame, uint64_t& checksum) const;
+	// Compare a peer's checksum with ours for the same frame. Returns false if they differ. A
+	// frame that has already left our history can't be checked and counts as matching
+	bool CheckChecksum(uint32_t checksumFrame, uint64_t checksum);
+	int getDesyncs() const { return desyncs; }
+
+	const RollbackStats& getStats() const { return stats; }
+
+	static constexpr int INPUT_HISTORY = 128;
+	static constexpr uint32_t CHECKSUM_INTERVAL = 8;
+    private:
+	struct InputRecord {
+	    uint32_t frame = UINT32_MAX;
+	    PlayerInput input;
+	};
+
+	// What slot is assumed to do on frame f: its input if that's known, otherwise its last
+	// known input
+	PlayerInput predictInput(int slot, uint32_t f) const;
+	// Tick the world through frame f with the best inputs we have, saving the state first
+	void simulateFrame(uint32_t f);
+	void updateChecksums();
+
+	World& world;
+	int numPlayers;
+	int localSlot;
+	int inputDelay;
+	int maxRollback;
+	uint32_t frame = 0;
+	// Earliest frame simulated with a wrong prediction, or UINT32_MAX if none
+	uint32_t rollbackTo = UINT32_MAX;
+
+	// [slot * INPUT_HISTORY + f % INPUT_HISTORY]: confirmed inputs, and the inputs frame f was
+	// last simulated with
+	std::vector<InputRecord> confirmed;
+	std::vector<PlayerInput> used;
+	std::vector<uint32_t> confirmedCount;
+
+	// The world's state before each of the last maxRollback + 2 frames, at [f % size]
+	std::vector<std::vector<std::byte>> states;
+
+	// Our checksums for the last few multiples of CHECKSUM_INTERVAL, at [(f / interval) % size]
+	struct ChecksumRecord {
+	    uint32_t frame = UINT32_MAX;
+	    uint64_t checksum = 0;
+	};
+	std::vector<ChecksumRecord> checksums;
+	ChecksumRecord latestChecksum;
+	uint32_t nextChecksumFrame = 0;
+	// A peer's checksum for a frame we haven't got to yet, and the last frame compared
+	ChecksumRecord pendingRemote;
+	uint32_t lastCheckedFrame = UINT32_MAX;
+	int desyncs = 0;
+
+	RollbackStats stats;
+};
+
+#endif // ROLLBACK_H
@@ -0,0 +1,104 @@
+#include <fstream>
+#include <iostream>
+#include "scenario.h"
+#include "world.h"
+#include "snapshot.h"
+
+static std::string trim(const std::string& s) {
+    size_t start = s.find_first_not_of(" \t\r");
+    if (start == std::string::npos) return "";
+    size_t end = s.find_last_not_of(" \t\r");
+    return s.substr(start, end - start + 1);
+}
+
+static bool parse_int(const std::string& value, long long& out) {
+    try {
+        size_t used;
+	out = std::stoll(value, &used);
+	return used == value.size();
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+bool set_scenario_value(Scenario& scenario, const std::string& key, const std::string& value) {
+    if (key == "bot") {
+        scenario.bot = value;
+	return true;
+    }
+    if (key == "snapshot") {
+        scenario.snapshot = value;
+	return true;
+    }
+
+    long long n;
+    if (!parse_int(value, n) || n < 0) {
+        std::cerr << "scenario: " << key << " needs a non-negative whole number, got '" << value << "'" << std::endl;
+	return false;
+    }
+
+    if (key == "seed") scenario.seed = (unsigned int)n;
+    else if (key == "frames") scenario.frames = (int)n;
+    else if (key == "world_width") scenario.worldWidth = (int)n;
+    else if (key == "world_height") scenario.worldHeight = (int)n;
+    else if (key == "small_asteroids") scenario.asteroids[0] = (int)n;
+    else if (key == "medium_asteroids") scenario.asteroids[1] = (int)n;
+    else if (key == "large_asteroids") scenario.asteroids[2] = (int)n;
+    else if (key == "vertices") scenario.numVertices = (int)n;
+    else if (key == "fire_rate") scenario.fireRate = (int)n;
+    else {
+        std::cerr << "scenario: unknown key '" << key << "'" << std::endl;
+	return false;
+    }
+    return true;
+}
+
+bool load_scenario(const std::string& path, Scenario& scenario) {
+    std::ifstream file(path);
+    if (!file) {
+        std::cerr << "scenario: can't open " << path << std::endl;
+	return false;
+    }
+
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        lineNumber++;
+	line = trim(line.substr(0, line.find('#')));
+	if (line.empty()) continue;
+
+	size_t equals = line.find('=');
+	if (equals == std::string::npos) {
+	    std::cerr << path << ":" << lineNumber << ": expected key = value" << std::endl;
+	    return false;
+	}
+	if (!set_scenario_value(scenario, trim(line.substr(0, equals)), trim(line.substr(equals + 1)))) {
+	    std::cerr << path << ":" << lineNumber << ": bad line" << std::endl;
+	    return false;
+	}
+    }
+    return true;
+}
+
+Entity start_scenario(World& world, const Scenario& scenario) {
+    if (!scenario.snapshot.empty()) {
+        if (!load_snapshot_file(world, scenario.snapshot)) return NULL_ENTITY;
+	world.state.status = PLAYING;
+	return world.getShip();
+    }
+
+    world.registry.Clear();
+    world.state.level = 1;
+    world.state.score = 0;
+    world.state.tick = 0;
+    world.state.loser = -1;
+    world.state.status = PLAYING;
+    world.bulletFramesPerSpawn = scenario.fireRate;
+
+    Entity ship = spawn_player(world);
+    for (int size = 1; size <= 3; size++) {
+        create_asteroids(world, scenario.asteroids[size - 1], size, scenario.numVertices);
+    }
+    rebuild_broadphase(world);
+    return ship;
+}
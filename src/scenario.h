@@ -0,0 +1,45 @@
+#ifndef SCENARIO_H
+#define SCENARIO_H
+
+#include <string>
+#include "ecs.h"
+#include "game_constants.h"
+
+struct World;
+
+// Starting setup for a headless run. Loaded from a text file with one "key = value" per line
+// ('#' starts a comment), e.g.
+//
+//     seed = 42
+//     frames = 3600
+//     large_asteroids = 10000
+//     bot = spinner
+//
+// Instead of generating the world, a scenario can start from a snapshot file made earlier
+// (see snapshot.h), which for big worlds is much quicker than building it asteroid by asteroid
+struct Scenario {
+    unsigned int seed = 1;
+    int frames = 600;
+    int worldWidth = GC::SCREEN_WIDTH;
+    int worldHeight = GC::SCREEN_HEIGHT;
+    // Asteroids to start with, indexed by size - 1
+    int asteroids[3] = {0, 0, 3};
+    int numVertices = 12;
+    // Frames between shots
+    int fireRate = GC::BULLET_FRAMES_PER_SPAWN;
+    // Controller flying the ship, see make_controller
+    std::string bot = "spinner";
+    // Snapshot to start from. When set, the world size, asteroids and fire rate come from the
+    // snapshot and the settings above are ignored
+    std::string snapshot;
+};
+
+// Set one field from its key. Returns false and prints why if the key or value is bad
+bool set_scenario_value(Scenario& scenario, const std::string& key, const std::string& value);
+// Returns false and prints why if the file can't be read or has a bad line
+bool load_scenario(const std::string& path, Scenario& scenario);
+// Replace everything in the world with the scenario's ship and asteroids. Returns the ship, or
+// NULL_ENTITY if the scenario's snapshot couldn't be loaded
+Entity start_scenario(World& world, const Scenario& scenario);
+
+#endif // SCENARIO_H
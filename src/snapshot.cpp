@@ -0,0 +1,434 @@
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <type_traits>
+#include <utility>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include "snapshot.h"
+#include "world.h"
+
+static size_t align64(size_t v) { return (v + 63) & ~(size_t)63; }
+
+// Zero the padding after an array that ends at end, so the same state always gives the same bytes
+static void zero_padding(std::byte* base, size_t end) { std::memset(base + end, 0, align64(end) - end); }
+
+static bool included(const SnapshotFilter& filter, uint32_t index) {
+    return index < filter.handles.size() && filter.handles[index] != NULL_ENTITY;
+}
+
+static void layout_sizes(uint32_t layout[8]) {
+    const uint32_t sizes[8] = {sizeof(Entity), sizeof(Player), sizeof(PlayerInput), sizeof(PlayerSlot), sizeof(Position), sizeof(Velocity), sizeof(Bullet), sizeof(Asteroid)};
+    std::memcpy(layout, sizes, sizeof(sizes));
+}
+
+// True if rows of a component hold values the game can use. Most can hold anything
+template <typename C>
+static bool valid_rows(const C*, uint64_t) { return true; }
+
+static bool valid_rows(const Asteroid* asteroids, uint64_t count) {
+    // Sizes pick the radius and what an asteroid breaks into
+    for (uint64_t i = 0; i < count; i++) {
+        if (asteroids[i].getSize() < 1 || asteroids[i].getSize() > 3) return false;
+    }
+    return true;
+}
+
+static bool valid_rows(const PlayerSlot* slots, uint64_t count) {
+    // Slots index the inputs a tick is given
+    for (uint64_t i = 0; i < count; i++) {
+        if (slots[i].index < 0 || slots[i].index >= GC::MAX_PLAYERS) return false;
+    }
+    return true;
+}
+
+static bool valid_rows(const Bullet* bullets, uint64_t count) {
+    // Owners are player slots too
+    for (uint64_t i = 0; i < count; i++) {
+        if (bullets[i].getOwner() < 0 || bullets[i].getOwner() >= GC::MAX_PLAYERS) return false;
+    }
+    return true;
+}
+
+// Saving and loading the section for the archetype made of exactly Cs
+template <typename... Cs>
+struct SectionIO {
+    static_assert(sizeof...(Cs) < SNAPSHOT_MAX_COLUMNS, "too many components for a snapshot section");
+
+    // Fill in where each of the section's arrays goes, starting at offset, and move offset past them
+    static void Plan(Archetype* a, SnapshotSection& section, size_t& offset, const SnapshotFilter* filter) {
+        const size_t sizes[] = {sizeof(Entity), sizeof(Cs)...};
+	section.count = a->getCount();
+	if (filter) {
+	    section.count = 0;
+	    for (int c = 0; c < a->getNumChunks(); c++) {
+	        const Entity* entities = a->entities(c);
+		for (int r = 0; r < a->getChunkCount(c); r++) section.count += included(*filter, entities[r].index);
+	    }
+	}
+	for (size_t i = 0; i <= sizeof...(Cs); i++) {
+	    section.columns[i] = offset;
+	    offset = align64(offset + section.count * sizes[i]);
+	}
+    }
+
+    static void Write(Archetype* a, const SnapshotSection& section, std::byte* base, const SnapshotFilter* filter) {
+        if (filter) {
+	    writeFiltered(a, section, base, *filter);
+	} else {
+	    for (int c = 0; c < a->getNumChunks(); c++) {
+	        size_t row = (size_t)c * a->getChunkCapacity();
+		size_t n = a->getChunkCount(c);
+		std::memcpy(base + section.columns[0] + row * sizeof(Entity), a->entities(c), n * sizeof(Entity));
+		int col = 1;
+		(std::memcpy(base + section.columns[col++] + row * sizeof(Cs), a->template column<Cs>(c), n * sizeof(Cs)), ...);
+	    }
+	}
+
+	const size_t sizes[] = {sizeof(Entity), sizeof(Cs)...};
+	for (size_t i = 0; i <= sizeof...(Cs); i++) zero_padding(base, section.columns[i] + section.count * sizes[i]);
+    }
+
+    // Row by row, skipping the entities left out
+    static void writeFiltered(Archetype* a, const SnapshotSection& section, std::byte* base, const SnapshotFilter& filter) {
+        size_t row = 0;
+	for (int c = 0; c < a->getNumChunks(); c++) {
+	    const Entity* entities = a->entities(c);
+	    for (int r = 0; r < a->getChunkCount(c); r++) {
+	        uint32_t index = entities[r].index;
+		if (!included(filter, index)) continue;
+		std::memcpy(base + section.columns[0] + row * sizeof(Entity), &filter.handles[index], sizeof(Entity));
+		int col = 1;
+		(writeComponent<Cs>(base + section.columns[col++] + row * sizeof(Cs), a->template column<Cs>(c) + r, filter, index), ...);
+		row++;
+	    }
+	}
+    }
+
+    template <typename C>
+    static void writeComponent(std::byte* to, const C* from, const SnapshotFilter& filter, uint32_t index) {
+        bool replace = index < filter.replaceMotion.size() && filter.replaceMotion[index];
+	if constexpr (std::is_same_v<C, Position>) {
+	    if (replace) from = &filter.positions[index];
+	} else if constexpr (std::is_same_v<C, Velocity>) {
+	    if (replace) from = &filter.velocities[index];
+	}
+	std::memcpy(to, from, sizeof(C));
+    }
+
+    // True if every array of the section lies inside the snapshot
+    static bool Fits(const SnapshotSection& section, size_t size) {
+        const size_t sizes[] = {sizeof(Entity), sizeof(Cs)...};
+	for (size_t i = 0; i <= sizeof...(Cs); i++) {
+	    if (section.columns[i] % 64 != 0 || section.columns[i] > size) return false;
+	    if (section.count > (size - section.columns[i]) / sizes[i]) return false;
+	}
+	return true;
+    }
+
+    // True if every component of every row holds a value the game can use. The section has to
+    // fit
+    static bool Valid(const SnapshotSection& section, const std::byte* base) {
+        return valid(section, base, std::index_sequence_for<Cs...>());
+    }
+
+    template <size_t... Is>
+    static bool valid(const SnapshotSection& section, const std::byte* base, std::index_sequence<Is...>) {
+        return (valid_rows(reinterpret_cast<const Cs*>(base + section.columns[Is + 1]), section.count) && ...);
+    }
+
+    static void Read(Registry& registry, const SnapshotSection& section, const std::byte* base) {
+        read(registry, section, base, std::index_sequence_for<Cs...>());
+    }
+
+    template <size_t... Is>
+    static void read(Registry& registry, const SnapshotSection& section, const std::byte* base, std::index_sequence<Is...>) {
+        registry.RestoreRows<Cs...>((uint32_t)section.count, reinterpret_cast<const Entity*>(base + section.columns[0]), reinterpret_cast<const Cs*>(base + section.columns[Is + 1])...);
+    }
+};
+
+template <int... Ns>
+constexpr uint32_t num_sections(VertexCounts<Ns...>) { return 2 + sizeof...(Ns); }
+static constexpr uint32_t NUM_SECTIONS = num_sections(AsteroidVertexCounts());
+
+using PlayerSection = SectionIO<Player, PlayerInput, PlayerSlot>;
+using BulletSection = SectionIO<Position, Velocity, Bullet>;
+template <int N>
+using AsteroidSection = SectionIO<Position, Velocity, Asteroid, AsteroidShape<N>>;
+
+// Call f(section kind, vertex count, SectionIO type, archetype) for every archetype a snapshot holds
+template <typename F, int... Ns>
+static void for_each_section(Registry& registry, F&& f, VertexCounts<Ns...>) {
+    f(SECTION_PLAYERS, 0, PlayerSection(), registry.getArchetype<Player, PlayerInput, PlayerSlot>());
+    f(SECTION_BULLETS, 0, BulletSection(), registry.getArchetype<Position, Velocity, Bullet>());
+    (f(SECTION_ASTEROIDS, Ns, AsteroidSection<Ns>(), registry.getArchetype<Position, Velocity, Asteroid, AsteroidShape<Ns>>()), ...);
+}
+
+// Call f(SectionIO type) for the section's archetype. Returns false if this build has no such archetype
+template <typename F>
+static bool with_section_type(const SnapshotSection& section, F&& f) {
+    switch (section.kind) {
+        case SECTION_PLAYERS:
+	    f(PlayerSection());
+	    return true;
+	case SECTION_BULLETS:
+	    f(BulletSection());
+	    return true;
+	case SECTION_ASTEROIDS: {
+	    bool found = false;
+	    dispatch_vertex_count((int)section.numVertices, [&](auto n) {
+	        constexpr int N = decltype(n)::value;
+		if (N != (int)section.numVertices) return;
+		f(AsteroidSection<N>());
+		found = true;
+	    });
+	    return found;
+	}
+    }
+    return false;
+}
+
+void init_snapshot_header(SnapshotHeader& header) {
+    std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = SNAPSHOT_VERSION;
+    header.byteOrder = SNAPSHOT_BYTE_ORDER;
+    layout_sizes(header.layout);
+}
+
+void save_snapshot(World& world, std::vector<std::byte>& buffer, const SnapshotFilter* filter) {
+    Registry& registry = world.registry;
+    GameState& state = world.state;
+
+    SnapshotHeader header = SnapshotHeader();
+    init_snapshot_header(header);
+    header.worldWidth = world.width;
+    header.worldHeight = world.height;
+    header.bulletFramesPerSpawn = world.bulletFramesPerSpawn;
+    header.level = state.level;
+    header.score = state.score;
+    header.status = state.status;
+    header.mode = world.mode;
+    header.loser = state.loser;
+    header.seed = state.seed;
+    header.tick = state.tick;
+    header.rng = state.gen;
+    header.numSlots = filter ? (uint32_t)filter->generations.size() : registry.getNumSlots();
+    header.numFree = (uint32_t)(filter ? filter->freeIndices.size() : registry.getFreeIndices().size());
+
+    // Work out where everything goes
+    SnapshotSection sections[NUM_SECTIONS] = {};
+    header.numSections = NUM_SECTIONS;
+    size_t offset = align64(sizeof(SnapshotHeader));
+    header.sectionsOffset = offset;
+    offset = align64(offset + header.numSections * sizeof(SnapshotSection));
+    header.generationsOffset = offset;
+    offset = align64(offset + header.numSlots * sizeof(uint32_t));
+    header.freeIndicesOffset = offset;
+    offset = align64(offset + header.numFree * sizeof(uint32_t));
+
+    uint32_t i = 0;
+    for_each_section(registry, [&](uint32_t kind, int numVertices, auto io, Archetype* a) {
+        SnapshotSection& section = sections[i++];
+	section = SnapshotSection{kind, (uint32_t)numVertices, 0, {}};
+	io.Plan(a, section, offset, filter);
+    }, AsteroidVertexCounts());
+    header.totalBytes = offset;
+
+    // Then copy it all in
+    buffer.resize(header.totalBytes);
+    std::byte* base = buffer.data();
+    std::memcpy(base, &header, sizeof(header));
+    zero_padding(base, sizeof(header));
+    std::memcpy(base + header.sectionsOffset, sections, header.numSections * sizeof(SnapshotSection));
+    zero_padding(base, header.sectionsOffset + header.numSections * sizeof(SnapshotSection));
+    uint32_t* generations = reinterpret_cast<uint32_t*>(base + header.generationsOffset);
+    if (filter) {
+        if (header.numSlots > 0) std::memcpy(generations, filter->generations.data(), header.numSlots * sizeof(uint32_t));
+    } else {
+        for (uint32_t slot = 0; slot < header.numSlots; slot++) generations[slot] = registry.getGeneration(slot);
+    }
+    zero_padding(base, header.generationsOffset + header.numSlots * sizeof(uint32_t));
+    const std::vector<uint32_t>& freeIndices = filter ? filter->freeIndices : registry.getFreeIndices();
+    if (header.numFree > 0) std::memcpy(base + header.freeIndicesOffset, freeIndices.data(), header.numFree * sizeof(uint32_t));
+    zero_padding(base, header.freeIndicesOffset + header.numFree * sizeof(uint32_t));
+
+    i = 0;
+    for_each_section(registry, [&](uint32_t, int, auto io, Archetype* a) { io.Write(a, sections[i++], base, filter); }, AsteroidVertexCounts());
+}
+
+static bool fail(const char* why) {
+    std::cerr << "snapshot: " << why << std::endl;
+    return false;
+}
+
+bool load_snapshot(World& world, const std::byte* data, size_t size) {
+    // Everything is checked before the world is touched
+    if (size < sizeof(SnapshotHeader)) return fail("too small to be a snapshot");
+    if (reinterpret_cast<uintptr_t>(data) % alignof(SnapshotHeader) != 0) return fail("data isn't aligned");
+
+    SnapshotHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic)) != 0) return fail("not a snapshot");
+    if (header.byteOrder != SNAPSHOT_BYTE_ORDER) return fail("written on a machine with a different byte order");
+    if (header.version != SNAPSHOT_VERSION) return fail("written by a different version of the game");
+    uint32_t layout[8];
+    layout_sizes(layout);
+    if (std::memcmp(header.layout, layout, sizeof(layout)) != 0) return fail("written by a build with different component layouts");
+    if (header.totalBytes != size) return fail("truncated");
+    if (header.worldWidth <= 0 || header.worldHeight <= 0 || header.worldWidth > GC::MAX_ARENA_SIZE || header.worldHeight > GC::MAX_ARENA_SIZE) return fail("bad arena size");
+    if (header.status < MENU || header.status > GAME_OVER || header.mode < COOP || header.mode > VERSUS) return fail("bad game state");
+
+    // Header-sized tables
+    if (header.sectionsOffset > size || header.numSections > (size - header.sectionsOffset) / sizeof(SnapshotSection)) return fail("truncated");
+    if (header.generationsOffset > size || header.numSlots > (size - header.generationsOffset) / sizeof(uint32_t)) return fail("truncated");
+    if (header.freeIndicesOffset > size || header.numFree > (size - header.freeIndicesOffset) / sizeof(uint32_t)) return fail("truncated");
+    if (header.sectionsOffset % 64 != 0 || header.generationsOffset % 64 != 0 || header.freeIndicesOffset % 64 != 0) return fail("misaligned table");
+
+    const SnapshotSection* sections = reinterpret_cast<const SnapshotSection*>(data + header.sectionsOffset);
+    const uint32_t* generations = reinterpret_cast<const uint32_t*>(data + header.generationsOffset);
+    const uint32_t* freeIndices = reinterpret_cast<const uint32_t*>(data + header.freeIndicesOffset);
+
+    // Every slot has to be free or hold an entity, and only once
+    std::vector<bool> used(header.numSlots);
+    for (uint32_t i = 0; i < header.numFree; i++) {
+        if (freeIndices[i] >= header.numSlots || used[freeIndices[i]]) return fail("bad free list");
+	used[freeIndices[i]] = true;
+    }
+
+    // Every section must be one this build knows, lie inside the data, only hold handles
+    // that agree with the saved generations and aren't anywhere else, and only hold
+    // components the game can use
+    uint64_t numEntities = 0;
+    for (uint32_t s = 0; s < header.numSections; s++) {
+        const SnapshotSection& section = sections[s];
+	bool fits = false;
+	bool valid = false;
+	bool known = with_section_type(section, [&](auto io) {
+	    fits = io.Fits(section, size);
+	    valid = fits && io.Valid(section, data);
+	});
+	if (!known) return fail("unknown section");
+	if (!fits) return fail("section runs past the end");
+	if (!valid) return fail("bad component value");
+
+	const Entity* handles = reinterpret_cast<const Entity*>(data + section.columns[0]);
+	for (uint64_t i = 0; i < section.count; i++) {
+	    if (handles[i].index >= header.numSlots || handles[i].generation != generations[handles[i].index] || used[handles[i].index]) return fail("bad entity handle");
+	    used[handles[i].index] = true;
+	}
+	numEntities += section.count;
+    }
+    if (numEntities + header.numFree != header.numSlots) return fail("entity count doesn't match the free list");
+
+    // Good to load
+    if (world.width != header.worldWidth || world.height != header.worldHeight) {
+        world.width = header.worldWidth;
+	world.height = header.worldHeight;
+	world.grid = SpatialGrid(world.width, world.height, GC::GRID_CELL_SIZE);
+    }
+    world.bulletFramesPerSpawn = header.bulletFramesPerSpawn;
+    world.mode = (GameMode)header.mode;
+
+    GameState& state = world.state;
+    state.level = header.level;
+    state.score = header.score;
+    state.status = (GameStatus)header.status;
+    state.loser = header.loser;
+    state.seed = header.seed;
+    state.tick = header.tick;
+    state.gen = header.rng;
+
+    world.registry.RestoreHandles(generations, header.numSlots, freeIndices, header.numFree);
+    for (uint32_t s = 0; s < header.numSections; s++) {
+        with_section_type(sections[s], [&](auto io) { io.Read(world.registry, sections[s], data); });
+    }
+    if (world.particles) world.particles->Clear();
+    // Bots and the lookahead search find asteroids through the broadphase, which would
+    // otherwise still be whatever the world held before
+    rebuild_broadphase(world);
+    return true;
+}
+
+uint64_t snapshot_checksum(const std::byte* data, size_t size) {
+    // Eight bytes at a time, each word mixed in with a multiply and shift
+    const uint64_t prime = 0x9e3779b97f4a7c15ull;
+    uint64_t hash = size * prime;
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+	std::memcpy(&word, data + i, sizeof(word));
+	hash = (hash ^ word) * prime;
+	hash ^= hash >> 29;
+    }
+    for (; i < size; i++) hash = (hash ^ (uint64_t)data[i]) * prime;
+    return hash ^ (hash >> 32);
+}
+
+bool save_snapshot_file(World& world, const std::string& path) {
+    std::vector<std::byte> buffer;
+    save_snapshot(world, buffer);
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+    if (!file) {
+        std::cerr << "snapshot: can't write " << path << std::endl;
+	return false;
+    }
+    return true;
+}
+
+#ifndef _WIN32
+
+bool load_snapshot_file(World& world, const std::string& path) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "snapshot: can't open " << path << std::endl;
+	return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        close(fd);
+	std::cerr << "snapshot: " << path << " is empty" << std::endl;
+	return false;
+    }
+
+    // The pages are read in as the load copies out of them, so there's no separate read pass
+    size_t size = info.st_size;
+    void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        std::cerr << "snapshot: can't map " << path << std::endl;
+	return false;
+    }
+    madvise(mapped, size, MADV_SEQUENTIAL);
+
+    bool loaded = load_snapshot(world, static_cast<const std::byte*>(mapped), size);
+    munmap(mapped, size);
+    return loaded;
+}
+
+#else
+
+// No mmap here. Read the whole file instead
+bool load_snapshot_file(World& world, const std::string& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        std::cerr << "snapshot: can't open " << path << std::endl;
+	return false;
+    }
+    std::vector<std::byte> buffer((size_t)file.tellg());
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(buffer.data()), buffer.size());
+    if (!file) {
+        std::cerr << "snapshot: can't read " << path << std::endl;
+	return false;
+    }
+    return load_snapshot(world, buffer.data(), buffer.size());
+}
+
+#endif
@@ -0,0 +1,123 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "rng.h"
+#include "components.h"
+#include "ecs.h"
+
+struct World;
+
+// Binary save state holding everything needed to carry on a game exactly where it left off:
+// the game state, the random number generator, the registry's entity handles and every
+// entity's components.
+//
+// The layout is flat. A header is followed by sections, one per archetype, and each section
+// is a handful of arrays laid out exactly as the components are in memory: the entity handles,
+// then one array per component type. Loading a snapshot is a bounds check followed by memcpys
+// straight into the registry's chunks, so a snapshot file can be mapped into memory and loaded
+// without any parsing. The flip side is that a snapshot is only readable by a build with the
+// same component layouts and byte order, which the header records and checks.
+//
+//     SnapshotHeader
+//     SnapshotSection[numSections]
+//     uint32_t generations[numSlots]
+//     uint32_t freeIndices[numFree]
+//     section 0: Entity[count], then one array per component
+//     section 1: ...
+//
+// Every array starts on a 64-byte boundary. Offsets are in bytes from the start of the snapshot
+
+static constexpr char SNAPSHOT_MAGIC[8] = {'A', 'S', 'T', 'S', 'N', 'A', 'P', '\0'};
+// Bump whenever the layout of the snapshot or of any saved component changes
+static constexpr uint32_t SNAPSHOT_VERSION = 2;
+static constexpr uint32_t SNAPSHOT_BYTE_ORDER = 0x01020304;
+static constexpr int SNAPSHOT_MAX_COLUMNS = 5;
+
+enum SnapshotSectionKind : uint32_t {
+    SECTION_PLAYERS,   // Player, PlayerInput, PlayerSlot
+    SECTION_BULLETS,   // Position, Velocity, Bullet
+    SECTION_ASTEROIDS  // Position, Velocity, Asteroid, AsteroidShape<numVertices>
+};
+
+struct SnapshotSection {
+    uint32_t kind;
+    uint32_t numVertices; // asteroid sections only
+    uint64_t count;
+    // columns[0] is the entity handles, the rest the components in the order listed above
+    uint64_t columns[SNAPSHOT_MAX_COLUMNS];
+};
+
+struct SnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    // sizeof(Entity, Player, PlayerInput, PlayerSlot, Position, Velocity, Bullet, Asteroid) in
+    // the build that wrote the snapshot
+    uint32_t layout[8];
+    uint32_t numSections;
+    uint64_t totalBytes;
+
+    // World and game state
+    int32_t worldWidth;
+    int32_t worldHeight;
+    int32_t bulletFramesPerSpawn;
+    int32_t level;
+    int32_t score;
+    int32_t status;
+    int32_t mode;
+    int32_t loser;
+    uint32_t seed;
+    uint32_t numSlots;
+    uint32_t numFree;
+    uint64_t tick;
+    Pcg32 rng;
+
+    uint64_t sectionsOffset;
+    uint64_t generationsOffset;
+    uint64_t freeIndicesOffset;
+};
+
+// Fill in the magic, version, byte order and layout for this build. The header should be
+// value-initialised (SnapshotHeader header = SnapshotHeader()), which zeroes its padding too, so
+// the padding doesn't carry junk into the file
+void init_snapshot_header(SnapshotHeader& header);
+
+// Which entities a snapshot holds, for a client that's only told about some of the world (see
+// interest.h). The snapshot has handles and a slot table of its own, sized to what the client
+// is told about rather than to the world
+struct SnapshotFilter {
+    // By entity slot in the world: the entity's handle in the snapshot, or NULL_ENTITY to leave
+    // it out. Slots past the end are left out
+    std::vector<Entity> handles;
+    // An asteroid or bullet with replaceMotion set is saved with positions[its slot] and
+    // velocities[its slot] rather than its own
+    std::vector<uint8_t> replaceMotion;
+    std::vector<Position> positions;
+    std::vector<Velocity> velocities;
+    // The snapshot's generations table and free list. Every slot not free has to be the handle
+    // of an entity included
+    std::vector<uint32_t> generations;
+    std::vector<uint32_t> freeIndices;
+};
+
+// Serialise the world into buffer, replacing what was there. The buffer's capacity is reused,
+// so snapshotting into the same buffer every frame stops allocating once it has grown. With a
+// filter, only the entities it includes are saved
+void save_snapshot(World& world, std::vector<std::byte>& buffer, const SnapshotFilter* filter = nullptr);
+// Replace the world's state with a snapshot. Returns false, leaving the world untouched, and
+// prints why if the data isn't a snapshot this build can read
+bool load_snapshot(World& world, const std::byte* data, size_t size);
+
+// 64-bit hash of a snapshot's bytes. Two worlds that have simulated the same game give the same
+// checksum, so peers can compare them to catch a desync
+uint64_t snapshot_checksum(const std::byte* data, size_t size);
+
+bool save_snapshot_file(World& world, const std::string& path);
+// Maps the file into memory and loads it from there
+bool load_snapshot_file(World& world, const std::string& path);
+
+#endif // SNAPSHOT_H
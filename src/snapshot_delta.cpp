@@ -0,0 +1,580 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include "snapshot_delta.h"
+#include "bit_stream.h"
+#include "world.h"
+
+static constexpr uint32_t DELTA_MAGIC = 0xd17a;
+static constexpr uint32_t DELTA_VERSION = 3;
+static constexpr uint32_t NO_ROW = UINT32_MAX;
+// Most sections a delta can describe
+static constexpr uint32_t MAX_SECTIONS = 64;
+// Past this many ticks prediction gives up and predicts no movement, to keep the cost of
+// replaying the float additions bounded
+static constexpr int64_t MAX_PREDICTION_TICKS = 4096;
+
+enum RunTag { RUN_END, RUN_COPY, RUN_NEW };
+
+enum ColumnKind { COLUMN_RAW, COLUMN_POSITION, COLUMN_VELOCITY };
+
+struct ColumnLayout {
+    ColumnKind kind;
+    uint32_t size;
+};
+
+// What each component column of a section holds
+struct SectionLayout {
+    int numColumns = 0;
+    ColumnLayout columns[SNAPSHOT_MAX_COLUMNS - 1];
+    int positionColumn = -1;
+    int velocityColumn = -1;
+};
+
+static bool section_layout(uint32_t kind, uint32_t numVertices, SectionLayout& layout) {
+    auto add = [&](ColumnKind columnKind, uint32_t size) {
+        if (columnKind == COLUMN_POSITION) layout.positionColumn = layout.numColumns;
+	if (columnKind == COLUMN_VELOCITY) layout.velocityColumn = layout.numColumns;
+	layout.columns[layout.numColumns++] = {columnKind, size};
+    };
+
+    switch (kind) {
+        case SECTION_PLAYERS:
+	    add(COLUMN_RAW, sizeof(Player));
+	    add(COLUMN_RAW, sizeof(PlayerInput));
+	    add(COLUMN_RAW, sizeof(PlayerSlot));
+	    return true;
+	case SECTION_BULLETS:
+	    add(COLUMN_POSITION, sizeof(Position));
+	    add(COLUMN_VELOCITY, sizeof(Velocity));
+	    add(COLUMN_RAW, sizeof(Bullet));
+	    return true;
+	case SECTION_ASTEROIDS: {
+	    uint32_t shapeSize = 0;
+	    dispatch_vertex_count((int)numVertices, [&](auto n) {
+	        constexpr int N = decltype(n)::value;
+		if (N == (int)numVertices) shapeSize = sizeof(AsteroidShape<N>);
+	    });
+	    if (shapeSize == 0) return false;
+	    add(COLUMN_POSITION, sizeof(Position));
+	    add(COLUMN_VELOCITY, sizeof(Velocity));
+	    add(COLUMN_RAW, sizeof(Asteroid));
+	    add(COLUMN_RAW, shapeSize);
+	    return true;
+	}
+    }
+    return false;
+}
+
+// Pointers into a snapshot. An empty snapshot has no sections and no entity slots
+struct SnapshotView {
+    SnapshotHeader header;
+    const std::byte* base = nullptr;
+    const SnapshotSection* sections = nullptr;
+    const uint32_t* generations = nullptr;
+    const uint32_t* freeIndices = nullptr;
+
+    SnapshotView(const std::byte* data, size_t size) : header() {
+        init_snapshot_header(header);
+	if (size == 0) return;
+	std::memcpy(&header, data, sizeof(header));
+	base = data;
+	sections = reinterpret_cast<const SnapshotSection*>(data + header.sectionsOffset);
+	generations = reinterpret_cast<const uint32_t*>(data + header.generationsOffset);
+	freeIndices = reinterpret_cast<const uint32_t*>(data + header.freeIndicesOffset);
+    }
+
+    const Entity* handles(uint32_t s) const { return reinterpret_cast<const Entity*>(base + sections[s].columns[0]); }
+    const std::byte* column(uint32_t s, int c) const { return base + sections[s].columns[c + 1]; }
+
+    // The section holding the same archetype as section, or -1
+    int find(const SnapshotSection& section) const {
+        for (uint32_t s = 0; s < header.numSections; s++) {
+	    if (sections[s].kind == section.kind && sections[s].numVertices == section.numVertices) return (int)s;
+	}
+	return -1;
+    }
+};
+
+static size_t align64(size_t v) { return (v + 63) & ~(size_t)63; }
+static void zero_padding(std::byte* base, size_t end) { std::memset(base + end, 0, align64(end) - end); }
+
+static int64_t quantise(float v, float step) { return std::llround((double)v / step); }
+static float dequantise(int64_t q, float step) { return (float)(q * (double)step); }
+
+// Where the reference predicts a position will be after ticks. Repeats the simulation's own float
+// additions, so anything that has flown straight is predicted exactly. A reference later than
+// the snapshot (see rewind.h) has them undone instead, which is almost always exact too
+static float predict_position(float position, float velocity, int64_t ticks) {
+    if (ticks == 0 || ticks > MAX_PREDICTION_TICKS || ticks < -MAX_PREDICTION_TICKS) return position;
+    for (int64_t t = 0; t < ticks; t++) position += velocity;
+    for (int64_t t = 0; t > ticks; t--) position -= velocity;
+    return position;
+}
+
+// Everything the encoder needs to know about one component of one entity
+struct ColumnDelta {
+    bool changed;
+    int64_t residual[2];
+};
+
+// Compare one component of a row with what the reference predicts for it
+static ColumnDelta diff_column(const ColumnLayout& column, const std::byte* current, const std::byte* reference, const Velocity* referenceVelocity, int64_t ticks, const DeltaPrecision& p) {
+    ColumnDelta delta = {false, {0, 0}};
+    if (column.kind == COLUMN_RAW) {
+        delta.changed = std::memcmp(current, reference, column.size) != 0;
+	return delta;
+    }
+
+    float cur[2], ref[2];
+    std::memcpy(cur, current, sizeof(cur));
+    std::memcpy(ref, reference, sizeof(ref));
+    float velocity[2] = {0, 0};
+    if (column.kind == COLUMN_POSITION && referenceVelocity) {
+        velocity[0] = referenceVelocity->x;
+	velocity[1] = referenceVelocity->y;
+    }
+
+    float step = column.kind == COLUMN_POSITION ? p.position : p.velocity;
+    for (int axis = 0; axis < 2; axis++) {
+        float predicted = column.kind == COLUMN_POSITION ? predict_position(ref[axis], velocity[axis], ticks) : ref[axis];
+	if (step > 0) {
+	    // Within half a step of the prediction is as close as quantising would get anyway
+	    delta.residual[axis] = quantise(cur[axis] - predicted, step);
+	    delta.changed |= delta.residual[axis] != 0;
+	} else {
+	    delta.changed |= float_bits(cur[axis]) != float_bits(predicted);
+	}
+    }
+    return delta;
+}
+
+static void write_column_delta(BitWriter& w, const ColumnLayout& column, const ColumnDelta& delta, const std::byte* current, float step) {
+    if (column.kind == COLUMN_RAW) {
+        w.WriteBytes(current, column.size);
+	return;
+    }
+    float cur[2];
+    std::memcpy(cur, current, sizeof(cur));
+    for (int axis = 0; axis < 2; axis++) {
+        if (step > 0) w.WriteSigned(delta.residual[axis]);
+	else w.Write(float_bits(cur[axis]), 32);
+    }
+}
+
+// A component of an entity that isn't in the reference
+static void write_column_full(BitWriter& w, const ColumnLayout& column, const std::byte* current, float step) {
+    if (column.kind == COLUMN_RAW) {
+        w.WriteBytes(current, column.size);
+	return;
+    }
+    float cur[2];
+    std::memcpy(cur, current, sizeof(cur));
+    for (int axis = 0; axis < 2; axis++) {
+        if (step > 0) w.WriteSigned(quantise(cur[axis], step));
+	else w.Write(float_bits(cur[axis]), 32);
+    }
+}
+
+static float column_step(const ColumnLayout& column, const DeltaPrecision& p) {
+    return column.kind == COLUMN_POSITION ? p.position : p.velocity;
+}
+
+static void write_int32_field(BitWriter& w, int64_t current, int64_t reference) {
+    w.WriteBit(current != reference);
+    if (current != reference) w.Write((uint32_t)current, 32);
+}
+
+void SnapshotDeltaCodec::Encode(const std::byte* reference, size_t referenceSize, const std::byte* current, size_t currentSize, std::vector<uint8_t>& out, std::vector<std::byte>* reconstructed) {
+    SnapshotView ref(reference, referenceSize);
+    SnapshotView cur(current, currentSize);
+    const SnapshotHeader& rh = ref.header;
+    const SnapshotHeader& ch = cur.header;
+    stats = DeltaStats();
+
+    BitWriter w(out);
+    w.Write(DELTA_MAGIC, 16);
+    w.Write(DELTA_VERSION, 8);
+    w.WriteBit(referenceSize > 0);
+    if (referenceSize > 0) w.Write(rh.tick, 64);
+    w.Write(float_bits(precision.position), 32);
+    w.Write(float_bits(precision.velocity), 32);
+
+    // Game state
+    int64_t ticks = (int64_t)(ch.tick - rh.tick);
+    w.WriteSigned(ticks);
+    write_int32_field(w, ch.worldWidth, rh.worldWidth);
+    write_int32_field(w, ch.worldHeight, rh.worldHeight);
+    write_int32_field(w, ch.bulletFramesPerSpawn, rh.bulletFramesPerSpawn);
+    write_int32_field(w, ch.level, rh.level);
+    write_int32_field(w, ch.score, rh.score);
+    write_int32_field(w, ch.status, rh.status);
+    write_int32_field(w, ch.mode, rh.mode);
+    write_int32_field(w, ch.loser, rh.loser);
+    write_int32_field(w, ch.seed, rh.seed);
+    bool rngChanged = ch.rng != rh.rng;
+    w.WriteBit(rngChanged);
+    if (rngChanged) {
+        w.Write(ch.rng.state, 64);
+	w.Write(ch.rng.inc, 64);
+    }
+
+    // Sizes, so the decoder can lay out the whole snapshot before filling it in
+    w.WriteGolomb(ch.numSlots);
+    w.WriteGolomb(ch.numFree);
+    w.WriteGolomb(ch.numSections);
+    for (uint32_t s = 0; s < ch.numSections; s++) {
+        w.WriteGolomb(cur.sections[s].kind);
+	w.WriteGolomb(cur.sections[s].numVertices);
+	w.WriteGolomb(cur.sections[s].count);
+    }
+
+    // Generations: the slots that changed, then the new slots
+    uint32_t sharedSlots = std::min(ch.numSlots, rh.numSlots);
+    int64_t lastSlot = -1;
+    for (uint32_t slot = 0; slot < sharedSlots; slot++) {
+        if (cur.generations[slot] == ref.generations[slot]) continue;
+	w.WriteGolomb(slot - lastSlot);
+	w.WriteSigned((int64_t)cur.generations[slot] - ref.generations[slot]);
+	lastSlot = slot;
+    }
+    w.WriteGolomb(0);
+    for (uint32_t slot = sharedSlots; slot < ch.numSlots; slot++) w.WriteGolomb(cur.generations[slot]);
+
+    // The free list is a stack, so between nearby snapshots it mostly keeps its bottom
+    uint32_t sharedFree = 0;
+    while (sharedFree < ch.numFree && sharedFree < rh.numFree && cur.freeIndices[sharedFree] == ref.freeIndices[sharedFree]) sharedFree++;
+    w.WriteGolomb(sharedFree);
+    for (uint32_t i = sharedFree; i < ch.numFree; i++) w.WriteGolomb(cur.freeIndices[i]);
+
+    // Where every entity of the reference lives
+    referenceRow.assign(rh.numSlots, NO_ROW);
+    referenceSection.resize(rh.numSlots);
+    for (uint32_t s = 0; s < rh.numSections; s++) {
+        const Entity* handles = ref.handles(s);
+	for (uint32_t row = 0; row < ref.sections[s].count; row++) {
+	    referenceRow[handles[row].index] = row;
+	    referenceSection[handles[row].index] = (uint8_t)s;
+	}
+    }
+
+    for (uint32_t s = 0; s < ch.numSections; s++) {
+        const SnapshotSection& section = cur.sections[s];
+	SectionLayout layout;
+	section_layout(section.kind, section.numVertices, layout);
+	int rs = ref.find(section);
+	uint32_t count = (uint32_t)section.count;
+	const Entity* handles = cur.handles(s);
+	stats.entities += count;
+
+	// Match each row with the same entity in the reference
+	rowSource.resize(count);
+	for (uint32_t row = 0; row < count; row++) {
+	    Entity e = handles[row];
+	    rowSource[row] = NO_ROW;
+	    if (rs < 0 || e.index >= rh.numSlots || referenceRow[e.index] == NO_ROW || referenceSection[e.index] != rs) continue;
+	    if (ref.handles(rs)[referenceRow[e.index]] == e) rowSource[row] = referenceRow[e.index];
+	}
+
+	// Row order, as runs of consecutive reference rows and runs of new entities
+	uint32_t expected = 0;
+	for (uint32_t row = 0; row < count;) {
+	    uint32_t length = 1;
+	    if (rowSource[row] != NO_ROW) {
+	        while (row + length < count && rowSource[row + length] == rowSource[row] + length) length++;
+		w.Write(RUN_COPY, 2);
+		w.WriteSigned((int64_t)rowSource[row] - expected);
+		expected = rowSource[row] + length;
+	    } else {
+	        while (row + length < count && rowSource[row + length] == NO_ROW) length++;
+		w.Write(RUN_NEW, 2);
+	    }
+	    w.WriteGolomb(length - 1);
+	    row += length;
+	}
+	w.Write(RUN_END, 2);
+
+	// Entities that aren't where the reference predicts
+	int64_t lastChanged = -1;
+	for (uint32_t row = 0; row < count; row++) {
+	    uint32_t source = rowSource[row];
+	    if (source == NO_ROW) continue;
+
+	    const Velocity* referenceVelocity = nullptr;
+	    if (layout.velocityColumn >= 0) referenceVelocity = reinterpret_cast<const Velocity*>(ref.column(rs, layout.velocityColumn)) + source;
+
+	    ColumnDelta deltas[SNAPSHOT_MAX_COLUMNS - 1];
+	    uint32_t mask = 0;
+	    for (int c = 0; c < layout.numColumns; c++) {
+	        uint32_t size = layout.columns[c].size;
+		deltas[c] = diff_column(layout.columns[c], cur.column(s, c) + (size_t)row * size, ref.column(rs, c) + (size_t)source * size, referenceVelocity, ticks, precision);
+		if (deltas[c].changed) mask |= 1u << c;
+	    }
+	    if (mask == 0) {
+	        stats.unchanged++;
+		continue;
+	    }
+
+	    stats.changed++;
+	    w.WriteGolomb(row - lastChanged);
+	    lastChanged = row;
+	    w.Write(mask, layout.numColumns);
+	    for (int c = 0; c < layout.numColumns; c++) {
+	        if (!(mask & (1u << c))) continue;
+		uint32_t size = layout.columns[c].size;
+		write_column_delta(w, layout.columns[c], deltas[c], cur.column(s, c) + (size_t)row * size, column_step(layout.columns[c], precision));
+	    }
+	}
+	w.WriteGolomb(0);
+
+	// New entities in full
+	for (uint32_t row = 0; row < count; row++) {
+	    if (rowSource[row] != NO_ROW) continue;
+	    stats.added++;
+	    w.WriteGolomb(handles[row].index);
+	    for (int c = 0; c < layout.numColumns; c++) {
+	        uint32_t size = layout.columns[c].size;
+		write_column_full(w, layout.columns[c], cur.column(s, c) + (size_t)row * size, column_step(layout.columns[c], precision));
+	    }
+	}
+    }
+
+    w.Flush();
+    stats.bytes = out.size();
+
+    if (reconstructed) {
+        DeltaStats encodeStats = stats;
+	Decode(reference, referenceSize, out.data(), out.size(), *reconstructed);
+	stats = encodeStats;
+    }
+}
+
+static int64_t read_int32_field(BitReader& r, int64_t reference) {
+    if (!r.ReadBit()) return reference;
+    return (int32_t)r.Read(32);
+}
+
+bool SnapshotDeltaCodec::Decode(const std::byte* reference, size_t referenceSize, const uint8_t* delta, size_t deltaSize, std::vector<std::byte>& out) {
+    BitReader r(delta, deltaSize);
+    stats = DeltaStats();
+    stats.bytes = deltaSize;
+
+    if (r.Read(16) != DELTA_MAGIC || r.Read(8) != DELTA_VERSION) return false;
+    bool hasReference = r.ReadBit();
+    if (!hasReference) referenceSize = 0;
+    SnapshotView ref(reference, referenceSize);
+    const SnapshotHeader& rh = ref.header;
+    if (hasReference && (referenceSize == 0 || r.Read(64) != rh.tick)) return false;
+
+    DeltaPrecision p;
+    p.position = bits_float((uint32_t)r.Read(32));
+    p.velocity = bits_float((uint32_t)r.Read(32));
+    if (!(p.position >= 0 && p.velocity >= 0 && std::isfinite(p.position) && std::isfinite(p.velocity))) return false;
+
+    // Game state
+    SnapshotHeader header = SnapshotHeader();
+    init_snapshot_header(header);
+    int64_t ticks = r.ReadSigned();
+    header.tick = rh.tick + ticks;
+    header.worldWidth = (int32_t)read_int32_field(r, rh.worldWidth);
+    header.worldHeight = (int32_t)read_int32_field(r, rh.worldHeight);
+    header.bulletFramesPerSpawn = (int32_t)read_int32_field(r, rh.bulletFramesPerSpawn);
+    header.level = (int32_t)read_int32_field(r, rh.level);
+    header.score = (int32_t)read_int32_field(r, rh.score);
+    header.status = (int32_t)read_int32_field(r, rh.status);
+    header.mode = (int32_t)read_int32_field(r, rh.mode);
+    header.loser = (int32_t)read_int32_field(r, rh.loser);
+    header.seed = (uint32_t)read_int32_field(r, rh.seed);
+    header.rng = rh.rng;
+    if (r.ReadBit()) {
+        header.rng.state = r.Read(64);
+	header.rng.inc = r.Read(64);
+    }
+
+    // Sizes. Every entity or slot the reference doesn't have costs at least a bit, which
+    // bounds what a corrupt delta can ask for
+    uint64_t numSlots = r.ReadGolomb();
+    uint64_t numFree = r.ReadGolomb();
+    uint64_t numSections = r.ReadGolomb();
+    if (numSlots > rh.numSlots + r.getBitsLeft() || numFree > numSlots || numSections > MAX_SECTIONS) return false;
+    header.numSlots = (uint32_t)numSlots;
+    header.numFree = (uint32_t)numFree;
+    header.numSections = (uint32_t)numSections;
+
+    SnapshotSection sections[MAX_SECTIONS] = {};
+    SectionLayout layouts[MAX_SECTIONS];
+    for (uint32_t s = 0; s < header.numSections; s++) {
+        sections[s].kind = (uint32_t)r.ReadGolomb();
+	sections[s].numVertices = (uint32_t)r.ReadGolomb();
+	sections[s].count = r.ReadGolomb();
+	if (!section_layout(sections[s].kind, sections[s].numVertices, layouts[s])) return false;
+	int rs = ref.find(sections[s]);
+	uint64_t available = (rs >= 0 ? ref.sections[rs].count : 0) + r.getBitsLeft();
+	if (sections[s].count > available || sections[s].count > UINT32_MAX) return false;
+    }
+    if (!r.isGood()) return false;
+
+    // Lay the snapshot out the same way save_snapshot does
+    size_t offset = align64(sizeof(SnapshotHeader));
+    header.sectionsOffset = offset;
+    offset = align64(offset + header.numSections * sizeof(SnapshotSection));
+    header.generationsOffset = offset;
+    offset = align64(offset + header.numSlots * sizeof(uint32_t));
+    header.freeIndicesOffset = offset;
+    offset = align64(offset + header.numFree * sizeof(uint32_t));
+    for (uint32_t s = 0; s < header.numSections; s++) {
+        sections[s].columns[0] = offset;
+	offset = align64(offset + sections[s].count * sizeof(Entity));
+	for (int c = 0; c < layouts[s].numColumns; c++) {
+	    sections[s].columns[c + 1] = offset;
+	    offset = align64(offset + sections[s].count * layouts[s].columns[c].size);
+	}
+    }
+    header.totalBytes = offset;
+
+    out.resize(header.totalBytes);
+    std::byte* base = out.data();
+    // Padding is zeroed as save_snapshot does, so a lossless delta decodes to the very same bytes
+    std::memcpy(base, &header, sizeof(header));
+    zero_padding(base, sizeof(header));
+    std::memcpy(base + header.sectionsOffset, sections, header.numSections * sizeof(SnapshotSection));
+    zero_padding(base, header.sectionsOffset + header.numSections * sizeof(SnapshotSection));
+    zero_padding(base, header.generationsOffset + header.numSlots * sizeof(uint32_t));
+    zero_padding(base, header.freeIndicesOffset + header.numFree * sizeof(uint32_t));
+    for (uint32_t s = 0; s < header.numSections; s++) {
+        zero_padding(base, sections[s].columns[0] + sections[s].count * sizeof(Entity));
+	for (int c = 0; c < layouts[s].numColumns; c++) zero_padding(base, sections[s].columns[c + 1] + sections[s].count * layouts[s].columns[c].size);
+    }
+
+    // Generations
+    uint32_t* generations = reinterpret_cast<uint32_t*>(base + header.generationsOffset);
+    uint32_t sharedSlots = std::min(header.numSlots, rh.numSlots);
+    if (sharedSlots > 0) std::memcpy(generations, ref.generations, sharedSlots * sizeof(uint32_t));
+    for (int64_t slot = -1;;) {
+        uint64_t gap = r.ReadGolomb();
+	if (gap == 0) break;
+	slot += gap;
+	if (slot >= sharedSlots || !r.isGood()) return false;
+	generations[slot] = (uint32_t)(generations[slot] + r.ReadSigned());
+    }
+    for (uint32_t slot = sharedSlots; slot < header.numSlots; slot++) generations[slot] = (uint32_t)r.ReadGolomb();
+
+    // Free list
+    uint32_t* freeIndices = reinterpret_cast<uint32_t*>(base + header.freeIndicesOffset);
+    uint64_t sharedFree = r.ReadGolomb();
+    if (sharedFree > header.numFree || sharedFree > rh.numFree) return false;
+    if (sharedFree > 0) std::memcpy(freeIndices, ref.freeIndices, sharedFree * sizeof(uint32_t));
+    for (uint32_t i = (uint32_t)sharedFree; i < header.numFree; i++) freeIndices[i] = (uint32_t)r.ReadGolomb();
+    if (!r.isGood()) return false;
+
+    for (uint32_t s = 0; s < header.numSections; s++) {
+        const SnapshotSection& section = sections[s];
+	const SectionLayout& layout = layouts[s];
+	int rs = ref.find(section);
+	uint32_t count = (uint32_t)section.count;
+	uint32_t referenceCount = rs >= 0 ? (uint32_t)ref.sections[rs].count : 0;
+	Entity* handles = reinterpret_cast<Entity*>(base + section.columns[0]);
+	auto column = [&](int c, uint32_t row) { return base + section.columns[c + 1] + (size_t)row * layout.columns[c].size; };
+	stats.entities += count;
+	int changed = 0;
+	int added = 0;
+
+	// Row order. Entities carried over from the reference start out as copies of it
+	rowSource.resize(count);
+	uint32_t row = 0;
+	int64_t expected = 0;
+	for (;;) {
+	    uint32_t tag = (uint32_t)r.Read(2);
+	    if (tag == RUN_END) break;
+	    if (tag != RUN_COPY && tag != RUN_NEW) return false;
+
+	    int64_t start = tag == RUN_COPY ? expected + r.ReadSigned() : 0;
+	    uint64_t length = r.ReadGolomb() + 1;
+	    if (!r.isGood() || length > count - row) return false;
+	    if (tag == RUN_NEW) {
+	        std::fill(rowSource.begin() + row, rowSource.begin() + row + length, NO_ROW);
+		row += (uint32_t)length;
+		continue;
+	    }
+
+	    if (start < 0 || start + length > referenceCount) return false;
+	    std::memcpy(handles + row, ref.handles(rs) + start, length * sizeof(Entity));
+	    for (int c = 0; c < layout.numColumns; c++) {
+	        std::memcpy(column(c, row), ref.column(rs, c) + start * layout.columns[c].size, length * layout.columns[c].size);
+	    }
+	    for (uint32_t i = 0; i < length; i++) rowSource[row + i] = (uint32_t)(start + i);
+	    expected = start + length;
+	    row += (uint32_t)length;
+	}
+	if (row != count) return false;
+
+	// Move carried-over entities to where the reference predicts
+	for (row = 0; row < count; row++) {
+	    if (rowSource[row] == NO_ROW) continue;
+	    if (handles[row].index >= header.numSlots || handles[row].generation != generations[handles[row].index]) return false;
+
+	    if (layout.positionColumn >= 0) {
+	        float* position = reinterpret_cast<float*>(column(layout.positionColumn, row));
+		const float* velocity = layout.velocityColumn >= 0 ? reinterpret_cast<const float*>(column(layout.velocityColumn, row)) : nullptr;
+		for (int axis = 0; axis < 2; axis++) position[axis] = predict_position(position[axis], velocity ? velocity[axis] : 0, ticks);
+	    }
+	}
+
+	// Then apply the changes
+	int64_t changedRow = -1;
+	for (;;) {
+	    uint64_t gap = r.ReadGolomb();
+	    if (gap == 0) break;
+	    changedRow += gap;
+	    if (!r.isGood() || changedRow >= count || rowSource[changedRow] == NO_ROW) return false;
+	    changed++;
+
+	    uint32_t mask = (uint32_t)r.Read(layout.numColumns);
+	    for (int c = 0; c < layout.numColumns; c++) {
+	        if (!(mask & (1u << c))) continue;
+		const ColumnLayout& col = layout.columns[c];
+		std::byte* dest = column(c, (uint32_t)changedRow);
+		if (col.kind == COLUMN_RAW) {
+		    r.ReadBytes(dest, col.size);
+		    continue;
+		}
+
+		// The carried-over value is already the prediction, so the residual goes on top
+		float* value = reinterpret_cast<float*>(dest);
+		float step = column_step(col, p);
+		for (int axis = 0; axis < 2; axis++) {
+		    if (step > 0) value[axis] = (float)(value[axis] + r.ReadSigned() * (double)step);
+		    else value[axis] = bits_float((uint32_t)r.Read(32));
+		}
+	    }
+	}
+
+	// New entities
+	for (row = 0; row < count; row++) {
+	    if (rowSource[row] != NO_ROW) continue;
+	    added++;
+	    uint64_t index = r.ReadGolomb();
+	    if (!r.isGood() || index >= header.numSlots) return false;
+	    handles[row] = {(uint32_t)index, generations[index]};
+	    for (int c = 0; c < layout.numColumns; c++) {
+	        const ColumnLayout& col = layout.columns[c];
+		std::byte* dest = column(c, row);
+		if (col.kind == COLUMN_RAW) {
+		    r.ReadBytes(dest, col.size);
+		    continue;
+		}
+		float* value = reinterpret_cast<float*>(dest);
+		float step = column_step(col, p);
+		for (int axis = 0; axis < 2; axis++) {
+		    if (step > 0) value[axis] = dequantise(r.ReadSigned(), step);
+		    else value[axis] = bits_float((uint32_t)r.Read(32));
+		}
+	    }
+	}
+	stats.changed += changed;
+	stats.added += added;
+	stats.unchanged += count - added - changed;
+    }
+
+    return r.isGood();
+}
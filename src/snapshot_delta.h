@@ -0,0 +1,76 @@
+#ifndef SNAPSHOT_DELTA_H
+#define SNAPSHOT_DELTA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "snapshot.h"
+
+// Steps positions and velocities are rounded to when they're encoded, in pixels and pixels per
+// frame. A step of 0 sends the exact float
+struct DeltaPrecision {
+    float position = 1.0f / 16;
+    float velocity = 1.0f / 256;
+};
+
+// Exact positions and velocities, for deltas that have to rebuild the simulation bit for bit
+static constexpr DeltaPrecision LOSSLESS_PRECISION = {0, 0};
+
+// What the last Encode or Decode did
+struct DeltaStats {
+    int entities = 0;
+    // Entities whose components were all exactly what the reference predicts, so only their
+    // place in the row order was sent
+    int unchanged = 0;
+    int changed = 0;
+    // Entities that aren't in the reference and were sent in full
+    int added = 0;
+    size_t bytes = 0;
+};
+
+// Encodes a snapshot (see snapshot.h) as the difference from a reference snapshot, and rebuilds
+// the full snapshot from the reference and that difference.
+//
+// Entities are matched to the reference by handle. For each archetype the delta sends the row
+// order as runs of reference rows plus runs of new entities, then only the entities that differ
+// from what the reference predicts. An asteroid or bullet is predicted to have kept its velocity
+// and moved by it for however many ticks separate the two snapshots, whichever is the later,
+// so anything flying straight costs nothing. A position or velocity within half a step of its
+// prediction counts as unchanged; otherwise the difference is sent in whole steps as a zigzag
+// exponential-Golomb number, so decoded values are always within half a step of the truth.
+// Everything else is sent as raw bytes, only when it changes. New entities are sent in full,
+// with positions and velocities rounded to the steps. The game state, generations and free
+// list are sent as changes too.
+//
+// With lossy precision, decoding doesn't give back the exact snapshot that was encoded, so the
+// encoder has to work against the same reference the decoder has: the decoded snapshot, not
+// the original. Encode can hand that back so the sender needn't decode its own deltas.
+//
+// An empty reference (size 0) makes a self-contained delta, for a first frame or a keyframe.
+// The codec keeps its scratch buffers, so steady-state encoding and decoding don't allocate
+class SnapshotDeltaCodec {
+    public:
+	SnapshotDeltaCodec(DeltaPrecision p = DeltaPrecision()) : precision(p) {}
+
+	// Encode current against reference into out. Both must be valid snapshots. If
+	// reconstructed isn't null it's given the snapshot the decoder will rebuild
+	void Encode(const std::byte* reference, size_t referenceSize, const std::byte* current, size_t currentSize, std::vector<uint8_t>& out, std::vector<std::byte>* reconstructed = nullptr);
+	// Rebuild a snapshot into out from the reference the delta was encoded against. Returns
+	// false if the delta is corrupt or was made against a different reference
+	bool Decode(const std::byte* reference, size_t referenceSize, const uint8_t* delta, size_t deltaSize, std::vector<std::byte>& out);
+
+	const DeltaPrecision& getPrecision() const { return precision; }
+	void setPrecision(DeltaPrecision p) { precision = p; }
+	const DeltaStats& getStats() const { return stats; }
+    private:
+	DeltaPrecision precision;
+	DeltaStats stats;
+
+	// Reference row and section of each entity slot, for matching handles
+	std::vector<uint32_t> referenceRow;
+	std::vector<uint8_t> referenceSection;
+	// Per current row: the reference row it came from, or UINT32_MAX if it's new
+	std::vector<uint32_t> rowSource;
+};
+
+#endif // SNAPSHOT_DELTA_H
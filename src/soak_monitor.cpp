@@ -0,0 +1,116 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include "soak_monitor.h"
+#include "alloc_counter.h"
+#include "process_stats.h"
+
+bool check_soak_config(const SoakConfig& config) {
+    if (!(config.sampleSeconds > 0)) {
+        std::fprintf(stderr, "soak: the time between samples has to be more than 0 s, got %g\n", config.sampleSeconds);
+	return false;
+    }
+    // Samples are taken every sampleSeconds up to the end; those in the warmup don't count
+    double first = std::max(std::ceil(config.warmupSeconds / config.sampleSeconds), 1.0);
+    double last = std::floor(config.durationSeconds / config.sampleSeconds);
+    if (last - first + 1 < SOAK_MIN_SAMPLES) {
+        std::fprintf(stderr, "soak: %g s sampled every %g s after a %g s warmup gives fewer than %d samples to judge a trend from; it needs at least %g s\n",
+	    config.durationSeconds, config.sampleSeconds, config.warmupSeconds, SOAK_MIN_SAMPLES, (first + SOAK_MIN_SAMPLES - 1) * config.sampleSeconds);
+	return false;
+    }
+    return true;
+}
+
+SoakMonitor::SoakMonitor(const SoakConfig& conf) : config(conf), nextSampleAt(conf.sampleSeconds) {
+    samples.reserve((size_t)(config.durationSeconds / config.sampleSeconds) + 2);
+    lastAllocations = AllocCounter::getCount();
+    lastAllocatedBytes = AllocCounter::getBytes();
+}
+
+void SoakMonitor::RecordFrame(double frameSeconds) {
+    frameTimes.Record(frameSeconds);
+}
+
+void SoakMonitor::takeSample(double elapsedSeconds) {
+    SoakSample sample;
+    sample.elapsedSeconds = elapsedSeconds;
+    sample.rssBytes = current_rss_bytes();
+    sample.allocations = AllocCounter::getCount() - lastAllocations;
+    sample.allocatedBytes = AllocCounter::getBytes() - lastAllocatedBytes;
+    sample.frames = (int)frameTimes.getCount();
+    sample.p50Ms = frameTimes.PercentileMs(0.50);
+    sample.p99Ms = frameTimes.PercentileMs(0.99);
+    sample.maxMs = frameTimes.getMaxMs();
+    samples.push_back(sample);
+
+    std::printf("[soak] %7.0fs  rss %8.1f MiB  allocs %8llu (%9llu bytes)  frames %8d  p50 %8.3f ms  p99 %8.3f ms  max %8.3f ms\n",
+        sample.elapsedSeconds, sample.rssBytes / (1024.0 * 1024.0), (unsigned long long)sample.allocations, (unsigned long long)sample.allocatedBytes,
+	sample.frames, sample.p50Ms, sample.p99Ms, sample.maxMs);
+    std::fflush(stdout);
+
+    frameTimes.Clear();
+    lastAllocations = AllocCounter::getCount();
+    lastAllocatedBytes = AllocCounter::getBytes();
+}
+
+bool SoakMonitor::Update(double elapsedSeconds) {
+    if (elapsedSeconds >= nextSampleAt) {
+        takeSample(elapsedSeconds);
+	nextSampleAt += config.sampleSeconds;
+    }
+    return elapsedSeconds < config.durationSeconds;
+}
+
+// Least-squares fit of y against x, returning the fitted values at the first and last x
+static void fit_line(const std::vector<double>& x, const std::vector<double>& y, double& first, double& last) {
+    double n = x.size();
+    double meanX = 0, meanY = 0;
+    for (size_t i = 0; i < x.size(); i++) {
+        meanX += x[i] / n;
+	meanY += y[i] / n;
+    }
+    double covariance = 0, variance = 0;
+    for (size_t i = 0; i < x.size(); i++) {
+        covariance += (x[i] - meanX) * (y[i] - meanY);
+	variance += (x[i] - meanX) * (x[i] - meanX);
+    }
+    double slope = variance > 0 ? covariance / variance : 0;
+    first = meanY + slope * (x.front() - meanX);
+    last = meanY + slope * (x.back() - meanX);
+}
+
+bool SoakMonitor::Passed() const {
+    std::vector<double> times, rss, p99;
+    for (const auto& sample : samples) {
+        if (sample.elapsedSeconds < config.warmupSeconds) continue;
+	times.push_back(sample.elapsedSeconds);
+	rss.push_back(sample.rssBytes / (1024.0 * 1024.0));
+	p99.push_back(sample.p99Ms);
+    }
+
+    if ((int)times.size() < SOAK_MIN_SAMPLES) {
+        std::fprintf(stderr, "\n*** SOAK FAILED: only %zu samples after warmup, too few to judge a trend (need %d) ***\n\n", times.size(), SOAK_MIN_SAMPLES);
+	return false;
+    }
+
+    double rssStart, rssEnd, p99Start, p99End;
+    fit_line(times, rss, rssStart, rssEnd);
+    fit_line(times, p99, p99Start, p99End);
+
+    bool memoryOk = rssEnd - rssStart <= config.maxRssGrowthMiB;
+    bool p99Ok = p99End <= p99Start * config.maxP99GrowthRatio || p99End - p99Start < config.minP99GrowthMs;
+
+    std::printf("[soak] rss trend %.1f -> %.1f MiB (limit +%.1f MiB), p99 trend %.3f -> %.3f ms (limit x%.2f)\n",
+        rssStart, rssEnd, config.maxRssGrowthMiB, p99Start, p99End, config.maxP99GrowthRatio);
+
+    if (!memoryOk) {
+        std::fprintf(stderr, "\n*** SOAK FAILED: resident memory grew %.1f MiB over the run (limit %.1f MiB) ***\n\n", rssEnd - rssStart, config.maxRssGrowthMiB);
+    }
+    if (!p99Ok) {
+        std::fprintf(stderr, "\n*** SOAK FAILED: p99 frame time drifted from %.3f ms to %.3f ms (limit x%.2f) ***\n\n", p99Start, p99End, config.maxP99GrowthRatio);
+    }
+    if (memoryOk && p99Ok) std::printf("[soak] passed\n");
+    return memoryOk && p99Ok;
+}
+
+const std::vector<SoakSample>& SoakMonitor::getSamples() const { return samples; }
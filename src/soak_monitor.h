@@ -0,0 +1,72 @@
+#ifndef SOAKMONITOR_H
+#define SOAKMONITOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "latency_histogram.h"
+
+struct SoakConfig {
+    // How long to run for
+    double durationSeconds = 3600;
+    // Time between samples
+    double sampleSeconds = 60;
+    // Samples taken in the first warmupSeconds are reported but left out of the trend, while
+    // caches, pools and vectors grow to their working size
+    double warmupSeconds = 120;
+    // Fail if resident memory is trending up by more than this over the run
+    double maxRssGrowthMiB = 16;
+    // Fail if the trend in p99 frame time ends more than this many times higher than it started...
+    double maxP99GrowthRatio = 1.25;
+    // ...and by at least this many milliseconds, so tiny frame times don't trip it on noise
+    double minP99GrowthMs = 0.5;
+};
+
+// One row of the soak report
+struct SoakSample {
+    double elapsedSeconds;
+    size_t rssBytes;
+    uint64_t allocations; // during this interval
+    uint64_t allocatedBytes; // during this interval
+    int frames; // during this interval
+    double p50Ms;
+    double p99Ms;
+    double maxMs;
+};
+
+// Fewest samples after warmup that a trend is judged from
+static constexpr int SOAK_MIN_SAMPLES = 3;
+
+// Prints why to stderr and returns false if a run with config couldn't judge a trend: the time
+// between samples isn't positive, or the run is too short for SOAK_MIN_SAMPLES samples after
+// warmup
+bool check_soak_config(const SoakConfig& config);
+
+// Watches a long-running session for slow leaks and frame times that creep up. Feed it every
+// frame's time, call Update() once a frame, and Passed() at the end
+class SoakMonitor {
+    public:
+	SoakMonitor(const SoakConfig& conf);
+
+	void RecordFrame(double frameSeconds);
+	// Takes and prints a sample when one is due. Returns false once the duration is up
+	bool Update(double elapsedSeconds);
+	// Check the trends over the post-warmup samples, printing the verdict. Returns false (and
+	// prints loudly to stderr) if memory or p99 frame time is trending upward too much, or
+	// there were too few samples to tell
+	bool Passed() const;
+
+	const std::vector<SoakSample>& getSamples() const;
+    private:
+	void takeSample(double elapsedSeconds);
+
+	SoakConfig config;
+	std::vector<SoakSample> samples;
+	// Frame times since the last sample
+	LatencyHistogram frameTimes;
+	double nextSampleAt;
+	uint64_t lastAllocations;
+	uint64_t lastAllocatedBytes;
+};
+
+#endif // SOAKMONITOR_H
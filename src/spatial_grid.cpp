@@ -0,0 +1,15 @@
+#include <cmath>
+#include "spatial_grid.h"
+
+SpatialGrid::SpatialGrid(float worldW, float worldH, float cell) : invCellSize(1.0f / cell) {
+    numCellsX = std::max(1, (int)std::ceil(worldW / cell));
+    numCellsY = std::max(1, (int)std::ceil(worldH / cell));
+    numCells = numCellsX * numCellsY;
+    cellStart.assign(numCells + 1, 0);
+}
+
+int SpatialGrid::getNumItems() const { return (int)items.size(); }
+
+size_t SpatialGrid::getMemoryBytes() const {
+    return (cellStart.capacity() + items.capacity() + itemCells.capacity() + fillCursor.capacity()) * sizeof(int);
+}
@@ -0,0 +1,85 @@
+#ifndef SPATIALGRID_H
+#define SPATIALGRID_H
+
+#include <raylib-cpp.hpp>
+#include <algorithm>
+#include <vector>
+
+// Uniform grid broadphase over the play area. Items are bucketed by the cell containing their
+// centre and stored in one flat array sorted by cell (cellStart[c] .. cellStart[c + 1] are the
+// items in cell c), so a rebuild is two linear passes and a query only touches nearby cells.
+// Items outside the play area are clamped into the border cells. The grid is rebuilt every
+// tick and keeps its buffers between rebuilds, so it stops allocating once they have grown
+class SpatialGrid {
+    public:
+	SpatialGrid(float worldW, float worldH, float cell);
+
+	// Rebuild from n items, where positionOf(i) returns the centre of item i
+	template <typename PositionFn>
+	void Build(int n, PositionFn&& positionOf) {
+	    itemCells.resize(n);
+	    cellStart.assign(numCells + 1, 0);
+
+	    // Count the items in each cell
+	    for (int i = 0; i < n; i++) {
+	        int c = cellIndex(positionOf(i));
+		itemCells[i] = c;
+		cellStart[c + 1]++;
+	    }
+
+	    // Prefix sum so cellStart[c] is where cell c's items begin
+	    for (int c = 0; c < numCells; c++) cellStart[c + 1] += cellStart[c];
+
+	    // Scatter item indices into their cells' ranges
+	    fillCursor.assign(cellStart.begin(), cellStart.end() - 1);
+	    items.resize(n);
+	    for (int i = 0; i < n; i++) {
+	        items[fillCursor[itemCells[i]]++] = i;
+	    }
+	}
+
+	// Call visit(i) for every item whose centre may lie within radius of centre. Callers must
+	// still do their own exact test, and should include the largest item radius in radius
+	template <typename VisitFn>
+	void Query(Vector2 centre, float radius, VisitFn&& visit) const {
+	    int minX = cellCoord(centre.x - radius, numCellsX);
+	    int maxX = cellCoord(centre.x + radius, numCellsX);
+	    int minY = cellCoord(centre.y - radius, numCellsY);
+	    int maxY = cellCoord(centre.y + radius, numCellsY);
+
+	    for (int cy = minY; cy <= maxY; cy++) {
+	        for (int cx = minX; cx <= maxX; cx++) {
+		    int c = cy * numCellsX + cx;
+		    for (int k = cellStart[c]; k < cellStart[c + 1]; k++) {
+		        visit(items[k]);
+		    }
+		}
+	    }
+	}
+
+	int getNumItems() const;
+	// Bytes held by the grid's buffers
+	size_t getMemoryBytes() const;
+    private:
+	int cellCoord(float v, int numCellsAxis) const {
+	    int c = (int)(v * invCellSize);
+	    if (v < 0) c = 0;
+	    return std::min(c, numCellsAxis - 1);
+	}
+
+	int cellIndex(Vector2 pos) const {
+	    return cellCoord(pos.y, numCellsY) * numCellsX + cellCoord(pos.x, numCellsX);
+	}
+
+	float invCellSize;
+	int numCellsX;
+	int numCellsY;
+	int numCells;
+
+	std::vector<int> cellStart;
+	std::vector<int> items;
+	std::vector<int> itemCells;
+	std::vector<int> fillCursor;
+};
+
+#endif // SPATIALGRID_H
@@ -0,0 +1,110 @@
+#include <chrono>
+#include "spectator_fanout.h"
+#include "match_protocol.h"
+
+using Clock = std::chrono::steady_clock;
+
+SpectatorFanout::SpectatorFanout(UdpSocket& s) : socket(s) {}
+
+SpectatorFanout::~SpectatorFanout() { Stop(); }
+
+void SpectatorFanout::Start() {
+    if (thread.joinable()) return;
+    stopping = false;
+    thread = std::thread(&SpectatorFanout::run, this);
+}
+
+void SpectatorFanout::Stop() {
+    if (!thread.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+	stopping = true;
+    }
+    ready.notify_one();
+    thread.join();
+}
+
+void SpectatorFanout::Publish(SpectatorFrame frame, Audience audience) {
+    if (!frame.snapshot || !audience || audience->empty()) return;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+	if (queue.size() >= MAX_QUEUED) {
+	    stats.dropped++;
+	    return;
+	}
+	queue.push_back({std::move(frame), std::move(audience)});
+    }
+    ready.notify_one();
+}
+
+FanoutStats SpectatorFanout::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
+
+SharedPacket SpectatorFanout::encode(const SpectatorFrame& frame) {
+    const std::vector<std::byte>& current = *frame.snapshot;
+    const std::vector<std::byte>* reference = frame.base.get();
+    codec.Encode(reference ? reference->data() : nullptr, reference ? reference->size() : 0, current.data(), current.size(), delta);
+    if (MATCH_SNAPSHOT_HEADER_BYTES + delta.size() > MATCH_MAX_PACKET_BYTES) return nullptr;
+
+    auto packet = std::make_shared<std::vector<uint8_t>>();
+    packet->reserve(MATCH_SNAPSHOT_HEADER_BYTES + delta.size());
+    BitWriter writer(*packet);
+    write_match_header(writer, MATCH_SNAPSHOT);
+    writer.Write(frame.matchId, 32);
+    writer.Write(frame.tick, 32);
+    writer.Write(reference ? frame.baseTick : MATCH_NONE, 32);
+    // Spectators have no inputs to be applied
+    writer.Write(MATCH_NONE, 32);
+    writer.Flush();
+    packet->insert(packet->end(), delta.begin(), delta.end());
+    return packet;
+}
+
+void SpectatorFanout::run() {
+    std::vector<Item> sending;
+    LatencyHistogram encodeTimes;
+    LatencyHistogram sendTimes;
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        ready.wait(lock, [&] { return !queue.empty() || stopping; });
+	if (queue.empty()) return;
+	// Take the whole queue, so publishers never wait on the sends
+	std::swap(queue, sending);
+	lock.unlock();
+
+	FanoutStats batch;
+	encodeTimes.Clear();
+	sendTimes.Clear();
+	for (Item& item : sending) {
+	    auto start = Clock::now();
+	    SharedPacket packet = encode(item.frame);
+	    encodeTimes.Record(seconds_since(start));
+	    batch.frames++;
+	    if (!packet) {
+	        batch.oversized++;
+		continue;
+	    }
+
+	    start = Clock::now();
+	    const std::vector<NetAddress>& to = *item.audience;
+	    int sent = socket.SendToMany(to.data(), (int)to.size(), packet->data(), packet->size());
+	    sendTimes.Record(seconds_since(start));
+	    batch.sends += sent;
+	    batch.bytes += (uint64_t)sent * packet->size();
+	    batch.failed += to.size() - sent;
+	}
+	// Letting go of the snapshots here frees any the match has already replaced
+	sending.clear();
+
+	lock.lock();
+	stats.frames += batch.frames;
+	stats.sends += batch.sends;
+	stats.bytes += batch.bytes;
+	stats.failed += batch.failed;
+	stats.oversized += batch.oversized;
+	stats.encodeTimes.Merge(encodeTimes);
+	stats.sendTimes.Merge(sendTimes);
+    }
+}
@@ -0,0 +1,95 @@
+#ifndef SPECTATOR_FANOUT_H
+#define SPECTATOR_FANOUT_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "udp_socket.h"
+#include "snapshot_delta.h"
+#include "latency_histogram.h"
+
+// A snapshot (snapshot.h) that several threads may be reading at once. Whoever still holds one
+// keeps it alive, so the writer can tell whether it's free to reuse
+using SharedSnapshot = std::shared_ptr<const std::vector<std::byte>>;
+// A datagram built once and shared by every send of it
+using SharedPacket = std::shared_ptr<const std::vector<uint8_t>>;
+// Everyone watching a match. Never changed once made, only replaced, so a sender can go on using
+// the one it was given while spectators come and go
+using Audience = std::shared_ptr<const std::vector<NetAddress>>;
+
+// One tick of a match, for its spectators
+struct SpectatorFrame {
+    uint32_t matchId = 0;
+    uint32_t tick = 0;
+    SharedSnapshot snapshot;
+    // The tick before, to encode against. Null makes a keyframe
+    uint32_t baseTick = 0;
+    SharedSnapshot base;
+};
+
+struct FanoutStats {
+    // Frames published and turned into packets, and the datagrams and bytes sent for them
+    uint64_t frames = 0;
+    uint64_t sends = 0;
+    uint64_t bytes = 0;
+    // Sends the socket refused, frames thrown away because the queue was full, and frames too
+    // big for a packet
+    uint64_t failed = 0;
+    uint64_t dropped = 0;
+    uint64_t oversized = 0;
+    // Encoding one frame, and sending it to its whole audience
+    LatencyHistogram encodeTimes;
+    LatencyHistogram sendTimes;
+};
+
+// Turns matches' snapshots into spectator packets and sends them, from a thread of its own.
+//
+// A match's worker only hands over references to the snapshot it has already taken for its
+// players and the one before; nothing is copied. Here each frame is delta-encoded once, into
+// one packet that goes unchanged to every spectator of the match in as few system calls as
+// the platform allows. So however many spectators a match has, its tick costs the same
+class SpectatorFanout {
+    public:
+	// Sends on socket, which has to stay open until Stop
+	SpectatorFanout(UdpSocket& socket);
+	SpectatorFanout(const SpectatorFanout&) = delete;
+	SpectatorFanout& operator=(const SpectatorFanout&) = delete;
+	~SpectatorFanout();
+
+	void Start();
+	// Sends whatever is still queued, then stops the thread
+	void Stop();
+	// Queue frame to go to everyone in audience. Safe from any thread
+	void Publish(SpectatorFrame frame, Audience audience);
+	FanoutStats getStats() const;
+
+	// Most frames waiting to be sent before new ones are dropped
+	static constexpr size_t MAX_QUEUED = 4096;
+    private:
+	struct Item {
+	    SpectatorFrame frame;
+	    Audience audience;
+	};
+
+	void run();
+	// The SNAPSHOT packet (match_protocol.h) for frame
+	SharedPacket encode(const SpectatorFrame& frame);
+
+	UdpSocket& socket;
+	std::thread thread;
+	mutable std::mutex mutex;
+	std::condition_variable ready;
+	std::vector<Item> queue;
+	bool stopping = false;
+	FanoutStats stats;
+
+	// Only touched by the thread
+	SnapshotDeltaCodec codec = SnapshotDeltaCodec(LOSSLESS_PRECISION);
+	std::vector<uint8_t> delta;
+};
+
+#endif // SPECTATOR_FANOUT_H
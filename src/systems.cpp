@@ -0,0 +1,226 @@
+#include <raylib-cpp.hpp>
+#include <algorithm>
+#include <chrono>
+#include "systems.h"
+#include "lag_compensation.h"
+#include "game_constants.h"
+
+void ship_system(World& world, TickScratch&) {
+    world.players.ForEach([&](Entity, Player& p, PlayerInput& input, PlayerSlot& slot) {
+        //Create a new bullet if enough frames have passed since the last spawn
+	if (input.fire && p.TryFire(world.bulletFramesPerSpawn)) {
+	    // Quick way to get the bullet x & y deltas
+	    float bVelocX = p.getDeltaXShip() * (GC::BULLET_SPEED/p.getLength());
+	    float bVelocY = p.getDeltaYShip() * (GC::BULLET_SPEED/p.getLength());
+	    // Bullets are a different archetype from ships, so this is safe mid-iteration
+	    spawn_bullet(world, p.getPoints()[0], bVelocX, bVelocY, slot.index);
+	}
+
+	p.Update(input, (float)world.width, (float)world.height);
+
+	// Thruster exhaust leaves the back of the ship, opposite to the direction of travel
+	if (input.thrust && world.particles) {
+	    float exhaustSpeed = GC::THRUSTER_PARTICLE_SPEED / p.getLength();
+	    world.particles->Emit(p.getPoints()[10], {-p.getDeltaXShip() * exhaustSpeed, -p.getDeltaYShip() * exhaustSpeed}, GC::THRUSTER_PARTICLES_PER_FRAME, 1.0f, GC::THRUSTER_PARTICLE_LIFE, ORANGE);
+	}
+    });
+}
+
+void movement_system(World& world, TickScratch&) {
+    world.movers.ForEachChunk([](int n, Entity*, Position* positions, Velocity* velocities) {
+        for (int i = 0; i < n; i++) {
+	    positions[i].x += velocities[i].x;
+	    positions[i].y += velocities[i].y;
+	}
+    });
+}
+
+void asteroid_wrap_system(World& world, TickScratch&) {
+    float w = world.width;
+    float h = world.height;
+    world.asteroids.ForEach([&](Entity, Position& position, Asteroid& asteroid) {
+        float offset = asteroid.getWrapOffset();
+	// Check if off screen
+	if (position.x > w + offset) position.x = -offset;
+	if (position.x < -offset) position.x = w + offset;
+	if (position.y > h + offset) position.y = -offset;
+	if (position.y < -offset) position.y = h + offset;
+    });
+}
+
+void broadphase_system(World& world, TickScratch&) {
+    rebuild_broadphase(world);
+    if (world.lagCompensation) world.lagCompensation->history.Record(world.state.tick, world.asteroidIndex, world.grid);
+}
+
+// Against the asteroids as they were rewind ticks ago, if lag compensation has them. Returns
+// false if it doesn't, to test against the present instead
+static bool rewound_bullet_collision(World& world, Entity bullet, Vector2 bulletPos, int rewind, TickScratch& scratch) {
+    LagCompensation& lag = *world.lagCompensation;
+    auto start = std::chrono::steady_clock::now();
+    int oldest = std::min<uint64_t>(lag.history.getTicks() - 1, world.state.tick);
+    if (rewind > oldest) {
+        rewind = oldest;
+	lag.stats.clamped++;
+    }
+    if (rewind <= 0) return false;
+
+    Entity closest = NULL_ENTITY;
+    float closestDistSq = 0;
+    bool kept = lag.history.Query(world.state.tick - rewind, bulletPos, GC::MAX_ASTEROID_RADIUS, [&](Entity e, const Position& position, int) {
+        // Destroyed since. What the shooter saw is already gone
+        if (!world.registry.IsAlive(e)) return;
+	if (!world.registry.get<Asteroid>(e).ContainsBullet(position, bulletPos)) return;
+
+	float dx = position.x - bulletPos.x;
+	float dy = position.y - bulletPos.y;
+	float distSq = dx*dx + dy*dy;
+	if (closest == NULL_ENTITY || distSq < closestDistSq) {
+	    closest = e;
+	    closestDistSq = distSq;
+	}
+    });
+    if (!kept) return false;
+
+    if (closest != NULL_ENTITY) {
+        scratch.hits.push_back({bullet, closest});
+	lag.stats.rewoundHits++;
+    }
+    lag.stats.rewoundTests++;
+    lag.stats.queryTimes.Record(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    return true;
+}
+
+void bullet_collision_system(World& world, TickScratch& scratch) {
+    const AsteroidIndex& index = world.asteroidIndex;
+
+    world.bullets.ForEach([&](Entity e, Position& position, Bullet& bullet) {
+        Vector2 bulletPos = {position.x, position.y};
+	int owner = bullet.getOwner();
+	if (world.lagCompensation && owner >= 0 && owner < GC::MAX_PLAYERS) {
+	    int rewind = world.lagCompensation->rewindTicks[owner];
+	    if (rewind > 0 && rewound_bullet_collision(world, e, bulletPos, rewind, scratch)) return;
+	}
+
+	int closest = -1;
+	float closestDistSq = 0;
+
+	world.grid.Query(bulletPos, GC::MAX_ASTEROID_RADIUS, [&](int a) {
+	    const Asteroid& asteroid = world.registry.get<Asteroid>(index.entities[a]);
+	    if (!asteroid.ContainsBullet(index.positions[a], bulletPos)) return;
+
+	    float dx = index.positions[a].x - bulletPos.x;
+	    float dy = index.positions[a].y - bulletPos.y;
+	    float distSq = dx*dx + dy*dy;
+	    if (closest < 0 || distSq < closestDistSq) {
+	        closest = a;
+		closestDistSq = distSq;
+	    }
+	});
+
+	if (closest >= 0) scratch.hits.push_back({e, index.entities[closest]});
+    });
+}
+
+void hit_resolution_system(World& world, TickScratch& scratch) {
+    if (scratch.hits.empty()) return;
+
+    auto& hits = scratch.hits;
+    scratch.destroyed.clear();
+    scratch.spawns.clear();
+
+    // Sort so hits on the same asteroid are next to each other. Only the first is applied, any
+    // other bullets that hit the same asteroid carry on
+    std::sort(hits.begin(), hits.end(), [](const HitEvent& a, const HitEvent& b) {
+        return a.asteroid.index != b.asteroid.index ? a.asteroid.index < b.asteroid.index : a.bullet.index < b.bullet.index;
+    });
+
+    for (size_t i = 0; i < hits.size(); i++) {
+        if (i > 0 && hits[i].asteroid == hits[i - 1].asteroid) continue;
+	const HitEvent& hit = hits[i];
+
+	Entity asteroidEntity = hit.asteroid;
+	const Asteroid& asteroid = world.registry.get<Asteroid>(asteroidEntity);
+	Position position = world.registry.get<Position>(asteroidEntity);
+	Velocity veloc = world.registry.get<Velocity>(asteroidEntity);
+
+	// The team's score, and the score of whoever fired the bullet
+	int points = GC::ASTEROID_SCORES[asteroid.getSize() - 1];
+	int owner = world.registry.get<Bullet>(hit.bullet).getOwner();
+	world.state.score += points;
+	world.players.ForEach([&](Entity, Player&, PlayerInput&, PlayerSlot& slot) { if (slot.index == owner) slot.score += points; });
+	if (world.particles) {
+	    world.particles->Emit({position.x, position.y}, {veloc.x, veloc.y}, GC::EXPLOSION_PARTICLES_PER_SIZE * asteroid.getSize(), GC::EXPLOSION_PARTICLE_SPEED, GC::EXPLOSION_PARTICLE_LIFE, LIGHTGRAY);
+	}
+
+	// Spawn new smaller asteroids to resemble the breaking up of the old, larger one
+	split_asteroid(world, position, veloc, asteroid, scratch.spawns);
+
+	scratch.destroyed.push_back(asteroidEntity);
+	scratch.destroyed.push_back(hit.bullet);
+    }
+
+    // Each destroy is a swap-and-pop inside the entity's archetype
+    for (Entity e : scratch.destroyed) world.registry.Destroy(e);
+
+    for (const auto& spawn : scratch.spawns) {
+        spawn_asteroid(world, spawn.position, spawn.velocX, spawn.velocY, spawn.size, spawn.numVertices);
+    }
+}
+
+void bullet_cull_system(World& world, TickScratch& scratch) {
+    scratch.destroyed.clear();
+    world.bullets.ForEach([&](Entity e, Position& position, Bullet& bullet) {
+        if (bullet.IsOffScreen(position, world.width, world.height)) scratch.destroyed.push_back(e);
+    });
+    for (Entity e : scratch.destroyed) world.registry.Destroy(e);
+}
+
+void ship_collision_system(World& world, TickScratch&) {
+    const AsteroidIndex& index = world.asteroidIndex;
+
+    world.players.ForEach([&](Entity, Player& p, PlayerInput&, PlayerSlot& slot) {
+        // Any point of the ship is within a ship length of its midpoint
+	world.grid.Query(p.getMidpoint(), p.getLength() + GC::MAX_ASTEROID_RADIUS, [&](int a) {
+	    // Asteroids destroyed earlier this tick are still in the grid
+	    if (!world.registry.IsAlive(index.entities[a])) return;
+	    if (p.CollidedWithAsteroid(index.positions[a], index.radii[a])) {
+	        world.state.status = GAME_OVER;
+		world.state.loser = slot.index;
+	    }
+	});
+
+	// In versus, other players' bullets are deadly too
+	if (world.mode != VERSUS) return;
+	world.bullets.ForEach([&](Entity, Position& position, Bullet& bullet) {
+	    if (bullet.getOwner() != slot.index && p.HitByBullet(position)) {
+	        world.state.status = GAME_OVER;
+		world.state.loser = slot.index;
+	    }
+	});
+    });
+}
+
+void level_system(World& world, TickScratch&) {
+    // Check if there are no asteroids left and move to next level if so
+    if (world.asteroids.getCount() == 0) {
+        world.state.level++;
+	// Load in the next set of asteroids
+	create_asteroids(world, 3);
+	world.state.status = NEXT_LEVEL;
+    }
+}
+
+std::vector<System> default_systems() {
+    return {
+        {"ship", ship_system},
+	{"movement", movement_system},
+	{"asteroid_wrap", asteroid_wrap_system},
+	{"broadphase", broadphase_system},
+	{"bullet_collision", bullet_collision_system},
+	{"hit_resolution", hit_resolution_system},
+	{"bullet_cull", bullet_cull_system},
+	{"ship_collision", ship_collision_system},
+	{"level", level_system},
+    };
+}
@@ -0,0 +1,29 @@
+#ifndef SYSTEMS_H
+#define SYSTEMS_H
+
+#include <vector>
+#include "world.h"
+
+// Steer ships from their input and fire their guns
+void ship_system(World& world, TickScratch& scratch);
+// Move everything that has a velocity
+void movement_system(World& world, TickScratch& scratch);
+// Loop asteroids back round once they are entirely off screen
+void asteroid_wrap_system(World& world, TickScratch& scratch);
+// Rebuild the asteroid index and the collision grid from the current positions
+void broadphase_system(World& world, TickScratch& scratch);
+// Queue at most one hit per bullet, against the closest asteroid containing it
+void bullet_collision_system(World& world, TickScratch& scratch);
+// Destroy hit asteroids and consume the bullets that hit them, splitting large asteroids
+void hit_resolution_system(World& world, TickScratch& scratch);
+// Remove bullets that have left the screen
+void bullet_cull_system(World& world, TickScratch& scratch);
+// End the game if a ship has hit an asteroid, or in versus another player's bullet
+void ship_collision_system(World& world, TickScratch& scratch);
+// Move on to the next level once every asteroid is destroyed
+void level_system(World& world, TickScratch& scratch);
+
+// The order systems run in each tick
+std::vector<System> default_systems();
+
+#endif // SYSTEMS_H
@@ -0,0 +1,161 @@
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+#include "udp_socket.h"
+
+#ifdef _WIN32
+using SocketHandle = SOCKET;
+static void close_socket(SocketHandle s) { closesocket(s); }
+
+// Winsock has to be started once before any socket is made
+static bool start_sockets() {
+    static bool started = false;
+    if (!started) {
+        WSADATA data;
+	started = WSAStartup(MAKEWORD(2, 2), &data) == 0;
+    }
+    return started;
+}
+#else
+using SocketHandle = int;
+static void close_socket(SocketHandle s) { close(s); }
+static bool start_sockets() { return true; }
+#endif
+
+bool parse_address(const std::string& text, NetAddress& address) {
+    unsigned int a, b, c, d, port;
+    char end;
+    if (std::sscanf(text.c_str(), "%u.%u.%u.%u:%u%c", &a, &b, &c, &d, &port, &end) != 5) return false;
+    if (a > 255 || b > 255 || c > 255 || d > 255 || port > 65535) return false;
+    address.ip = (a << 24) | (b << 16) | (c << 8) | d;
+    address.port = (uint16_t)port;
+    return true;
+}
+
+std::string format_address(const NetAddress& address) {
+    char text[32];
+    std::snprintf(text, sizeof(text), "%u.%u.%u.%u:%u", address.ip >> 24, (address.ip >> 16) & 255, (address.ip >> 8) & 255, address.ip & 255, address.port);
+    return text;
+}
+
+UdpSocket::~UdpSocket() { Close(); }
+
+bool UdpSocket::Open(uint16_t requestedPort) {
+    Close();
+    if (!start_sockets()) {
+        std::cerr << "udp: can't start sockets" << std::endl;
+	return false;
+    }
+
+    SocketHandle s = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+#ifdef _WIN32
+    if (s == INVALID_SOCKET) {
+#else
+    if (s < 0) {
+#endif
+        std::cerr << "udp: can't create a socket" << std::endl;
+	return false;
+    }
+
+    sockaddr_in local = {};
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    local.sin_port = htons(requestedPort);
+    if (bind(s, reinterpret_cast<sockaddr*>(&local), sizeof(local)) != 0) {
+        std::cerr << "udp: can't bind port " << requestedPort << std::endl;
+	close_socket(s);
+	return false;
+    }
+
+#ifdef _WIN32
+    u_long nonBlocking = 1;
+    ioctlsocket(s, FIONBIO, &nonBlocking);
+#else
+    fcntl(s, F_SETFL, fcntl(s, F_GETFL, 0) | O_NONBLOCK);
+#endif
+
+    socklen_t length = sizeof(local);
+    getsockname(s, reinterpret_cast<sockaddr*>(&local), &length);
+    port = ntohs(local.sin_port);
+    handle = (intptr_t)s;
+    return true;
+}
+
+void UdpSocket::Close() {
+    if (handle == INVALID) return;
+    close_socket((SocketHandle)handle);
+    handle = INVALID;
+}
+
+bool UdpSocket::SendTo(const NetAddress& to, const void* data, size_t size) {
+    if (handle == INVALID) return false;
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(to.ip);
+    address.sin_port = htons(to.port);
+    return sendto((SocketHandle)handle, static_cast<const char*>(data), (int)size, 0, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == (int)size;
+}
+
+int UdpSocket::SendToMany(const NetAddress* to, int count, const void* data, size_t size) {
+    if (handle == INVALID) return 0;
+#ifdef __linux__
+    // sendmmsg hands the kernel a batch of datagrams at a time, all pointing at the same bytes
+    constexpr int BATCH = 64;
+    sockaddr_in addresses[BATCH];
+    iovec iov = {const_cast<void*>(data), size};
+    mmsghdr messages[BATCH];
+    int sent = 0;
+    for (int first = 0; first < count; first += BATCH) {
+        int n = std::min(BATCH, count - first);
+	for (int i = 0; i < n; i++) {
+	    addresses[i] = {};
+	    addresses[i].sin_family = AF_INET;
+	    addresses[i].sin_addr.s_addr = htonl(to[first + i].ip);
+	    addresses[i].sin_port = htons(to[first + i].port);
+	    messages[i] = {};
+	    messages[i].msg_hdr.msg_name = &addresses[i];
+	    messages[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+	    messages[i].msg_hdr.msg_iov = &iov;
+	    messages[i].msg_hdr.msg_iovlen = 1;
+	}
+	// It may stop part way through a batch. Carry on after the one that failed
+	for (int i = 0; i < n;) {
+	    int done = sendmmsg((SocketHandle)handle, messages + i, n - i, 0);
+	    if (done > 0) {
+	        sent += done;
+		i += done;
+	    } else {
+	        i++;
+	    }
+	}
+    }
+    return sent;
+#else
+    int sent = 0;
+    for (int i = 0; i < count; i++) {
+        if (SendTo(to[i], data, size)) sent++;
+    }
+    return sent;
+#endif
+}
+
+int UdpSocket::Receive(void* buffer, size_t size, NetAddress& from) {
+    if (handle == INVALID) return -1;
+    sockaddr_in address = {};
+    socklen_t length = sizeof(address);
+    int received = (int)recvfrom((SocketHandle)handle, static_cast<char*>(buffer), (int)size, 0, reinterpret_cast<sockaddr*>(&address), &length);
+    if (received < 0) return -1;
+    from.ip = ntohl(address.sin_addr.s_addr);
+    from.port = ntohs(address.sin_port);
+    return received;
+}
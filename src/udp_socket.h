@@ -0,0 +1,50 @@
+#ifndef UDP_SOCKET_H
+#define UDP_SOCKET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// IPv4 address and port, both in host byte order
+struct NetAddress {
+    uint32_t ip = 0;
+    uint16_t port = 0;
+
+    bool operator==(const NetAddress& other) const { return ip == other.ip && port == other.port; }
+    bool operator!=(const NetAddress& other) const { return !(*this == other); }
+};
+
+// Parse "a.b.c.d:port". Returns false if it isn't one
+bool parse_address(const std::string& text, NetAddress& address);
+std::string format_address(const NetAddress& address);
+
+// Non-blocking UDP socket. Works with BSD sockets and Winsock
+class UdpSocket {
+    public:
+	UdpSocket() = default;
+	UdpSocket(const UdpSocket&) = delete;
+	UdpSocket& operator=(const UdpSocket&) = delete;
+	~UdpSocket();
+
+	// Bind to port on every interface (0 picks a free port). Returns false and prints why if
+	// the socket can't be opened
+	bool Open(uint16_t port);
+	void Close();
+	bool isOpen() const { return handle != INVALID; }
+	// The port actually bound, useful after Open(0)
+	uint16_t getPort() const { return port; }
+
+	bool SendTo(const NetAddress& to, const void* data, size_t size);
+	// Send the same datagram to every address in to. Batched into as few system calls as the
+	// platform allows. Returns how many were sent
+	int SendToMany(const NetAddress* to, int count, const void* data, size_t size);
+	// Copy the next waiting datagram into buffer. Returns its size, or -1 if there's nothing
+	// waiting. Datagrams bigger than the buffer are truncated
+	int Receive(void* buffer, size_t size, NetAddress& from);
+    private:
+	static constexpr intptr_t INVALID = -1;
+	intptr_t handle = INVALID;
+	uint16_t port = 0;
+};
+
+#endif // UDP_SOCKET_H
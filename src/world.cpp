@@ -0,0 +1,136 @@
+#include <raylib-cpp.hpp>
+#include <chrono>
+#include "world.h"
+#include "systems.h"
+#include "game_constants.h"
+
+World::World(int w, int h) : World(w, h, std::random_device()()) {}
+
+World::World(int w, int h, unsigned int seed) : width(w), height(h), state(seed), arena(GC::FRAME_ARENA_BYTES), grid(w, h, GC::GRID_CELL_SIZE), systems(default_systems()), players(registry), movers(registry), asteroids(registry), bullets(registry), shapedAsteroids(registry) {
+    systemSeconds.assign(systems.size(), 0.0);
+}
+
+Entity World::NewGame(int numPlayers) {
+    registry.Clear();
+    if (particles) particles->Clear();
+
+    Entity ship = spawn_player(*this, 0, numPlayers);
+    for (int slot = 1; slot < numPlayers; slot++) spawn_player(*this, slot, numPlayers);
+    create_asteroids(*this, 3);
+    state.level = 1;
+    state.score = 0;
+    state.tick = 0;
+    state.loser = -1;
+    rebuild_broadphase(*this);
+    return ship;
+}
+
+void World::Tick(const PlayerInput& input) {
+    PlayerInput inputs[GC::MAX_PLAYERS];
+    std::fill(std::begin(inputs), std::end(inputs), input);
+    Tick(inputs, GC::MAX_PLAYERS);
+}
+
+void World::Tick(const PlayerInput* inputs, int numInputs) {
+    // Per-frame scratch memory from the previous tick is no longer referenced
+    arena.Reset();
+    TickScratch scratch(arena.getResource());
+
+    players.ForEach([&](Entity, Player&, PlayerInput& shipInput, PlayerSlot& slot) {
+        shipInput = slot.index >= 0 && slot.index < numInputs ? inputs[slot.index] : PlayerInput();
+    });
+    state.tick++;
+
+    if (!profileSystems) {
+        for (const auto& system : systems) system.run(*this, scratch);
+	return;
+    }
+
+    for (size_t i = 0; i < systems.size(); i++) {
+        auto start = std::chrono::steady_clock::now();
+	systems[i].run(*this, scratch);
+	systemSeconds[i] += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+Entity World::getShip(int slot) {
+    Entity ship = NULL_ENTITY;
+    players.ForEach([&](Entity e, Player&, PlayerInput&, PlayerSlot& s) { if (s.index == slot) ship = e; });
+    return ship;
+}
+
+int World::getNumAsteroids() { return asteroids.getCount(); }
+int World::getNumBullets() { return bullets.getCount(); }
+
+Entity spawn_player(World& world, int slot, int numPlayers) {
+    Vector2 centre = {world.width * (slot + 1.0f) / (numPlayers + 1), world.height / 2.0f};
+    return world.registry.Create(Player(centre), PlayerInput(), PlayerSlot{slot, 0});
+}
+
+Entity spawn_asteroid(World& world, Vector2 position, float velocX, float velocY, int size, int numVertices) {
+    Entity e = NULL_ENTITY;
+    // Pick the specialised shape storage for this vertex count
+    dispatch_vertex_count(numVertices, [&](auto n) {
+        constexpr int N = decltype(n)::value;
+	Asteroid asteroid(size, N, WHITE);
+	auto shape = AsteroidShape<N>::Random(asteroid.getRadius(), asteroid.getSpikiness(), world.state.gen);
+	e = world.registry.Create(Position{position.x, position.y}, Velocity{velocX, velocY}, asteroid, shape);
+    });
+    return e;
+}
+
+Entity spawn_bullet(World& world, Vector2 position, float velocX, float velocY, int ownerSlot) {
+    return world.registry.Create(Position{position.x, position.y}, Velocity{velocX, velocY}, Bullet(ownerSlot));
+}
+
+void create_asteroids(World& world, int numAsteroids, int size, int numVertices) {
+    
+    GameState& state = world.state;
+
+    Vector2 position;
+    float xSpeed;
+    float ySpeed;
+    
+    for (int i = 0; i < numAsteroids; i++) {
+	position = {(float)(state.uniformDis(state.gen) * world.width), (float)(state.uniformDis(state.gen) * world.height)};
+	// Select speed from uniform random distribution between -3 and 3
+	xSpeed = (state.uniformDis(state.gen) * 6 - 3);
+        ySpeed = (state.uniformDis(state.gen) * 6 - 3);
+	spawn_asteroid(world, position, xSpeed, ySpeed, size, numVertices);
+    }
+}
+
+void rebuild_broadphase(World& world) {
+    AsteroidIndex& index = world.asteroidIndex;
+    index.entities.clear();
+    index.positions.clear();
+    index.radii.clear();
+
+    world.asteroids.ForEach([&](Entity e, Position& position, Asteroid& asteroid) {
+        index.entities.push_back(e);
+	index.positions.push_back(position);
+	index.radii.push_back(asteroid.getRadius());
+    });
+
+    world.grid.Build((int)index.positions.size(), [&](int i) { return Vector2{index.positions[i].x, index.positions[i].y}; });
+}
+
+void split_asteroid(World& world, Position position, Velocity veloc, const Asteroid& asteroid, std::pmr::vector<AsteroidSpawn>& spawns) {
+
+    if (asteroid.getSize() <= 1) return;
+
+    GameState& state = world.state;
+    int newSize = asteroid.getSize() - 1;
+
+    for (int i=0; i<GC::ASTEROID_SPAWN_FACTOR; i++){
+
+        // Vary the position to within +- 1% of screen dimensions compared with original asteroid
+	Vector2 newPosition = {position.x + (world.width/100) * (float)state.uniformDis(state.gen) , position.y + (world.height/100) * (float)state.uniformDis(state.gen)};
+	// Choose new x and y components of velocity within +-10% of the original asteroid's values
+	float newVelocX = veloc.x + veloc.x * state.uniformDis(state.gen) * 0.1;
+	float newVelocY = veloc.y + veloc.y * state.uniformDis(state.gen) * 0.1;
+	int newNumVertices = asteroid.getNumVertices();
+
+	spawns.push_back({newPosition, newVelocX, newVelocY, newSize, newNumVertices});
+    }
+}
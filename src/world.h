@@ -0,0 +1,201 @@
+#ifndef WORLD_H
+#define WORLD_H
+
+#include <raylib-cpp.hpp>
+#include <cmath>
+#include <memory_resource>
+#include <random>
+#include <tuple>
+#include <vector>
+#include "ecs.h"
+#include "rng.h"
+#include "components.h"
+#include "asteroid.h"
+#include "bullet.h"
+#include "player.h"
+#include "frame_arena.h"
+#include "spatial_grid.h"
+#include "particles.h"
+#include "game_constants.h"
+
+enum GameStatus {
+    MENU,
+    PLAYING,
+    NEXT_LEVEL,
+    GAME_OVER
+};
+
+// With more than one ship: in co-op the players share the asteroids and the score, in versus
+// their bullets can also hit each other's ships
+enum GameMode {
+    COOP,
+    VERSUS
+};
+    
+struct GameState {
+    
+    int level = 1;
+    int score = 0;
+    // Ticks simulated since the game started
+    uint64_t tick = 0;
+    // Slot of the ship whose destruction ended the game, or -1
+    int loser = -1;
+
+    GameStatus status;
+
+    // Random number generators for uniform real distribution. Every random choice the
+    // simulation makes comes from gen, so the same seed and inputs give the same game
+    unsigned int seed;
+    Pcg32 gen;
+    std::uniform_real_distribution<> uniformDis;
+
+    GameState(unsigned int s): status(MENU), seed(s), gen(s), uniformDis(0.0, 1.0) {}
+};
+
+// A bullet that has ended up inside an asteroid this frame
+struct HitEvent {
+    Entity bullet;
+    Entity asteroid;
+};
+
+// Parameters for an asteroid to be created once the current frame's hits have been processed
+struct AsteroidSpawn {
+    Vector2 position;
+    float velocX;
+    float velocY;
+    int size;
+    int numVertices;
+};
+
+// Scratch lists passed between the systems of one tick. Allocated from the frame arena
+struct TickScratch {
+    std::pmr::vector<HitEvent> hits;
+    std::pmr::vector<Entity> destroyed;
+    std::pmr::vector<AsteroidSpawn> spawns;
+
+    TickScratch(std::pmr::memory_resource* r) : hits(r), destroyed(r), spawns(r) {}
+};
+
+// Flat copy of where every asteroid was when the broadphase was last built. The grid refers
+// to asteroids by their index in these arrays
+struct AsteroidIndex {
+    std::vector<Entity> entities;
+    std::vector<Position> positions;
+    std::vector<int> radii;
+};
+
+// One cached query per supported asteroid vertex count
+template <typename Counts>
+struct ShapedAsteroidQueries;
+
+template <int... Ns>
+struct ShapedAsteroidQueries<VertexCounts<Ns...>> {
+    std::tuple<Query<Position, Asteroid, AsteroidShape<Ns>>...> queries;
+
+    ShapedAsteroidQueries(Registry& r) : queries(Query<Position, Asteroid, AsteroidShape<Ns>>(r)...) {}
+
+    // f(Entity, Position&, Asteroid&, AsteroidShape<N>&) for every asteroid, one vertex count at
+    // a time, so f is instantiated (and its loops unrolled) separately for each N
+    template <typename F>
+    void ForEach(F&& f) {
+        std::apply([&](auto&... query) { (query.ForEach(f), ...); }, queries);
+    }
+};
+
+struct World;
+struct LagCompensation;
+using SystemFn = void (*)(World&, TickScratch&);
+
+struct System {
+    const char* name;
+    SystemFn run;
+};
+
+// Everything in one game of asteroids: the entities, the game state and the systems that
+// advance them, run in a fixed order by Tick()
+struct World {
+    // Seeded from std::random_device
+    World(int w, int h);
+    World(int w, int h, unsigned int seed);
+    World(const World&) = delete;
+    World& operator=(const World&) = delete;
+
+    // Start again from level 1 with fresh ships and asteroids. Returns the first player's ship
+    Entity NewGame(int numPlayers = 1);
+    // Every ship gets the same input
+    void Tick(const PlayerInput& input);
+    // Each ship gets inputs[its slot]. Ships in slots past numInputs get no input
+    void Tick(const PlayerInput* inputs, int numInputs);
+    void Draw();
+
+    // The ship in slot, or NULL_ENTITY if there isn't one
+    Entity getShip(int slot = 0);
+    int getNumAsteroids();
+    int getNumBullets();
+
+    int width;
+    int height;
+    GameState state;
+    Registry registry;
+    FrameArena arena;
+    SpatialGrid grid;
+    AsteroidIndex asteroidIndex;
+    // Visual effects only. Left null when running without a window
+    ParticleSystem* particles = nullptr;
+    // Set on a server to test shots against what their shooters saw (lag_compensation.h)
+    LagCompensation* lagCompensation = nullptr;
+
+    // Frames the gun takes to cool down after each shot
+    int bulletFramesPerSpawn = GC::BULLET_FRAMES_PER_SPAWN;
+    GameMode mode = COOP;
+
+    // Run in this order every tick
+    std::vector<System> systems;
+    // When set, Tick() adds the time spent in systems[i] to systemSeconds[i]
+    bool profileSystems = false;
+    std::vector<double> systemSeconds;
+
+    // Cached queries used by the systems
+    Query<Player, PlayerInput, PlayerSlot> players;
+    Query<Position, Velocity> movers;
+    Query<Position, Asteroid> asteroids;
+    Query<Position, Bullet> bullets;
+    ShapedAsteroidQueries<AsteroidVertexCounts> shapedAsteroids;
+};
+
+// Ships are spread across the middle of the arena, slot 0 on the left
+Entity spawn_player(World& world, int slot = 0, int numPlayers = 1);
+Entity spawn_asteroid(World& world, Vector2 position, float velocX, float velocY, int size, int numVertices);
+Entity spawn_bullet(World& world, Vector2 position, float velocX, float velocY, int ownerSlot = 0);
+void create_asteroids(World& world, int numAsteroids, int size = 3, int numVertices = 12);
+// Queue the smaller asteroids created by destroying an asteroid
+void split_asteroid(World& world, Position position, Velocity veloc, const Asteroid& asteroid, std::pmr::vector<AsteroidSpawn>& spawns);
+// Rebuild world.asteroidIndex and world.grid from where the asteroids are now. The broadphase
+// does this every tick; anything that replaces the asteroids between ticks has to do it too
+void rebuild_broadphase(World& world);
+
+// The shortest way from one point to another along an axis that wraps every size
+inline float wrapped(float d, float size) {
+    return d - size * std::round(d / size);
+}
+
+// Call visit(a) for the asteroids in world.asteroidIndex that may be within radius of centre,
+// through the broadphase grid, counting those across the edges of the arena. An asteroid can
+// be visited twice if radius is over half the arena, and the grid is as of the last tick's
+// broadphase, so asteroids destroyed since are still visited
+template <typename VisitFn>
+void query_nearby_asteroids(World& world, Vector2 centre, float radius, VisitFn&& visit) {
+    float reach = radius + GC::MAX_ASTEROID_RADIUS;
+    float w = (float)world.width;
+    float h = (float)world.height;
+    bool spansX = centre.x - reach <= 0 && centre.x + reach >= w;
+    bool spansY = centre.y - reach <= 0 && centre.y + reach >= h;
+    float shiftX = spansX ? 0 : centre.x < reach ? w : centre.x > w - reach ? -w : 0;
+    float shiftY = spansY ? 0 : centre.y < reach ? h : centre.y > h - reach ? -h : 0;
+    world.grid.Query(centre, reach, visit);
+    if (shiftX != 0) world.grid.Query({centre.x + shiftX, centre.y}, reach, visit);
+    if (shiftY != 0) world.grid.Query({centre.x, centre.y + shiftY}, reach, visit);
+    if (shiftX != 0 && shiftY != 0) world.grid.Query({centre.x + shiftX, centre.y + shiftY}, reach, visit);
+}
+
+#endif // WORLD_H
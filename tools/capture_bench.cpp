@@ -0,0 +1,113 @@
+// Plays a scenario at the game's frame rate, drawing every frame with the software rasteriser
+// in place of the screen, and records it to a GIF with screenshots along the way through
+// FrameCapture (see capture.h). Reports what a capture costs the frame loop against what
+// encoding and writing would have cost it, and how many frames were dropped.
+//
+//     bin/capture_bench scenarios/default.scenario frames=600 directory=/tmp
+//
+// Takes the same keys as scenario_runner, plus directory=, gif_interval= (ticks between GIF
+// frames), screenshot_interval= (ticks between screenshots, 0 for none), queue= (most frames
+// waiting to be written) and paced= (0 to run flat out rather than at the game's frame rate)
+#include <raylib.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "world.h"
+#include "scenario.h"
+#include "controllers.h"
+#include "raster.h"
+#include "capture.h"
+
+using Clock = std::chrono::steady_clock;
+
+int main(int argc, char** argv) {
+
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " <scenario file> [key=value ...]" << std::endl;
+	return 1;
+    }
+
+    Scenario scenario;
+    CaptureSettings settings;
+    int screenshotInterval = 300;
+    bool paced = true;
+    if (!load_scenario(argv[1], scenario)) return 1;
+    for (int i = 2; i < argc; i++) {
+        std::string arg = argv[i];
+	size_t equals = arg.find('=');
+	std::string key = arg.substr(0, equals);
+	std::string value = equals == std::string::npos ? "" : arg.substr(equals + 1);
+	if (key == "directory") settings.directory = value;
+	else if (key == "gif_interval") settings.gifFrameInterval = std::atoi(value.c_str());
+	else if (key == "screenshot_interval") screenshotInterval = std::atoi(value.c_str());
+	else if (key == "queue") settings.maxQueued = std::atoi(value.c_str());
+	else if (key == "paced") paced = std::atoi(value.c_str()) != 0;
+	else if (equals == std::string::npos || !set_scenario_value(scenario, key, value)) {
+	    std::cerr << "bad override '" << arg << "'" << std::endl;
+	    return 1;
+	}
+    }
+
+    std::unique_ptr<Controller> bot = make_controller(scenario.bot, scenario.seed);
+    if (!bot) {
+        std::cerr << "unknown bot '" << scenario.bot << "'" << std::endl;
+	return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    World world(scenario.worldWidth, scenario.worldHeight, scenario.seed);
+    Entity ship = start_scenario(world, scenario);
+    if (ship == NULL_ENTITY) return 1;
+
+    // The screen, as glReadPixels would hand it over
+    int width = GC::SCREEN_WIDTH;
+    int height = GC::SCREEN_HEIGHT;
+    std::vector<uint8_t> gray(width * height);
+    std::vector<uint8_t> rgba(width * height * 4);
+    GrayImage image = {gray.data(), width, height, width};
+
+    FrameCapture capture(settings);
+    LatencyHistogram submitTimes;
+    capture.ToggleRecording();
+    auto frameDue = Clock::now();
+    auto start = Clock::now();
+    for (int frame = 0; frame < scenario.frames; frame++) {
+	world.Tick(bot->Decide(world, ship));
+	world.state.status = PLAYING;
+	raster_world(world, image);
+
+	bool screenshot = screenshotInterval > 0 && frame % screenshotInterval == 0;
+	bool gifFrame = frame % std::max(settings.gifFrameInterval, 1) == 0;
+	if (screenshot || gifFrame) {
+	    for (size_t p = 0; p < gray.size(); p++) {
+	        rgba[4 * p] = rgba[4 * p + 1] = rgba[4 * p + 2] = gray[p];
+		rgba[4 * p + 3] = 255;
+	    }
+	}
+
+	auto submitStart = Clock::now();
+	capture.SubmitFrame(rgba.data(), width, height, screenshot, gifFrame);
+	if (screenshot || gifFrame) submitTimes.Record(seconds_since(submitStart));
+
+	if (paced) {
+	    frameDue += std::chrono::microseconds(1000000 / GC::FPS);
+	    std::this_thread::sleep_until(frameDue);
+	}
+    }
+    capture.ToggleRecording();
+    capture.Flush();
+    double seconds = seconds_since(start);
+
+    CaptureStats stats = capture.getStats();
+    std::printf("scenario        %s (seed %u, bot %s), %d frames in %.1f s%s\n", argv[1], scenario.seed, scenario.bot.c_str(), scenario.frames, seconds, paced ? " at the game's frame rate" : "");
+    std::printf("written         %llu GIF frames in %llu GIFs, %llu screenshots, to %s\n", (unsigned long long)stats.gifFrames, (unsigned long long)stats.gifs, (unsigned long long)stats.screenshots, settings.directory.c_str());
+    std::printf("dropped         %llu frames, %llu failed writes, queue of %d\n", (unsigned long long)stats.dropped, (unsigned long long)stats.failed, settings.maxQueued);
+    std::printf("frame loop      %.3f ms p50, %.3f ms p99, %.3f ms max a capture\n", submitTimes.PercentileMs(0.5), submitTimes.PercentileMs(0.99), submitTimes.getMaxMs());
+    std::printf("writer          %.3f ms p50, %.3f ms p99, %.3f ms max a frame, which the frame loop would otherwise pay\n", stats.encodeTimes.PercentileMs(0.5), stats.encodeTimes.PercentileMs(0.99), stats.encodeTimes.getMaxMs());
+    return stats.failed == 0 ? 0 : 1;
+}
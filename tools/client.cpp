@@ -0,0 +1,224 @@
+// Plays bot clients headless against a match server, each through a simulated network (see
+// net_sim.h), and reports how long an input takes to show up on the local ship with client-side
+// prediction, and how long it would take without it.
+//
+//     bin/client rtt=100 clients=2 seconds=20
+//     bin/client net=wifi/10@mobile/20@bad seconds=30
+//     bin/client server=192.168.1.10:7777 rtt=0 interp=6
+//
+// Keys: server (IP:PORT of a running bin/server or game host; without it a server is started
+// in-process on port), port, clients, players (per match, in-process server only), mode (coop
+// or versus), rtt (milliseconds added to each round trip, half each way, on an otherwise
+// perfect network), net (a profile or script of profiles for the network instead, like
+// "mobile" or "latency=40,loss=2/10@bad"), interp (ticks remote entities are drawn behind the
+// newest snapshot), predict=0 to draw the local ship from the snapshots like everything else,
+// bot, seconds and match_ticks. Exits with 1 if a client never got a snapshot or failed to
+// decode one
+#include <raylib.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "world.h"
+#include "controllers.h"
+#include "match_server.h"
+#include "match_client.h"
+#include "client_view.h"
+#include "net_sim.h"
+#include "game_constants.h"
+
+using Clock = std::chrono::steady_clock;
+
+static void print_latency(const char* name, const LatencyHistogram& latency) {
+    std::printf("%-20s%.1f ms p50, %.1f ms p99, %.1f ms max (%llu inputs)\n", name, latency.PercentileMs(0.5), latency.PercentileMs(0.99), latency.getMaxMs(), (unsigned long long)latency.getCount());
+}
+
+int main(int argc, char** argv) {
+
+    ServerConfig config;
+    config.port = 7778;
+    NetAddress serverAddress;
+    bool remoteServer = false;
+    int numClients = 2;
+    double rttMs = 100;
+    NetScript script;
+    bool haveScript = false;
+    ClientViewSettings viewSettings;
+    std::string botName = "random";
+    double runSeconds = 20;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+	size_t equals = arg.find('=');
+	std::string key = arg.substr(0, equals);
+	std::string value = equals == std::string::npos ? "" : arg.substr(equals + 1);
+	if (key == "server") remoteServer = parse_address(value, serverAddress);
+	else if (key == "port") config.port = (uint16_t)std::atoi(value.c_str());
+	else if (key == "clients") numClients = std::atoi(value.c_str());
+	else if (key == "players") config.playersPerMatch = std::atoi(value.c_str());
+	else if (key == "mode" && (value == "coop" || value == "versus")) config.mode = value == "coop" ? COOP : VERSUS;
+	else if (key == "rtt") rttMs = std::atof(value.c_str());
+	else if (key == "net" && parse_net_script(value, script)) haveScript = true;
+	else if (key == "interp") viewSettings.interpolationTicks = (float)std::atof(value.c_str());
+	else if (key == "predict") viewSettings.predict = value == "1";
+	else if (key == "bot") botName = value;
+	else if (key == "seconds") runSeconds = std::atof(value.c_str());
+	else if (key == "match_ticks") config.matchTicks = (uint32_t)std::strtoul(value.c_str(), nullptr, 10);
+	else {
+	    std::cerr << "bad argument '" << arg << "'" << std::endl;
+	    return 1;
+	}
+    }
+
+    if (numClients < 1 || config.playersPerMatch < 1 || config.playersPerMatch > GC::MAX_PLAYERS || rttMs < 0 || !make_controller(botName, 0)) {
+        std::cerr << "usage: " << argv[0] << " [server=IP:PORT] [port=N] [clients=N] [players=N] [mode=coop|versus] [rtt=MS] [net=SCRIPT] [interp=TICKS] [predict=0|1] [bot=NAME] [seconds=N] [match_ticks=N]" << std::endl;
+	return 1;
+    }
+
+    if (!haveScript) {
+        LinkProfile profile;
+	profile.latencyMs = rttMs / 2;
+	profile.name = "rtt=" + std::to_string((int)rttMs);
+	script.phases = {{0, profile}};
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+    std::atomic<bool> stop(false);
+    auto frameTime = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / GC::FPS));
+
+    // A server of our own, unless we were given one
+    std::unique_ptr<MatchServer> server;
+    std::thread serverThread;
+    if (!remoteServer) {
+        config.workers = 1;
+	server = std::make_unique<MatchServer>(config);
+	if (!server->Start()) {
+	    std::cerr << "client: can't open port " << config.port << std::endl;
+	    return 1;
+	}
+	serverAddress = NetAddress{0x7f000001, server->getPort()};
+    }
+
+    // Each client talks to its own relay, which talks to the server
+    std::vector<std::unique_ptr<NetSimRelay>> relays;
+    for (int i = 0; i < numClients; i++) {
+        relays.push_back(std::make_unique<NetSimRelay>(script, 1000 + 2 * i));
+	if (!relays.back()->Open(serverAddress)) {
+	    std::cerr << "client: can't open relay sockets" << std::endl;
+	    return 1;
+	}
+    }
+
+    std::vector<std::unique_ptr<MatchClient>> clients;
+    std::vector<std::unique_ptr<ClientView>> views;
+    std::vector<std::unique_ptr<Controller>> bots;
+    std::vector<int> joined(numClients, 0);
+    for (int i = 0; i < numClients; i++) {
+        clients.push_back(std::make_unique<MatchClient>());
+	if (!clients.back()->Open(NetAddress{0x7f000001, relays[i]->getPort()})) return 1;
+	views.push_back(std::make_unique<ClientView>(viewSettings));
+	bots.push_back(make_controller(botName, 2000 + i));
+    }
+
+    // The server ticks on a thread of its own, like a separate process would
+    if (server) {
+        serverThread = std::thread([&]() {
+	    auto nextRound = Clock::now();
+	    while (!stop) {
+	        server->RunRound();
+		nextRound += frameTime;
+		std::this_thread::sleep_until(nextRound);
+	    }
+	});
+    }
+    std::thread relayThread([&]() {
+	while (!stop) {
+	    for (auto& relay : relays) relay->Pump();
+	    std::this_thread::sleep_for(std::chrono::microseconds(250));
+	}
+    });
+
+    // Bots fly from what the player would see, predicted ship and all
+    auto start = Clock::now();
+    auto nextFrame = start;
+    while (Clock::now() - start < std::chrono::duration<double>(runSeconds)) {
+        for (int i = 0; i < numClients; i++) {
+	    MatchClient& client = *clients[i];
+	    ClientView& view = *views[i];
+	    bool newer = client.Poll();
+	    if (client.getStats().matchesJoined != joined[i]) {
+	        joined[i] = client.getStats().matchesJoined;
+		view.Reset(client.getSlot());
+	    }
+	    if (newer) view.AddSnapshot(client.getSnapshotTick(), client.getLastAppliedInput(), client.getSnapshot());
+
+	    PlayerInput input;
+	    if (view.hasView()) input = bots[i]->Decide(view.getView(), view.getView().getShip(view.getSlot()));
+	    uint32_t frame = client.SendInput(input, view.hasView() ? view.getRenderTick() : -1);
+	    if (frame != MATCH_NONE) view.Update(frame, input);
+	}
+	nextFrame += frameTime;
+	std::this_thread::sleep_until(nextFrame);
+	// Nothing is drawn, but a frame would reach the screen at the next vsync
+	for (auto& view : views) view->Presented();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    for (auto& client : clients) client->Close();
+    // Give the relays a moment to pass the goodbyes on
+    const LinkProfile& last = script.phases.back().profile;
+    std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(last.latencyMs + last.jitterMs + SimulatedLink::REORDER_DELAY_MS + last.queueMs + 50));
+    stop = true;
+    relayThread.join();
+    if (serverThread.joinable()) serverThread.join();
+
+    ClientViewStats total;
+    MatchClientStats net;
+    LinkStats up;
+    LinkStats down;
+    int withoutSnapshots = 0;
+    for (int i = 0; i < numClients; i++) {
+        const ClientViewStats& s = views[i]->getStats();
+	total.inputToDisplay.Merge(s.inputToDisplay);
+	total.inputToSnapshot.Merge(s.inputToSnapshot);
+	total.inputToInterpolated.Merge(s.inputToInterpolated);
+	total.snapshots += s.snapshots;
+	total.replayedFrames += s.replayedFrames;
+	total.corrections += s.corrections;
+	total.correctionPixels += s.correctionPixels;
+	total.maxCorrectionPixels = std::max(total.maxCorrectionPixels, s.maxCorrectionPixels);
+	total.starved += s.starved;
+	total.clockJumps += s.clockJumps;
+	if (s.snapshots == 0) withoutSnapshots++;
+	const MatchClientStats& c = clients[i]->getStats();
+	net.snapshotsSkipped += c.snapshotsSkipped;
+	net.decodeFailures += c.decodeFailures;
+	net.matchesJoined += c.matchesJoined;
+	net.bytesReceived += c.bytesReceived;
+	net.bytesSent += c.bytesSent;
+	up.Merge(relays[i]->getUpStats());
+	down.Merge(relays[i]->getDownStats());
+    }
+
+    double frames = seconds * GC::FPS * numClients;
+    std::printf("clients             %d for %.1f s against %s, %d matches joined\n", numClients, seconds, remoteServer ? format_address(serverAddress).c_str() : "an in-process server", net.matchesJoined);
+    for (const NetScript::Phase& phase : script.phases) std::printf("network             from %.0f s: %s (%s)\n", phase.startSeconds, phase.profile.name.c_str(), describe_link_profile(phase.profile).c_str());
+    std::printf("  up                %llu packets, %llu lost, %llu dropped by the queue, %llu reordered, held %.1f ms p50, %.1f ms p99\n", (unsigned long long)up.packets, (unsigned long long)up.lost, (unsigned long long)up.queueDrops, (unsigned long long)up.reordered, up.delay.PercentileMs(0.5), up.delay.PercentileMs(0.99));
+    std::printf("  down              %llu packets, %llu lost, %llu dropped by the queue, %llu reordered, held %.1f ms p50, %.1f ms p99\n", (unsigned long long)down.packets, (unsigned long long)down.lost, (unsigned long long)down.queueDrops, (unsigned long long)down.reordered, down.delay.PercentileMs(0.5), down.delay.PercentileMs(0.99));
+    print_latency("input to display", total.inputToDisplay);
+    print_latency("  newest snapshot", total.inputToSnapshot);
+    print_latency("  interpolated", total.inputToInterpolated);
+    std::printf("prediction          %s, %.1f frames replayed per snapshot, %llu corrections, %.2f px on average, %.1f px worst\n", viewSettings.predict ? "on" : "off", total.snapshots ? (double)total.replayedFrames / total.snapshots : 0.0, (unsigned long long)total.corrections, total.corrections ? total.correctionPixels / total.corrections : 0.0, total.maxCorrectionPixels);
+    std::printf("interpolation       %.1f ticks (%.1f ms) behind, starved %.2f%% of frames, %llu clock jumps\n", viewSettings.interpolationTicks, 1000.0 * viewSettings.interpolationTicks / GC::FPS, frames > 0 ? 100.0 * total.starved / frames : 0.0, (unsigned long long)total.clockJumps);
+    std::printf("snapshots           %llu, %llu skipped, %llu failed to decode\n", (unsigned long long)total.snapshots, (unsigned long long)net.snapshotsSkipped, (unsigned long long)net.decodeFailures);
+    std::printf("bandwidth           %.1f KiB/s down, %.1f KiB/s up per client\n", net.bytesReceived / 1024.0 / seconds / numClients, net.bytesSent / 1024.0 / seconds / numClients);
+
+    if (withoutSnapshots) std::cerr << "client: " << withoutSnapshots << " clients never got a snapshot" << std::endl;
+    return withoutSnapshots == 0 && net.decodeFailures == 0 ? 0 : 1;
+}
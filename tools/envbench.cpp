@@ -0,0 +1,100 @@
+// Measures how fast the batched environment steps (see batch_env.h), through its C API as a
+// trainer would call it, with random actions. Reports environment steps and game ticks a
+// second, and how the episodes went. With render=WxH every step is followed by drawing every
+// game into a frame of that size, and the time spent drawing is reported apart.
+//
+//     bin/envbench envs=1024 seconds=10
+//     bin/envbench envs=4096 threads=8 frame_skip=1
+//     bin/envbench envs=256 render=84x84
+//
+// Keys: envs, threads (0 for one per hardware thread), frame_skip, max_steps (per episode, 0
+// for no limit), seed, seconds and render
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "batch_env.h"
+#include "rng.h"
+
+using Clock = std::chrono::steady_clock;
+
+int main(int argc, char** argv) {
+
+    AsteroidsEnvConfig config = asteroids_env_default_config();
+    config.numEnvs = 1024;
+    double runSeconds = 5;
+    int renderWidth = 0;
+    int renderHeight = 0;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+	size_t equals = arg.find('=');
+	std::string key = arg.substr(0, equals);
+	std::string value = equals == std::string::npos ? "" : arg.substr(equals + 1);
+	if (key == "envs") config.numEnvs = std::atoi(value.c_str());
+	else if (key == "threads") config.numThreads = std::atoi(value.c_str());
+	else if (key == "frame_skip") config.frameSkip = std::atoi(value.c_str());
+	else if (key == "max_steps") config.maxEpisodeSteps = std::atoi(value.c_str());
+	else if (key == "seed") config.seed = (uint32_t)std::strtoul(value.c_str(), nullptr, 10);
+	else if (key == "seconds") runSeconds = std::atof(value.c_str());
+	else if (key == "render" && std::sscanf(value.c_str(), "%dx%d", &renderWidth, &renderHeight) == 2 && renderWidth > 0 && renderHeight > 0) {}
+	else {
+	    std::cerr << "bad argument '" << arg << "'" << std::endl;
+	    return 1;
+	}
+    }
+
+    AsteroidsEnv* env = asteroids_env_create(&config);
+    if (!env || runSeconds <= 0) {
+        std::cerr << "usage: " << argv[0] << " [envs=N] [threads=N] [frame_skip=N] [max_steps=N] [seed=N] [seconds=N] [render=WxH]" << std::endl;
+	return 1;
+    }
+
+    int n = asteroids_env_num_envs(env);
+    std::vector<float> obs((size_t)n * ASTEROIDS_ENV_OBS_SIZE);
+    std::vector<float> rewards(n);
+    std::vector<uint8_t> dones(n);
+    std::vector<int32_t> actions(n);
+    std::vector<double> returns(n, 0.0);
+    std::vector<uint8_t> frames((size_t)n * renderWidth * renderHeight);
+    asteroids_env_reset(env, obs.data());
+
+    Pcg32 rng(config.seed);
+    uint64_t steps = 0;
+    uint64_t calls = 0;
+    uint64_t episodes = 0;
+    double totalReturn = 0;
+    double renderSeconds = 0;
+    auto start = Clock::now();
+    while (std::chrono::duration<double>(Clock::now() - start).count() < runSeconds) {
+        for (int32_t& action : actions) action = (int32_t)(rng() % ASTEROIDS_ENV_NUM_ACTIONS);
+	asteroids_env_step(env, actions.data(), obs.data(), rewards.data(), dones.data());
+	if (renderWidth > 0) {
+	    auto renderStart = Clock::now();
+	    asteroids_env_render(env, frames.data(), renderWidth, renderHeight);
+	    renderSeconds += std::chrono::duration<double>(Clock::now() - renderStart).count();
+	}
+	for (int i = 0; i < n; i++) {
+	    returns[i] += rewards[i];
+	    if (!dones[i]) continue;
+	    episodes++;
+	    totalReturn += returns[i];
+	    returns[i] = 0;
+	}
+	steps += n;
+	calls++;
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    asteroids_env_destroy(env);
+
+    std::printf("%d envs, frame skip %d: %.0f steps/s (%.0f ticks/s), %.3f ms a call\n", n, config.frameSkip, steps / seconds, steps * config.frameSkip / seconds, 1000 * seconds / calls);
+    if (renderWidth > 0) {
+        uint64_t lit = 0;
+	for (uint8_t pixel : frames) lit += pixel != 0;
+	std::printf("rendering %dx%d: %.0f frames/s, %.2f us a frame, %.0f%% of the time, %.1f%% of the last frames' pixels lit\n", renderWidth, renderHeight, steps / renderSeconds, 1e6 * renderSeconds / steps, 100 * renderSeconds / seconds, 100.0 * lit / frames.size());
+    }
+    std::printf("%llu episodes finished, mean return %.1f, mean length %.0f steps\n", (unsigned long long)episodes, episodes ? totalReturn / episodes : 0.0, episodes ? (double)steps / episodes : 0.0);
+    return 0;
+}
@@ -0,0 +1,109 @@
+// Times the batched intercept solver (see intercept.h) against its scalar version on random
+// targets in a screen-sized arena, and checks the solutions: the bullet and the target, wrapped
+// into the arena, should be in the same place when the solver says they meet.
+//
+//     bin/intercept_bench targets=10000 seconds=2
+//
+// Keys: targets, seconds and seed
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "intercept.h"
+#include "rng.h"
+#include "game_constants.h"
+
+using Clock = std::chrono::steady_clock;
+
+using SolveFn = void (*)(const InterceptQuery&, int, const float*, const float*, const float*, const float*, float*, float*);
+
+// Targets a second
+static double time_solver(SolveFn solve, const InterceptQuery& query, const std::vector<float>* fields, std::vector<float>& angles, std::vector<float>& ticks, double seconds) {
+    int n = (int)angles.size();
+    uint64_t solved = 0;
+    auto start = Clock::now();
+    double elapsed = 0;
+    while (elapsed < seconds) {
+        solve(query, n, fields[0].data(), fields[1].data(), fields[2].data(), fields[3].data(), angles.data(), ticks.data());
+	solved += n;
+	elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    }
+    return solved / elapsed;
+}
+
+static float wrap(float v, float size) {
+    return v - size * std::floor(v / size);
+}
+
+int main(int argc, char** argv) {
+
+    int numTargets = 10000;
+    double seconds = 2;
+    uint32_t seed = 1;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+	size_t equals = arg.find('=');
+	std::string key = arg.substr(0, equals);
+	std::string value = equals == std::string::npos ? "" : arg.substr(equals + 1);
+	if (key == "targets") numTargets = std::atoi(value.c_str());
+	else if (key == "seconds") seconds = std::atof(value.c_str());
+	else if (key == "seed") seed = (uint32_t)std::strtoul(value.c_str(), nullptr, 10);
+	else {
+	    std::cerr << "bad argument '" << arg << "'" << std::endl;
+	    return 1;
+	}
+    }
+    if (numTargets < 1 || seconds <= 0) {
+        std::cerr << "usage: " << argv[0] << " [targets=N] [seconds=N] [seed=N]" << std::endl;
+	return 1;
+    }
+
+    // Spread out like asteroids: anywhere in the arena, up to 3 pixels a tick each way
+    float width = GC::SCREEN_WIDTH;
+    float height = GC::SCREEN_HEIGHT;
+    Pcg32 rng(seed);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    InterceptQuery query = {{unit(rng) * width, unit(rng) * height}, (float)GC::BULLET_SPEED, width, height};
+    std::vector<float> fields[4];
+    for (int i = 0; i < numTargets; i++) {
+        fields[0].push_back(unit(rng) * width);
+	fields[1].push_back(unit(rng) * height);
+	fields[2].push_back(unit(rng) * 6 - 3);
+	fields[3].push_back(unit(rng) * 6 - 3);
+    }
+
+    std::vector<float> angles(numTargets);
+    std::vector<float> ticks(numTargets);
+    std::vector<float> scalarAngles(numTargets);
+    std::vector<float> scalarTicks(numTargets);
+    double batched = time_solver(solve_intercepts, query, fields, angles, ticks, seconds / 2);
+    double scalar = time_solver(solve_intercepts_scalar, query, fields, scalarAngles, scalarTicks, seconds / 2);
+
+    int solvable = 0;
+    int disagreements = 0;
+    float maxAngleError = 0;
+    float maxMiss = 0;
+    for (int i = 0; i < numTargets; i++) {
+        if ((ticks[i] < 0) != (scalarTicks[i] < 0)) disagreements++;
+	if (ticks[i] < 0 || scalarTicks[i] < 0) continue;
+	solvable++;
+	float error = std::fabs(std::remainder(angles[i] - scalarAngles[i], 2 * (float)GC::pi));
+	maxAngleError = std::max(maxAngleError, error);
+	float bulletX = query.muzzle.x + query.speed * ticks[i] * std::cos(angles[i]);
+	float bulletY = query.muzzle.y + query.speed * ticks[i] * std::sin(angles[i]);
+	float targetX = wrap(fields[0][i] + fields[2][i] * ticks[i], width);
+	float targetY = wrap(fields[1][i] + fields[3][i] * ticks[i], height);
+	float dx = std::remainder(bulletX - targetX, width);
+	float dy = std::remainder(bulletY - targetY, height);
+	maxMiss = std::max(maxMiss, std::sqrt(dx * dx + dy * dy));
+    }
+
+    std::printf("%d targets: batched %.1f M a second, scalar %.1f M a second (%.1fx)\n", numTargets, batched / 1e6, scalar / 1e6, batched / scalar);
+    std::printf("%d hittable inside the arena, %d where the two disagree, angles within %.2g rad of atan2, bullets within %.3f px of their targets\n", solvable, disagreements, maxAngleError, maxMiss);
+    return disagreements == 0 && maxMiss < 0.5f ? 0 : 1;
+}
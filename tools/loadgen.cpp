@@ -0,0 +1,245 @@
+// Load-tests a match server with hundreds of bot players. A few client threads open loopback
+// connections in steps, ramping up from start clients to max, and each connection is flown by
+// a bot sending the same inputs a player would. After each step it reports how the server
+// held up: round and match tick times, packet rates, and inputs that never arrived in time or
+// arrived too late to use.
+//
+//     bin/loadgen max=500
+//     bin/loadgen server=10.0.0.5:7777 threads=8 start=100 step=100 max=1000 step_seconds=10
+//
+// Keys: server (IP:PORT of a running server to load; without it one is run in this process,
+// and only then are its tick times and inputs reported), port, workers, players (per match)
+// and mode (coop or versus) for that server, threads (client threads), bot, start (clients in
+// the first step), step (clients added each step), max and step_seconds. Exits with 1 if a
+// client failed to decode a snapshot
+#include <raylib.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "world.h"
+#include "controllers.h"
+#include "snapshot.h"
+#include "match_server.h"
+#include "match_client.h"
+#include "game_constants.h"
+
+using Clock = std::chrono::steady_clock;
+
+// One thread's share of the clients, and its totals over them, brought up to date every frame
+struct ClientThread {
+    std::thread thread;
+    std::mutex mutex;
+    MatchClientStats stats;
+    int connected = 0;
+    // Frames the thread fell behind on, having too many clients to get round in one
+    uint64_t lateFrames = 0;
+};
+
+static void add_stats(MatchClientStats& total, const MatchClientStats& stats) {
+    total.packetsSent += stats.packetsSent;
+    total.packetsReceived += stats.packetsReceived;
+    total.bytesSent += stats.bytesSent;
+    total.bytesReceived += stats.bytesReceived;
+    total.snapshots += stats.snapshots;
+    total.snapshotsSkipped += stats.snapshotsSkipped;
+    total.decodeFailures += stats.decodeFailures;
+    total.matchesJoined += stats.matchesJoined;
+}
+
+// Runs clients index, index + numThreads and so on below target until stop is set, each with
+// its own bot deciding from the snapshots it's been sent
+static void run_clients(ClientThread& self, int index, int numThreads, NetAddress address, std::string botName, std::atomic<int>& target, std::atomic<bool>& stop) {
+    std::vector<std::unique_ptr<MatchClient>> clients;
+    std::vector<std::unique_ptr<Controller>> bots;
+    World scratch(GC::SCREEN_WIDTH, GC::SCREEN_HEIGHT, 0);
+
+    auto frameTime = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / GC::FPS));
+    auto nextFrame = Clock::now();
+    while (!stop) {
+        int want = std::max(0, (target - index + numThreads - 1) / numThreads);
+	while ((int)clients.size() < want) {
+	    int id = index + (int)clients.size() * numThreads;
+	    clients.push_back(std::make_unique<MatchClient>());
+	    bots.push_back(make_controller(botName, 1000 + id));
+	    if (!clients.back()->Open(address)) std::cerr << "loadgen: client " << id << " can't open a socket" << std::endl;
+	}
+
+	MatchClientStats totals;
+	int connected = 0;
+	for (size_t i = 0; i < clients.size(); i++) {
+	    MatchClient& client = *clients[i];
+	    client.Poll();
+	    PlayerInput input;
+	    double viewTick = -1;
+	    if (client.isConnected() && client.getSnapshotTick() != MATCH_NONE) {
+	        const std::vector<std::byte>& snapshot = client.getSnapshot();
+		if (load_snapshot(scratch, snapshot.data(), snapshot.size())) {
+		    input = bots[i]->Decide(scratch, scratch.getShip(client.getSlot()));
+		    viewTick = client.getSnapshotTick();
+		}
+	    }
+	    client.SendInput(input, viewTick);
+	    add_stats(totals, client.getStats());
+	    connected += client.isConnected();
+	}
+
+	bool late = Clock::now() > nextFrame + frameTime;
+	{
+	    std::lock_guard<std::mutex> lock(self.mutex);
+	    self.stats = totals;
+	    self.connected = connected;
+	    self.lateFrames += late;
+	}
+	nextFrame += frameTime;
+	if (late) nextFrame = Clock::now();
+	else std::this_thread::sleep_until(nextFrame);
+    }
+    for (auto& client : clients) client->Close();
+}
+
+int main(int argc, char** argv) {
+
+    ServerConfig config;
+    NetAddress remote;
+    bool useRemote = false;
+    int numThreads = 4;
+    std::string botName = "random";
+    int startClients = 50;
+    int stepClients = 50;
+    int maxClients = 500;
+    double stepSeconds = 5;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+	size_t equals = arg.find('=');
+	std::string key = arg.substr(0, equals);
+	std::string value = equals == std::string::npos ? "" : arg.substr(equals + 1);
+	if (key == "server" && parse_address(value, remote)) useRemote = true;
+	else if (key == "port") config.port = (uint16_t)std::atoi(value.c_str());
+	else if (key == "workers") config.workers = std::atoi(value.c_str());
+	else if (key == "players") config.playersPerMatch = std::atoi(value.c_str());
+	else if (key == "mode" && (value == "coop" || value == "versus")) config.mode = value == "coop" ? COOP : VERSUS;
+	else if (key == "threads") numThreads = std::atoi(value.c_str());
+	else if (key == "bot") botName = value;
+	else if (key == "start") startClients = std::atoi(value.c_str());
+	else if (key == "step") stepClients = std::atoi(value.c_str());
+	else if (key == "max") maxClients = std::atoi(value.c_str());
+	else if (key == "step_seconds") stepSeconds = std::atof(value.c_str());
+	else {
+	    std::cerr << "bad argument '" << arg << "'" << std::endl;
+	    return 1;
+	}
+    }
+
+    if (numThreads < 1 || startClients < 1 || stepClients < 1 || maxClients < startClients || stepSeconds <= 0 || config.playersPerMatch < 1 || config.playersPerMatch > GC::MAX_PLAYERS || !make_controller(botName, 0)) {
+        std::cerr << "usage: " << argv[0] << " [server=IP:PORT] [port=N] [workers=N] [players=1.." << GC::MAX_PLAYERS << "] [mode=coop|versus] [threads=N] [bot=NAME] [start=N] [step=N] [max=N] [step_seconds=N]" << std::endl;
+	return 1;
+    }
+    config.maxMatches = std::max(config.maxMatches, maxClients);
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    std::unique_ptr<MatchServer> server;
+    NetAddress address = remote;
+    if (!useRemote) {
+        server = std::make_unique<MatchServer>(config);
+	if (!server->Start()) {
+	    std::cerr << "loadgen: can't open port " << config.port << std::endl;
+	    return 1;
+	}
+	address = NetAddress{0x7f000001, server->getPort()};
+	std::printf("server on port %u with %d workers, ", server->getPort(), server->getNumWorkers());
+    } else {
+        std::printf("loading %s, ", format_address(remote).c_str());
+    }
+    std::printf("%d client threads, %s bots, %d to %d clients, %g s a step\n\n", numThreads, botName.c_str(), startClients, maxClients, stepSeconds);
+    std::printf(" clients  connected  matches  round p99  tick p50  tick p99  packets/s in  packets/s out  KiB/s out  inputs missing  inputs dropped  late frames\n");
+
+    std::atomic<int> target(startClients);
+    std::atomic<bool> stop(false);
+    std::vector<std::unique_ptr<ClientThread>> threads;
+    for (int i = 0; i < numThreads; i++) threads.push_back(std::make_unique<ClientThread>());
+    for (int i = 0; i < numThreads; i++) threads[i]->thread = std::thread(run_clients, std::ref(*threads[i]), i, numThreads, address, botName, std::ref(target), std::ref(stop));
+
+    // Totals over every client thread
+    auto client_totals = [&](MatchClientStats& stats, int& connected, uint64_t& lateFrames) {
+        stats = MatchClientStats();
+	connected = 0;
+	lateFrames = 0;
+	for (auto& t : threads) {
+	    std::lock_guard<std::mutex> lock(t->mutex);
+	    add_stats(stats, t->stats);
+	    connected += t->connected;
+	    lateFrames += t->lateFrames;
+	}
+    };
+
+    double budgetMs = 1000.0 / GC::FPS;
+    int keptUpWith = 0;
+    MatchClientStats before;
+    int connected;
+    uint64_t lateBefore = 0;
+    client_totals(before, connected, lateBefore);
+
+    auto frameTime = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / GC::FPS));
+    auto stepLength = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(stepSeconds));
+    auto stepStart = Clock::now();
+    auto nextFrame = stepStart;
+    MatchClientStats after;
+    while (true) {
+        if (server) server->RunRound();
+	nextFrame += frameTime;
+	if (Clock::now() < nextFrame) std::this_thread::sleep_until(nextFrame);
+	else nextFrame = Clock::now();
+	if (Clock::now() - stepStart < stepLength) continue;
+
+	// Report the step, from the clients' side and the server's when it's ours. What the
+	// clients sent is what the server took in
+	double seconds = std::chrono::duration<double>(Clock::now() - stepStart).count();
+	uint64_t lateAfter;
+	client_totals(after, connected, lateAfter);
+	double in = (after.packetsSent - before.packetsSent) / seconds;
+	double out = (after.packetsReceived - before.packetsReceived) / seconds;
+	double kibOut = (after.bytesReceived - before.bytesReceived) / 1024.0 / seconds;
+	if (server) {
+	    ServerStats stats = server->getStats();
+	    uint64_t inputs = stats.inputsApplied + stats.inputsMissing;
+	    double missing = inputs ? 100.0 * stats.inputsMissing / inputs : 0;
+	    double dropped = inputs ? 100.0 * stats.inputsDropped / inputs : 0;
+	    std::printf("%8d  %9d  %7d  %6.3f ms  %5.3f ms  %5.3f ms  %12.0f  %13.0f  %9.1f  %13.2f%%  %13.2f%%  %11llu\n", target.load(), connected, server->getNumMatches(), stats.rounds.PercentileMs(0.99), stats.matchTicks.PercentileMs(0.5), stats.matchTicks.PercentileMs(0.99), in, out, kibOut, missing, dropped, (unsigned long long)(lateAfter - lateBefore));
+	    if (stats.rounds.PercentileMs(0.99) <= budgetMs) keptUpWith = target;
+	    server->ClearStats();
+	} else {
+	    std::printf("%8d  %9d  %7s  %9s  %8s  %8s  %12.0f  %13.0f  %9.1f  %14s  %14s  %11llu\n", target.load(), connected, "-", "-", "-", "-", in, out, kibOut, "-", "-", (unsigned long long)(lateAfter - lateBefore));
+	}
+	std::fflush(stdout);
+	before = after;
+	lateBefore = lateAfter;
+
+	if (target >= maxClients) break;
+	target = std::min(target + stepClients, maxClients);
+	stepStart = Clock::now();
+    }
+
+    stop = true;
+    for (auto& t : threads) t->thread.join();
+    // Let the server hear the clients leave
+    if (server) server->RunRound();
+
+    client_totals(after, connected, lateBefore);
+    std::printf("\n%d matches joined, %llu snapshots, %llu skipped, %llu failed to decode\n", after.matchesJoined, (unsigned long long)after.snapshots, (unsigned long long)after.snapshotsSkipped, (unsigned long long)after.decodeFailures);
+    if (server) std::printf("the server kept its rounds within a frame up to %d clients\n", keptUpWith);
+    if (after.decodeFailures) {
+        std::cerr << "loadgen: clients failed to decode snapshots" << std::endl;
+	return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,319 @@
+// Benchmarks the netcode under one simulated network after another (see net_sim.h): a
+// two-player rollback netplay game and bot clients against a match server, both in-process
+// and all talking through relays. Reports rollbacks and their depth, prediction corrections
+// and bandwidth per client for each network.
+//
+//     bin/netbench
+//     bin/netbench net=wifi net=mobile,loss=5 net=lan/5@bad seconds=20
+//
+// Keys: net (a profile or script to run; give it more than once for several runs, or leave
+// it out for one run per preset), seconds (per run), clients, players (per match), mode (coop
+// or versus), interp, delay and rollback (for netplay), bot, seed and port (the server's; the
+// netplay guest uses the one after). Exits with 1 if the netplay peers desync or lose each
+// other, or a client fails to decode a snapshot
+#include <raylib.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "world.h"
+#include "controllers.h"
+#include "rollback.h"
+#include "netplay.h"
+#include "match_server.h"
+#include "match_client.h"
+#include "client_view.h"
+#include "net_sim.h"
+#include "game_constants.h"
+
+using Clock = std::chrono::steady_clock;
+
+struct BenchSettings {
+    double seconds = 10;
+    int numClients = 2;
+    ServerConfig server;
+    ClientViewSettings view;
+    NetplaySettings netplay;
+    std::string botName = "random";
+};
+
+struct BenchResult {
+    std::string name;
+    bool ok = true;
+
+    // Rollback netplay, both peers together
+    uint32_t frames = 0;
+    int stalls = 0;
+    RollbackStats rollback;
+    int desyncs = 0;
+    bool lost = false;
+    double netplayUpKiBs = 0;
+
+    // Clients, all together
+    ClientViewStats view;
+    MatchClientStats client;
+    double downKiBs = 0;
+    double upKiBs = 0;
+
+    // Every relay, both ways
+    LinkStats link;
+};
+
+static double kib_per_second(uint64_t bytes, double seconds, int count) {
+    return seconds > 0 && count > 0 ? bytes / 1024.0 / seconds / count : 0.0;
+}
+
+static BenchResult run(const NetScript& script, const BenchSettings& settings) {
+    BenchResult result;
+    result.name = script.phases.front().profile.name;
+    for (size_t i = 1; i < script.phases.size(); i++) result.name += "/" + script.phases[i].profile.name;
+    auto frameTime = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / GC::FPS));
+
+    MatchServer server(settings.server);
+    if (!server.Start()) {
+        std::cerr << "netbench: can't open port " << settings.server.port << std::endl;
+	result.ok = false;
+	return result;
+    }
+    NetAddress serverAddress{0x7f000001, server.getPort()};
+
+    // Every client has a relay of its own in front of the server, and the netplay host has one
+    // in front of the guest. Each relay gets its own seed so they don't lose the same packets
+    std::vector<std::unique_ptr<NetSimRelay>> relays;
+    std::vector<std::unique_ptr<MatchClient>> clients;
+    std::vector<std::unique_ptr<ClientView>> views;
+    std::vector<std::unique_ptr<Controller>> bots;
+    std::vector<int> joined(settings.numClients, 0);
+    for (int i = 0; i < settings.numClients; i++) {
+        relays.push_back(std::make_unique<NetSimRelay>(script, settings.netplay.seed + 2 * i));
+	clients.push_back(std::make_unique<MatchClient>());
+	views.push_back(std::make_unique<ClientView>(settings.view));
+	bots.push_back(make_controller(settings.botName, settings.netplay.seed + i));
+	if (!relays.back()->Open(serverAddress) || !clients.back()->Open(NetAddress{0x7f000001, relays.back()->getPort()})) {
+	    result.ok = false;
+	    return result;
+	}
+    }
+
+    NetplaySettings guestSettings = settings.netplay;
+    guestSettings.slot = 1;
+    guestSettings.port = (uint16_t)(settings.server.port + 1);
+    auto netplayRelay = std::make_unique<NetSimRelay>(script, settings.netplay.seed + 2 * settings.numClients);
+    NetplayPeer host;
+    NetplayPeer guest;
+    NetplaySettings hostSettings = settings.netplay;
+    hostSettings.slot = 0;
+    hostSettings.port = 0;
+    if (!netplayRelay->Open(NetAddress{0x7f000001, guestSettings.port})) {
+        result.ok = false;
+	return result;
+    }
+    hostSettings.peer = NetAddress{0x7f000001, netplayRelay->getPort()};
+    guestSettings.peer = NetAddress{0x7f000001, netplayRelay->getFarSidePort()};
+    if (!host.Open(hostSettings) || !guest.Open(guestSettings)) {
+        result.ok = false;
+	return result;
+    }
+
+    std::atomic<bool> stop(false);
+    std::thread serverThread([&]() {
+        auto nextRound = Clock::now();
+	while (!stop) {
+	    server.RunRound();
+	    nextRound += frameTime;
+	    std::this_thread::sleep_until(nextRound);
+	}
+    });
+    std::thread relayThread([&]() {
+        while (!stop) {
+	    for (auto& relay : relays) relay->Pump();
+	    netplayRelay->Pump();
+	    std::this_thread::sleep_for(std::chrono::microseconds(250));
+	}
+    });
+
+    // The netplay peers shake hands before the clock starts, since the guest's game depends on
+    // the host's settings
+    NetplayPeer* peers[2] = {&host, &guest};
+    std::unique_ptr<World> worlds[2];
+    std::unique_ptr<RollbackSession> sessions[2];
+    std::unique_ptr<Controller> pilots[2];
+    bool shook[2] = {false, false};
+    auto waitStart = Clock::now();
+    while (!(shook[0] && shook[1]) && Clock::now() - waitStart < std::chrono::seconds(10)) {
+        for (int p = 0; p < 2; p++) {
+	    if (!shook[p]) shook[p] = peers[p]->Handshake();
+	}
+	std::this_thread::sleep_for(frameTime);
+    }
+    for (int p = 0; p < 2 && shook[0] && shook[1]; p++) {
+        const NetplaySettings& s = peers[p]->getSettings();
+	worlds[p] = std::make_unique<World>(GC::SCREEN_WIDTH, GC::SCREEN_HEIGHT, s.seed);
+	worlds[p]->mode = s.mode;
+	sessions[p] = std::make_unique<RollbackSession>(*worlds[p], 2, s.slot, s.inputDelay, s.maxRollback);
+	pilots[p] = make_controller(settings.botName, s.seed + s.slot);
+    }
+    result.lost = !sessions[0];
+
+    auto start = Clock::now();
+    auto nextFrame = start;
+    while (Clock::now() - start < std::chrono::duration<double>(settings.seconds)) {
+        for (int i = 0; i < settings.numClients; i++) {
+	    MatchClient& client = *clients[i];
+	    ClientView& view = *views[i];
+	    bool newer = client.Poll();
+	    if (client.getStats().matchesJoined != joined[i]) {
+	        joined[i] = client.getStats().matchesJoined;
+		view.Reset(client.getSlot());
+	    }
+	    if (newer) view.AddSnapshot(client.getSnapshotTick(), client.getLastAppliedInput(), client.getSnapshot());
+	    PlayerInput input;
+	    if (view.hasView()) input = bots[i]->Decide(view.getView(), view.getView().getShip(view.getSlot()));
+	    uint32_t frame = client.SendInput(input, view.hasView() ? view.getRenderTick() : -1);
+	    if (frame != MATCH_NONE) view.Update(frame, input);
+	}
+
+	for (int p = 0; p < 2 && !result.lost; p++) {
+	    NetplayPeer& peer = *peers[p];
+	    RollbackSession& session = *sessions[p];
+	    peer.Receive(session);
+	    if (peer.isTimedOut()) result.lost = true;
+	    if (!session.CanAdvance()) result.stalls++;
+	    else if (peer.getFrameAdvantage(session) <= 1 || session.getFrame() % 30 != 0) session.AdvanceFrame(pilots[p]->Decide(*worlds[p], worlds[p]->getShip(session.getLocalSlot())));
+	    peer.SendInputs(session);
+	}
+
+	nextFrame += frameTime;
+	std::this_thread::sleep_until(nextFrame);
+	// Nothing is drawn, but a frame would reach the screen at the next vsync
+	for (auto& view : views) view->Presented();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    for (auto& client : clients) client->Close();
+    const LinkProfile& last = script.phases.back().profile;
+    std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(last.latencyMs + last.jitterMs + SimulatedLink::REORDER_DELAY_MS + last.queueMs + 50));
+    stop = true;
+    relayThread.join();
+    serverThread.join();
+
+    for (int i = 0; i < settings.numClients; i++) {
+        const ClientViewStats& v = views[i]->getStats();
+	result.view.inputToDisplay.Merge(v.inputToDisplay);
+	result.view.inputToSnapshot.Merge(v.inputToSnapshot);
+	result.view.snapshots += v.snapshots;
+	result.view.replayedFrames += v.replayedFrames;
+	result.view.corrections += v.corrections;
+	result.view.correctionPixels += v.correctionPixels;
+	result.view.maxCorrectionPixels = std::max(result.view.maxCorrectionPixels, v.maxCorrectionPixels);
+	result.view.starved += v.starved;
+	const MatchClientStats& c = clients[i]->getStats();
+	result.client.bytesReceived += c.bytesReceived;
+	result.client.bytesSent += c.bytesSent;
+	result.client.snapshotsSkipped += c.snapshotsSkipped;
+	result.client.decodeFailures += c.decodeFailures;
+	result.link.Merge(relays[i]->getUpStats());
+	result.link.Merge(relays[i]->getDownStats());
+    }
+    result.downKiBs = kib_per_second(result.client.bytesReceived, seconds, settings.numClients);
+    result.upKiBs = kib_per_second(result.client.bytesSent, seconds, settings.numClients);
+
+    if (!result.lost) {
+        for (int p = 0; p < 2; p++) {
+	    const RollbackStats& r = sessions[p]->getStats();
+	    result.frames += sessions[p]->getFrame();
+	    result.rollback.rollbacks += r.rollbacks;
+	    result.rollback.maxDepth = std::max(result.rollback.maxDepth, r.maxDepth);
+	    result.rollback.resimulatedFrames += r.resimulatedFrames;
+	    result.rollback.maxRollbackSeconds = std::max(result.rollback.maxRollbackSeconds, r.maxRollbackSeconds);
+	    result.desyncs += sessions[p]->getDesyncs();
+	    result.netplayUpKiBs += kib_per_second(peers[p]->getStats().bytesSent, seconds, 2);
+	}
+    }
+    result.link.Merge(netplayRelay->getUpStats());
+    result.link.Merge(netplayRelay->getDownStats());
+    result.ok = !result.lost && result.desyncs == 0 && result.client.decodeFailures == 0;
+    return result;
+}
+
+int main(int argc, char** argv) {
+
+    BenchSettings settings;
+    settings.server.port = 7790;
+    settings.server.workers = 1;
+    settings.netplay.seed = 1;
+    std::vector<NetScript> scripts;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+	size_t equals = arg.find('=');
+	std::string key = arg.substr(0, equals);
+	std::string value = equals == std::string::npos ? "" : arg.substr(equals + 1);
+	NetScript script;
+	if (key == "net" && parse_net_script(value, script)) scripts.push_back(script);
+	else if (key == "seconds") settings.seconds = std::atof(value.c_str());
+	else if (key == "clients") settings.numClients = std::atoi(value.c_str());
+	else if (key == "players") settings.server.playersPerMatch = std::atoi(value.c_str());
+	else if (key == "mode" && (value == "coop" || value == "versus")) settings.server.mode = settings.netplay.mode = value == "coop" ? COOP : VERSUS;
+	else if (key == "interp") settings.view.interpolationTicks = (float)std::atof(value.c_str());
+	else if (key == "delay") settings.netplay.inputDelay = std::atoi(value.c_str());
+	else if (key == "rollback") settings.netplay.maxRollback = std::atoi(value.c_str());
+	else if (key == "bot") settings.botName = value;
+	else if (key == "seed") settings.netplay.seed = (unsigned int)std::strtoul(value.c_str(), nullptr, 10);
+	else if (key == "port") settings.server.port = (uint16_t)std::atoi(value.c_str());
+	else {
+	    std::cerr << "bad argument '" << arg << "'" << std::endl;
+	    return 1;
+	}
+    }
+
+    if (settings.numClients < 1 || settings.server.playersPerMatch < 1 || settings.server.playersPerMatch > GC::MAX_PLAYERS || settings.seconds <= 0 || !make_controller(settings.botName, 0)) {
+        std::cerr << "usage: " << argv[0] << " [net=SCRIPT]... [seconds=N] [clients=N] [players=N] [mode=coop|versus] [interp=TICKS] [delay=N] [rollback=N] [bot=NAME] [seed=N] [port=N]" << std::endl;
+	return 1;
+    }
+    if (scripts.empty()) {
+        for (const LinkProfile& preset : link_presets()) scripts.push_back(NetScript{{{0, preset}}});
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+    std::vector<BenchResult> results;
+    for (const NetScript& script : scripts) {
+        results.push_back(run(script, settings));
+	const BenchResult& r = results.back();
+	std::printf("%-16s %.0f s, %s\n", r.name.c_str(), settings.seconds, r.ok ? "ok" : "FAILED");
+	std::fflush(stdout);
+    }
+
+    std::printf("\nrollback netplay, %d frames of input delay, rollback up to %d\n", settings.netplay.inputDelay, settings.netplay.maxRollback);
+    std::printf("%-16s %8s %8s %10s %10s %10s %12s %8s %10s\n", "network", "frames", "stalls", "rollbacks", "avg depth", "max depth", "worst (ms)", "desyncs", "KiB/s up");
+    for (const BenchResult& r : results) {
+        if (r.lost) {
+	    std::printf("%-16s peers lost each other\n", r.name.c_str());
+	    continue;
+	}
+	std::printf("%-16s %8u %8d %10d %10.2f %10d %12.3f %8d %10.2f\n", r.name.c_str(), r.frames, r.stalls, r.rollback.rollbacks, r.rollback.rollbacks ? (double)r.rollback.resimulatedFrames / r.rollback.rollbacks : 0.0, r.rollback.maxDepth, 1000 * r.rollback.maxRollbackSeconds, r.desyncs, r.netplayUpKiBs);
+    }
+
+    std::printf("\nclient/server, %d clients, %.1f ticks of interpolation\n", settings.numClients, settings.view.interpolationTicks);
+    std::printf("%-16s %10s %12s %10s %10s %14s %9s %9s %11s %9s\n", "network", "snapshots", "corrections", "avg px", "worst px", "snapshot p99", "starved", "skipped", "KiB/s down", "KiB/s up");
+    for (const BenchResult& r : results) {
+        double frames = settings.seconds * GC::FPS * settings.numClients;
+	std::printf("%-16s %10llu %12llu %10.2f %10.1f %11.1f ms %8.2f%% %9llu %11.2f %9.2f\n", r.name.c_str(), (unsigned long long)r.view.snapshots, (unsigned long long)r.view.corrections, r.view.corrections ? r.view.correctionPixels / r.view.corrections : 0.0, r.view.maxCorrectionPixels, r.view.inputToSnapshot.PercentileMs(0.99), 100.0 * r.view.starved / frames, (unsigned long long)r.client.snapshotsSkipped, r.downKiBs, r.upKiBs);
+    }
+
+    std::printf("\nlinks, every relay both ways\n");
+    std::printf("%-16s %10s %8s %8s %10s %13s %13s\n", "network", "packets", "lost", "queued", "reordered", "held p50", "held p99");
+    for (const BenchResult& r : results) {
+        std::printf("%-16s %10llu %8llu %8llu %10llu %10.1f ms %10.1f ms\n", r.name.c_str(), (unsigned long long)r.link.packets, (unsigned long long)r.link.lost, (unsigned long long)r.link.queueDrops, (unsigned long long)r.link.reordered, r.link.delay.PercentileMs(0.5), r.link.delay.PercentileMs(0.99));
+    }
+
+    bool ok = std::all_of(results.begin(), results.end(), [](const BenchResult& r) { return r.ok; });
+    if (!ok) std::cerr << "netbench: a run desynced, lost its peer or failed to decode a snapshot" << std::endl;
+    return ok ? 0 : 1;
+}
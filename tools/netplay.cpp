@@ -0,0 +1,158 @@
+// Plays one side of a two-player rollback netplay game headless, with a bot at the controls,
+// and reports how much rolling back it had to do and whether the two sides stayed in sync.
+// Run two of them, one per slot:
+//
+//     bin/netplay slot=0 port=7000 peer=127.0.0.1:7001 mode=versus &
+//     bin/netplay slot=1 port=7001 peer=127.0.0.1:7000
+//
+// Keys: slot, port, peer, frames (how long to play), bot, seed, mode (coop or versus), delay
+// (frames of input delay), rollback (most frames that can be rolled back), fast=1 to run flat
+// out instead of at the game's frame rate, and force_rollback=N to roll back as far as allowed
+// every N frames, to time the worst case. The host's seed, mode, delay and rollback are the
+// ones used. Exits with 1 if the peers desync, the peer stops answering or the worst rollback
+// takes longer than a frame
+#include <raylib.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include "world.h"
+#include "controllers.h"
+#include "rollback.h"
+#include "netplay.h"
+#include "game_constants.h"
+
+using Clock = std::chrono::steady_clock;
+
+int main(int argc, char** argv) {
+
+    NetplaySettings settings;
+    settings.seed = std::random_device()();
+    int frames = 1800;
+    std::string botName = "random";
+    bool fast = false;
+    int forceRollback = 0;
+    bool havePeer = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+	size_t equals = arg.find('=');
+	std::string key = arg.substr(0, equals);
+	std::string value = equals == std::string::npos ? "" : arg.substr(equals + 1);
+	if (key == "slot") settings.slot = std::atoi(value.c_str());
+	else if (key == "port") settings.port = (uint16_t)std::atoi(value.c_str());
+	else if (key == "peer") havePeer = parse_address(value, settings.peer);
+	else if (key == "frames") frames = std::atoi(value.c_str());
+	else if (key == "bot") botName = value;
+	else if (key == "seed") settings.seed = (unsigned int)std::strtoul(value.c_str(), nullptr, 10);
+	else if (key == "mode" && (value == "coop" || value == "versus")) settings.mode = value == "coop" ? COOP : VERSUS;
+	else if (key == "delay") settings.inputDelay = std::atoi(value.c_str());
+	else if (key == "rollback") settings.maxRollback = std::atoi(value.c_str());
+	else if (key == "fast") fast = value == "1";
+	else if (key == "force_rollback") forceRollback = std::atoi(value.c_str());
+	else {
+	    std::cerr << "bad argument '" << arg << "'" << std::endl;
+	    return 1;
+	}
+    }
+
+    if (!havePeer || (settings.slot != 0 && settings.slot != 1)) {
+        std::cerr << "usage: " << argv[0] << " slot=0|1 port=N peer=IP:PORT [frames=N] [bot=NAME] [seed=N] [mode=coop|versus] [delay=N] [rollback=N] [fast=0|1] [force_rollback=N]" << std::endl;
+	return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    NetplayPeer peer;
+    if (!peer.Open(settings)) return 1;
+
+    // Wait for the other side
+    auto frameTime = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / GC::FPS));
+    auto waitStart = Clock::now();
+    while (!peer.Handshake()) {
+        if (Clock::now() - waitStart > std::chrono::seconds(30)) {
+	    std::cerr << "netplay: no answer from " << format_address(settings.peer) << std::endl;
+	    return 1;
+	}
+	std::this_thread::sleep_for(frameTime);
+    }
+    settings = peer.getSettings();
+
+    std::unique_ptr<Controller> bot = make_controller(botName, settings.seed + settings.slot);
+    if (!bot) {
+        std::cerr << "unknown bot '" << botName << "'" << std::endl;
+	return 1;
+    }
+
+    World world(GC::SCREEN_WIDTH, GC::SCREEN_HEIGHT, settings.seed);
+    world.mode = settings.mode;
+    RollbackSession session(world, 2, settings.slot, settings.inputDelay, settings.maxRollback);
+
+    // Play until both sides have a checksum for the first checksum frame at or after frames,
+    // then keep going a little so the peer gets our last inputs too
+    uint32_t target = (frames + RollbackSession::CHECKSUM_INTERVAL - 1) / RollbackSession::CHECKSUM_INTERVAL * RollbackSession::CHECKSUM_INTERVAL;
+    uint64_t finalChecksum = 0;
+    bool haveFinal = false;
+    Clock::time_point finishedAt;
+    int stalls = 0;
+    int skipped = 0;
+    bool timedOut = false;
+
+    auto start = Clock::now();
+    auto nextFrame = start;
+    while (true) {
+        peer.Receive(session);
+	if (peer.isTimedOut()) {
+	    timedOut = true;
+	    break;
+	}
+
+	if (!haveFinal) {
+	    uint32_t remoteFrame;
+	    uint64_t remoteChecksum;
+	    haveFinal = session.getChecksum(target, finalChecksum) && peer.getRemoteChecksum(remoteFrame, remoteChecksum) && remoteFrame >= target;
+	    if (haveFinal) finishedAt = Clock::now();
+	}
+	if (haveFinal && Clock::now() - finishedAt > std::chrono::milliseconds(500)) break;
+
+	if (!session.CanAdvance()) {
+	    stalls++;
+	} else if (peer.getFrameAdvantage(session) > 1 && session.getFrame() % 30 == 0 && !fast) {
+	    // Running ahead of the peer. Give it a frame to catch up
+	    skipped++;
+	} else {
+	    if (forceRollback > 0 && session.getFrame() > 0 && session.getFrame() % forceRollback == 0) session.ForceRollback(settings.maxRollback);
+	    session.AdvanceFrame(bot->Decide(world, world.getShip(settings.slot)));
+	}
+	peer.SendInputs(session);
+
+	if (fast) {
+	    if (!session.CanAdvance()) std::this_thread::sleep_for(std::chrono::microseconds(100));
+	} else {
+	    nextFrame += frameTime;
+	    std::this_thread::sleep_until(nextFrame);
+	}
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    const RollbackStats& stats = session.getStats();
+    const NetplayStats& net = peer.getStats();
+    double budgetMs = 1000.0 / GC::FPS;
+    double worstMs = 1000 * stats.maxRollbackSeconds;
+    std::printf("slot            %d of 2 (%s, seed %u, delay %d, rollback %d)\n", settings.slot, settings.mode == COOP ? "co-op" : "versus", settings.seed, settings.inputDelay, settings.maxRollback);
+    std::printf("frames          %u in %.1f s, %d stalled waiting for input, %d skipped to let the peer catch up\n", session.getFrame(), seconds, stalls, skipped);
+    std::printf("rollbacks       %d, %.2f frames deep on average, %d at most, %llu frames resimulated\n", stats.rollbacks, stats.rollbacks ? (double)stats.resimulatedFrames / stats.rollbacks : 0.0, stats.maxDepth, (unsigned long long)stats.resimulatedFrames);
+    std::printf("rollback time   %.3f ms on average, %.3f ms worst (frame budget %.1f ms)\n", stats.rollbacks ? 1000 * stats.rollbackSeconds / stats.rollbacks : 0.0, worstMs, budgetMs);
+    std::printf("network         %llu packets sent, %llu received, %llu ignored, %.1f KiB/s up\n", (unsigned long long)net.packetsSent, (unsigned long long)net.packetsReceived, (unsigned long long)net.packetsIgnored, net.bytesSent / 1024.0 / seconds);
+    std::printf("score           %d\n", world.state.score);
+    if (haveFinal) std::printf("checksum        %016llx at frame %u\n", (unsigned long long)finalChecksum, target);
+    std::printf("desyncs         %d\n", session.getDesyncs());
+
+    if (timedOut) std::cerr << "netplay: lost " << format_address(settings.peer) << std::endl;
+    if (worstMs > budgetMs) std::cerr << "netplay: worst rollback took longer than a frame" << std::endl;
+    return !timedOut && haveFinal && session.getDesyncs() == 0 && worstMs <= budgetMs ? 0 : 1;
+}
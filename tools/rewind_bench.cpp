@@ -0,0 +1,135 @@
+// Plays a scenario at the game's frame rate recording every tick into a rewind history (see
+// rewind.h), then runs time backwards through the whole of it, a tick at a time and four at a
+// time, the way holding the rewind key does. Reports what recording costs the frame loop and
+// the encoding thread, how much memory the history holds and how long each step back takes,
+// and checks every step lands on the very tick it should.
+//
+//     bin/rewind_bench scenarios/stress.scenario large_asteroids=50000 frames=900
+//
+// Takes the same keys as scenario_runner, plus seconds= (the history's length),
+// keyframe_interval=, skip_ticks= (ticks a frame of fast rewinding), budget_mib= and paced= (0
+// to run flat out rather than at the game's frame rate)
+#include <raylib.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "world.h"
+#include "scenario.h"
+#include "controllers.h"
+#include "snapshot.h"
+#include "rewind.h"
+
+using Clock = std::chrono::steady_clock;
+
+static double percentile(std::vector<double> values, double p) {
+    if (values.empty()) return 0;
+    size_t i = std::min(values.size() - 1, (size_t)(p * values.size()));
+    std::nth_element(values.begin(), values.begin() + i, values.end());
+    return values[i];
+}
+
+int main(int argc, char** argv) {
+
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " <scenario file> [key=value ...]" << std::endl;
+	return 1;
+    }
+
+    Scenario scenario;
+    RewindSettings settings;
+    bool paced = true;
+    if (!load_scenario(argv[1], scenario)) return 1;
+    for (int i = 2; i < argc; i++) {
+        std::string arg = argv[i];
+	size_t equals = arg.find('=');
+	std::string key = arg.substr(0, equals);
+	std::string value = equals == std::string::npos ? "" : arg.substr(equals + 1);
+	if (key == "seconds") settings.maxTicks = (int)(std::atof(value.c_str()) * GC::FPS);
+	else if (key == "keyframe_interval") settings.keyframeInterval = std::atoi(value.c_str());
+	else if (key == "skip_ticks") settings.skipTicks = std::atoi(value.c_str());
+	else if (key == "paced") paced = std::atoi(value.c_str()) != 0;
+	else if (key == "budget_mib") settings.budgetBytes = (size_t)(std::atof(value.c_str()) * 1024 * 1024);
+	else if (equals == std::string::npos || !set_scenario_value(scenario, key, value)) {
+	    std::cerr << "bad override '" << arg << "'" << std::endl;
+	    return 1;
+	}
+    }
+
+    std::unique_ptr<Controller> bot = make_controller(scenario.bot, scenario.seed);
+    if (!bot) {
+        std::cerr << "unknown bot '" << scenario.bot << "'" << std::endl;
+	return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    World world(scenario.worldWidth, scenario.worldHeight, scenario.seed);
+    Entity ship = start_scenario(world, scenario);
+    if (ship == NULL_ENTITY) return 1;
+
+    RewindHistory history(settings);
+    std::vector<std::byte> snapshot;
+    // Each tick's checksum, by tick
+    std::vector<uint64_t> checksums;
+    std::vector<double> recordSeconds;
+    double tickSeconds = 0;
+
+    auto frameDue = Clock::now();
+    for (int frame = 0; frame < scenario.frames; frame++) {
+        auto tickStart = Clock::now();
+	world.Tick(bot->Decide(world, ship));
+	world.state.status = PLAYING;
+	tickSeconds += seconds_since(tickStart);
+
+	history.Record(world);
+	recordSeconds.push_back(history.getStats().lastRecordSeconds);
+
+	save_snapshot(world, snapshot);
+	checksums.resize(world.state.tick + 1);
+	checksums[world.state.tick] = snapshot_checksum(snapshot.data(), snapshot.size());
+
+	if (paced) {
+	    frameDue += std::chrono::microseconds(1000000 / GC::FPS);
+	    std::this_thread::sleep_until(frameDue);
+	}
+    }
+
+    history.Flush();
+    RewindStats recorded = history.getStats();
+    uint64_t latestTick = world.state.tick;
+    double mib = 1024.0 * 1024.0;
+    int frames = scenario.frames > 0 ? scenario.frames : 1;
+    std::printf("scenario        %s (seed %u, bot %s)\n", argv[1], scenario.seed, scenario.bot.c_str());
+    std::printf("world           %dx%d, %d entities at the end, %d ticks at %.3f ms/tick\n", world.width, world.height, world.registry.getNumEntities(), scenario.frames, 1000 * tickSeconds / frames);
+    std::printf("snapshot        %.1f KiB\n", snapshot.size() / 1024.0);
+    std::printf("history         %d ticks (%.1f s) back, %d keyframes, %.1f MiB of a %.0f MiB budget\n", recorded.depth, (double)recorded.depth / GC::FPS, recorded.keyframes, recorded.bytes / mib, settings.budgetBytes / mib);
+    std::printf("record          %.3f ms/tick p50, %.3f ms p99, %.3f ms max in the frame loop%s\n", 1000 * percentile(recordSeconds, 0.5), 1000 * percentile(recordSeconds, 0.99), 1000 * percentile(recordSeconds, 1.0), paced ? " at the game's frame rate" : "");
+    std::printf("encode          %.3f ms/tick p50, %.3f ms p99, %.3f ms max on the encoding thread\n", recorded.encodeTimes.PercentileMs(0.5), recorded.encodeTimes.PercentileMs(0.99), recorded.encodeTimes.getMaxMs());
+
+    int mismatches = 0;
+    for (int speed : {1, settings.skipTicks}) {
+        std::vector<double> seekSeconds;
+	int maxDecodes = 0;
+	for (int back = speed; back <= recorded.depth; back += speed) {
+	    auto seekStart = Clock::now();
+	    if (!history.Seek(world, back)) {
+	        mismatches++;
+		break;
+	    }
+	    seekSeconds.push_back(seconds_since(seekStart));
+	    maxDecodes = std::max(maxDecodes, history.getStats().lastSeekDecodes);
+	    save_snapshot(world, snapshot);
+	    if (world.state.tick != latestTick - back || snapshot_checksum(snapshot.data(), snapshot.size()) != checksums[world.state.tick]) mismatches++;
+	}
+	// The first step back starts from the latest tick, as it would in the game
+	history.Seek(world, 0);
+	std::printf("rewind %dx       %zu steps, %.3f ms p50, %.3f ms max, up to %d decodes a step\n", speed, seekSeconds.size(), 1000 * percentile(seekSeconds, 0.5), 1000 * percentile(seekSeconds, 1.0), maxDecodes);
+    }
+    std::printf("mismatches      %d\n", mismatches);
+    return mismatches == 0 ? 0 : 1;
+}
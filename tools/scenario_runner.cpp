@@ -0,0 +1,119 @@
+// Runs a scenario without a window as fast as possible and reports how quickly the simulation
+// ticks, where the time goes and how much memory it took.
+//
+//     bin/scenario_runner scenarios/stress.scenario [key=value ...]
+//
+// key=value arguments override the file, e.g. large_asteroids=1000000 to sweep entity counts.
+// save_snapshot=FILE writes the world out at the end of the run, so a big starting world can be
+// built once and then loaded straight from the snapshot by later runs:
+//
+//     bin/scenario_runner scenarios/stress.scenario frames=0 save_snapshot=stress.snap
+//     bin/scenario_runner scenarios/stress.scenario snapshot=stress.snap
+#include <raylib.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include "world.h"
+#include "scenario.h"
+#include "controllers.h"
+#include "alloc_counter.h"
+#include "process_stats.h"
+#include "snapshot.h"
+
+int main(int argc, char** argv) {
+
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " <scenario file> [key=value ...]" << std::endl;
+	return 1;
+    }
+
+    Scenario scenario;
+    std::string savePath;
+    if (!load_scenario(argv[1], scenario)) return 1;
+    for (int i = 2; i < argc; i++) {
+        std::string arg = argv[i];
+	size_t equals = arg.find('=');
+	if (equals != std::string::npos && arg.substr(0, equals) == "save_snapshot") {
+	    savePath = arg.substr(equals + 1);
+	    continue;
+	}
+	if (equals == std::string::npos || !set_scenario_value(scenario, arg.substr(0, equals), arg.substr(equals + 1))) {
+	    std::cerr << "bad override '" << arg << "'" << std::endl;
+	    return 1;
+	}
+    }
+
+    std::unique_ptr<Controller> bot = make_controller(scenario.bot, scenario.seed);
+    if (!bot) {
+        std::cerr << "unknown bot '" << scenario.bot << "'" << std::endl;
+	return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    auto setupStart = std::chrono::steady_clock::now();
+    World world(scenario.worldWidth, scenario.worldHeight, scenario.seed);
+    Entity ship = start_scenario(world, scenario);
+    if (ship == NULL_ENTITY) return 1;
+    double setupSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - setupStart).count();
+    int startAsteroids = world.getNumAsteroids();
+
+    // Where the ship has been, so it's plain it can reach the whole world and not just a
+    // screen's worth of it
+    Vector2 shipStart = world.registry.get<Player>(ship).getMidpoint();
+    Vector2 shipMin = shipStart;
+    Vector2 shipMax = shipStart;
+
+    world.profileSystems = true;
+    int shipDestroyedAt = -1;
+    double botSeconds = 0;
+    uint64_t allocsAtStart = AllocCounter::getCount();
+
+    auto runStart = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < scenario.frames; frame++) {
+        auto botStart = std::chrono::steady_clock::now();
+	PlayerInput input = bot->Decide(world, ship);
+	botSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - botStart).count();
+
+	world.Tick(input);
+	if (world.registry.IsAlive(ship)) {
+	    Vector2 midpoint = world.registry.get<Player>(ship).getMidpoint();
+	    shipMin = {std::min(shipMin.x, midpoint.x), std::min(shipMin.y, midpoint.y)};
+	    shipMax = {std::max(shipMax.x, midpoint.x), std::max(shipMax.y, midpoint.y)};
+	}
+
+	// The run carries on regardless, but note when the ship would have been lost
+	if (world.state.status == GAME_OVER && shipDestroyedAt < 0) shipDestroyedAt = frame;
+	world.state.status = PLAYING;
+    }
+    double runSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - runStart).count();
+    uint64_t runAllocs = AllocCounter::getCount() - allocsAtStart;
+
+    int frames = scenario.frames > 0 ? scenario.frames : 1;
+    std::printf("scenario        %s (seed %u, bot %s)\n", argv[1], scenario.seed, scenario.bot.c_str());
+    std::printf("world           %dx%d, %d asteroids at start, %d at end, %d bullets at end\n", world.width, world.height, startAsteroids, world.getNumAsteroids(), world.getNumBullets());
+    std::printf("ship            started at %.0f,%.0f, flew over x %.0f to %.0f, y %.0f to %.0f\n", shipStart.x, shipStart.y, shipMin.x, shipMax.x, shipMin.y, shipMax.y);
+    std::printf("setup           %.3f s%s\n", setupSeconds, scenario.snapshot.empty() ? "" : " (from snapshot)");
+    std::printf("ticks           %d in %.3f s = %.1f ticks/s (%.3f ms/tick)\n", scenario.frames, runSeconds, scenario.frames / runSeconds, 1000 * runSeconds / frames);
+    std::printf("per phase           ms/tick    share\n");
+    std::printf("  %-18s%8.4f  %6.1f%%\n", "bot", 1000 * botSeconds / frames, 100 * botSeconds / runSeconds);
+    for (size_t i = 0; i < world.systems.size(); i++) {
+        std::printf("  %-18s%8.4f  %6.1f%%\n", world.systems[i].name, 1000 * world.systemSeconds[i] / frames, 100 * world.systemSeconds[i] / runSeconds);
+    }
+    std::printf("allocations     %llu during run (%.2f per tick)\n", (unsigned long long)runAllocs, (double)runAllocs / frames);
+    std::printf("peak memory     %.1f MiB\n", peak_rss_bytes() / (1024.0 * 1024.0));
+    std::printf("score           %d, level %d", world.state.score, world.state.level);
+    if (shipDestroyedAt >= 0) std::printf(", ship hit at tick %d", shipDestroyedAt);
+    std::printf("\n");
+
+    if (!savePath.empty()) {
+        auto saveStart = std::chrono::steady_clock::now();
+	if (!save_snapshot_file(world, savePath)) return 1;
+	double saveSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - saveStart).count();
+	std::printf("snapshot        saved to %s in %.3f s\n", savePath.c_str(), saveSeconds);
+    }
+
+    return 0;
+}
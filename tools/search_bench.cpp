@@ -0,0 +1,99 @@
+// Plays a scenario with the search bot (see SearchBot and lookahead.h) and reports how fast
+// its lookahead runs on one core: how long a SimState takes to capture and clone, simulated
+// ticks a second, and rollouts a second, so the bot's search budget can be sized for a
+// machine. The scenario's own bot setting is ignored.
+//
+//     bin/search_bench scenarios/default.scenario frames=3600
+//     bin/search_bench scenarios/default.scenario rollouts=384 depth=60
+//
+// Takes the same keys as scenario_runner, plus rollouts= (a search) and depth= (ticks a rollout)
+#include <raylib.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "world.h"
+#include "scenario.h"
+#include "controllers.h"
+#include "lookahead.h"
+#include "latency_histogram.h"
+
+using Clock = std::chrono::steady_clock;
+
+int main(int argc, char** argv) {
+
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " <scenario file> [rollouts=N] [depth=N] [key=value ...]" << std::endl;
+	return 1;
+    }
+
+    Scenario scenario;
+    int rollouts = 96;
+    int depth = 45;
+    if (!load_scenario(argv[1], scenario)) return 1;
+    for (int i = 2; i < argc; i++) {
+        std::string arg = argv[i];
+	size_t equals = arg.find('=');
+	std::string key = arg.substr(0, equals);
+	std::string value = equals == std::string::npos ? "" : arg.substr(equals + 1);
+	if (key == "rollouts") rollouts = std::atoi(value.c_str());
+	else if (key == "depth") depth = std::atoi(value.c_str());
+	else if (equals == std::string::npos || !set_scenario_value(scenario, key, value)) {
+	    std::cerr << "bad override '" << arg << "'" << std::endl;
+	    return 1;
+	}
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    World world(scenario.worldWidth, scenario.worldHeight, scenario.seed);
+    Entity ship = start_scenario(world, scenario);
+    if (ship == NULL_ENTITY) return 1;
+    SearchBot bot(scenario.seed, rollouts, depth);
+
+    // Capturing and cloning on their own, a few times a tick to get past the clock's resolution
+    constexpr int REPEATS = 16;
+    SimState state;
+    std::vector<SimState> clones(REPEATS);
+    double captureSeconds = 0;
+    double cloneSeconds = 0;
+    uint64_t capturedAsteroids = 0;
+
+    double botSeconds = 0;
+    int shipLostAt = -1;
+    auto runStart = Clock::now();
+    for (int frame = 0; frame < scenario.frames; frame++) {
+        auto captureStart = Clock::now();
+	for (int r = 0; r < REPEATS; r++) capture_sim_state(world, ship, SearchBot::SEARCH_RADIUS, state);
+	captureSeconds += seconds_since(captureStart);
+	capturedAsteroids += state.numAsteroids;
+	auto cloneStart = Clock::now();
+	for (SimState& clone : clones) clone = state;
+	cloneSeconds += seconds_since(cloneStart);
+
+	auto botStart = Clock::now();
+	PlayerInput input = bot.Decide(world, ship);
+	botSeconds += seconds_since(botStart);
+
+	world.Tick(input);
+	if (world.state.status == GAME_OVER && shipLostAt < 0) shipLostAt = frame;
+	world.state.status = PLAYING;
+    }
+    double runSeconds = seconds_since(runStart);
+
+    int frames = scenario.frames > 0 ? scenario.frames : 1;
+    uint64_t simTicks = bot.getRollouts() * depth;
+    std::printf("scenario        %s (seed %u), %d ticks in %.2f s\n", argv[1], scenario.seed, scenario.frames, runSeconds);
+    std::printf("search          %d rollouts of %d ticks every %d ticks\n", rollouts, depth, SearchBot::HOLD_TICKS);
+    std::printf("state           %zu bytes, %.1f asteroids on average\n", sizeof(SimState), (double)capturedAsteroids / frames);
+    std::printf("capture         %.2f us\n", 1e6 * captureSeconds / ((double)frames * REPEATS));
+    std::printf("clone           %.1f ns\n", 1e9 * cloneSeconds / ((double)frames * REPEATS));
+    std::printf("bot             %.3f ms a tick, %.3f ms a search\n", 1000 * botSeconds / frames, 1000 * botSeconds * SearchBot::HOLD_TICKS / frames);
+    std::printf("rollouts        %.0f a second, %.2f M simulated ticks a second\n", bot.getRollouts() / botSeconds, simTicks / botSeconds / 1e6);
+    std::printf("score           %d, level %d", world.state.score, world.state.level);
+    if (shipLostAt >= 0) std::printf(", ship lost at tick %d", shipLostAt);
+    std::printf("\n");
+    return 0;
+}
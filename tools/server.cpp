@@ -0,0 +1,255 @@
+// Runs a dedicated match server headless and reports how its scheduling holds up: how long
+// rounds and individual match ticks take, how the matches are spread over the workers and how
+// much traffic goes through.
+//
+//     bin/server bot_matches=500 clients=32 seconds=30
+//     bin/server bot_matches=1 spectators=1000
+//     bin/server clients=8 arena=5600x3200 asteroids=2000
+//
+// Keys: port, workers (0 for one per hardware thread), pin=0 to leave workers unpinned,
+// players (per match), mode (coop or versus), bot_matches (matches flown entirely by server-side
+// bots, topped up as they finish), bot (which bot flies them, and the loopback clients),
+// clients (loopback clients to run on a thread of their own, talking to the server over UDP
+// like remote players would), spectators (loopback spectators on another thread, who all end up
+// watching the same match), match_ticks (end matches after this many ticks), lag_comp=0 to test
+// players' shots against the present instead of what they saw, arena (WIDTHxHEIGHT of each
+// match), asteroids (extra ones each match starts with), interest=0 to send every client the
+// whole match, budget (interest management's bytes per snapshot), seconds (how long to run, 0
+// for ever) and report (seconds between progress lines). Exits with 1 if the 99th
+// percentile round took longer than a frame or a client or spectator failed to decode a snapshot
+#include <raylib.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "world.h"
+#include "controllers.h"
+#include "snapshot.h"
+#include "match_server.h"
+#include "match_client.h"
+#include "game_constants.h"
+
+using Clock = std::chrono::steady_clock;
+
+// Plays count clients against the server at address until stop is set, each with its own bot
+// deciding from the snapshots it's been sent
+static void run_clients(NetAddress address, int count, std::string botName, std::atomic<bool>& stop, MatchClientStats& total) {
+    std::vector<std::unique_ptr<MatchClient>> clients;
+    std::vector<std::unique_ptr<Controller>> bots;
+    for (int i = 0; i < count; i++) {
+        clients.push_back(std::make_unique<MatchClient>());
+	if (!clients.back()->Open(address)) return;
+	bots.push_back(make_controller(botName, 1000 + i));
+    }
+
+    World scratch(GC::SCREEN_WIDTH, GC::SCREEN_HEIGHT, 0);
+    auto frameTime = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / GC::FPS));
+    auto nextFrame = Clock::now();
+    while (!stop) {
+        for (int i = 0; i < count; i++) {
+	    MatchClient& client = *clients[i];
+	    client.Poll();
+	    PlayerInput input;
+	    double viewTick = -1;
+	    if (client.isConnected() && client.getSnapshotTick() != MATCH_NONE) {
+	        const std::vector<std::byte>& snapshot = client.getSnapshot();
+		if (load_snapshot(scratch, snapshot.data(), snapshot.size())) {
+		    input = bots[i]->Decide(scratch, scratch.getShip(client.getSlot()));
+		    viewTick = client.getSnapshotTick();
+		}
+	    }
+	    client.SendInput(input, viewTick);
+	}
+	nextFrame += frameTime;
+	std::this_thread::sleep_until(nextFrame);
+    }
+
+    for (auto& client : clients) {
+        const MatchClientStats& stats = client->getStats();
+	total.packetsSent += stats.packetsSent;
+	total.packetsReceived += stats.packetsReceived;
+	total.bytesSent += stats.bytesSent;
+	total.bytesReceived += stats.bytesReceived;
+	total.snapshots += stats.snapshots;
+	total.snapshotsSkipped += stats.snapshotsSkipped;
+	total.decodeFailures += stats.decodeFailures;
+	total.matchesJoined += stats.matchesJoined;
+	client->Close();
+    }
+}
+
+// Watches with count spectators until stop is set
+static void run_spectators(NetAddress address, int count, std::atomic<bool>& stop, MatchClientStats& total) {
+    std::vector<std::unique_ptr<MatchClient>> spectators;
+    for (int i = 0; i < count; i++) {
+        spectators.push_back(std::make_unique<MatchClient>());
+	if (!spectators.back()->OpenSpectator(address)) return;
+    }
+
+    auto frameTime = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / GC::FPS));
+    auto nextFrame = Clock::now();
+    while (!stop) {
+        for (auto& spectator : spectators) spectator->Poll();
+	nextFrame += frameTime;
+	std::this_thread::sleep_until(nextFrame);
+    }
+
+    for (auto& spectator : spectators) {
+        const MatchClientStats& stats = spectator->getStats();
+	total.packetsReceived += stats.packetsReceived;
+	total.bytesReceived += stats.bytesReceived;
+	total.snapshots += stats.snapshots;
+	total.snapshotsSkipped += stats.snapshotsSkipped;
+	total.decodeFailures += stats.decodeFailures;
+	total.matchesJoined += stats.matchesJoined;
+	spectator->Close();
+    }
+}
+
+static void print_stats(const MatchServer& server, const ServerStats& stats, double seconds, int overruns) {
+    std::vector<int> counts;
+    std::vector<double> costMs;
+    server.getWorkerLoads(counts, costMs);
+    std::printf("matches         %d running, %d clients, %llu started, %llu finished\n", server.getNumMatches(), server.getNumClients(), (unsigned long long)stats.matchesStarted, (unsigned long long)stats.matchesFinished);
+    std::printf("rounds          %llu, p50 %.3f ms, p99 %.3f ms, max %.3f ms, %d over a frame\n", (unsigned long long)stats.rounds.getCount(), stats.rounds.PercentileMs(0.5), stats.rounds.PercentileMs(0.99), stats.rounds.getMaxMs(), overruns);
+    std::printf("match ticks     %llu, p50 %.3f ms, p99 %.3f ms, max %.3f ms\n", (unsigned long long)stats.matchTicks.getCount(), stats.matchTicks.PercentileMs(0.5), stats.matchTicks.PercentileMs(0.99), stats.matchTicks.getMaxMs());
+    std::printf("workers         ");
+    for (size_t i = 0; i < counts.size(); i++) std::printf("%s%d (%.2f ms)", i ? ", " : "", counts[i], costMs[i]);
+    std::printf(", %llu migrations\n", (unsigned long long)stats.migrations);
+    std::printf("traffic         %.0f packets/s in, %.0f out, %.1f KiB/s in, %.1f out, %llu ignored\n", stats.packetsIn / seconds, stats.packetsOut / seconds, stats.bytesIn / 1024.0 / seconds, stats.bytesOut / 1024.0 / seconds, (unsigned long long)stats.packetsIgnored);
+    std::printf("inputs          %llu applied, %llu missing, %llu dropped\n", (unsigned long long)stats.inputsApplied, (unsigned long long)stats.inputsMissing, (unsigned long long)stats.inputsDropped);
+    std::printf("snapshots       %llu deltas, %llu keyframes, %llu too big to send\n", (unsigned long long)stats.deltas, (unsigned long long)stats.keyframes, (unsigned long long)stats.oversized);
+    if (stats.interestSnapshots > 0) {
+        double perSnapshot = 1.0 / stats.interestSnapshots;
+	std::printf("interest        %.1f entities a snapshot, %.2f sent or corrected, %.2f deferred\n", stats.interestEntities * perSnapshot, stats.interestUpdates * perSnapshot, stats.interestDeferred * perSnapshot);
+    }
+    if (stats.rewinds.getCount() > 0) {
+        std::printf("lag comp        shots rewound %.0f ms p50, %.0f ms p99; %llu bullet tests, %llu hits, %llu past the history; query p50 %.2f us, p99 %.2f us\n", stats.rewinds.PercentileMs(0.5), stats.rewinds.PercentileMs(0.99), (unsigned long long)stats.rewoundTests, (unsigned long long)stats.rewoundHits, (unsigned long long)stats.rewindsClamped, 1000 * stats.rewindQueries.PercentileMs(0.5), 1000 * stats.rewindQueries.PercentileMs(0.99));
+    }
+    FanoutStats fanout = server.getFanoutStats();
+    if (fanout.frames > 0) {
+        std::printf("spectators      %d watching, %llu snapshots (%llu keyframes), %llu sent, %.1f KiB/s, %llu failed, %llu dropped, %llu oversized\n", server.getNumSpectators(), (unsigned long long)stats.spectatorSnapshots, (unsigned long long)stats.spectatorKeyframes, (unsigned long long)fanout.sends, fanout.bytes / 1024.0 / seconds, (unsigned long long)fanout.failed, (unsigned long long)fanout.dropped, (unsigned long long)fanout.oversized);
+	std::printf("fanout          encode p50 %.3f ms, p99 %.3f ms; send to everyone watching p50 %.3f ms, p99 %.3f ms, max %.3f ms\n", fanout.encodeTimes.PercentileMs(0.5), fanout.encodeTimes.PercentileMs(0.99), fanout.sendTimes.PercentileMs(0.5), fanout.sendTimes.PercentileMs(0.99), fanout.sendTimes.getMaxMs());
+    }
+}
+
+int main(int argc, char** argv) {
+
+    ServerConfig config;
+    int botMatches = 0;
+    int numClients = 0;
+    int numSpectators = 0;
+    std::string botName = "random";
+    double runSeconds = 10;
+    double reportSeconds = 1;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+	size_t equals = arg.find('=');
+	std::string key = arg.substr(0, equals);
+	std::string value = equals == std::string::npos ? "" : arg.substr(equals + 1);
+	if (key == "port") config.port = (uint16_t)std::atoi(value.c_str());
+	else if (key == "workers") config.workers = std::atoi(value.c_str());
+	else if (key == "pin") config.pinWorkers = value == "1";
+	else if (key == "players") config.playersPerMatch = std::atoi(value.c_str());
+	else if (key == "mode" && (value == "coop" || value == "versus")) config.mode = value == "coop" ? COOP : VERSUS;
+	else if (key == "match_ticks") config.matchTicks = (uint32_t)std::strtoul(value.c_str(), nullptr, 10);
+	else if (key == "lag_comp") config.lagCompensation = value == "1";
+	else if (key == "arena" && std::sscanf(value.c_str(), "%dx%d", &config.arenaWidth, &config.arenaHeight) == 2) {}
+	else if (key == "asteroids") config.extraAsteroids = std::atoi(value.c_str());
+	else if (key == "interest") config.interestManagement = value == "1";
+	else if (key == "budget") config.interest.budgetBytes = std::atoi(value.c_str());
+	else if (key == "bot_matches") botMatches = std::atoi(value.c_str());
+	else if (key == "bot") botName = value;
+	else if (key == "clients") numClients = std::atoi(value.c_str());
+	else if (key == "spectators") numSpectators = std::atoi(value.c_str());
+	else if (key == "seconds") runSeconds = std::atof(value.c_str());
+	else if (key == "report") reportSeconds = std::atof(value.c_str());
+	else {
+	    std::cerr << "bad argument '" << arg << "'" << std::endl;
+	    return 1;
+	}
+    }
+
+    if (config.playersPerMatch < 1 || config.playersPerMatch > GC::MAX_PLAYERS || config.arenaWidth < 1 || config.arenaHeight < 1 || !make_controller(botName, 0)) {
+        std::cerr << "usage: " << argv[0] << " [port=N] [workers=N] [pin=0|1] [players=1.." << GC::MAX_PLAYERS << "] [mode=coop|versus] [bot_matches=N] [bot=NAME] [clients=N] [spectators=N] [match_ticks=N] [lag_comp=0|1] [arena=WxH] [asteroids=N] [interest=0|1] [budget=N] [seconds=N] [report=N]" << std::endl;
+	return 1;
+    }
+    if (botMatches + numClients > config.maxMatches) config.maxMatches = botMatches + numClients;
+    if (numSpectators > config.maxSpectators) config.maxSpectators = numSpectators;
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    MatchServer server(config);
+    if (!server.Start()) {
+        std::cerr << "server: can't open port " << config.port << std::endl;
+	return 1;
+    }
+    std::printf("listening on port %u with %d workers\n", server.getPort(), server.getNumWorkers());
+
+    std::atomic<bool> stop(false);
+    MatchClientStats clientStats;
+    MatchClientStats spectatorStats;
+    std::thread clientThread;
+    std::thread spectatorThread;
+    if (numClients > 0) clientThread = std::thread(run_clients, NetAddress{0x7f000001, server.getPort()}, numClients, botName, std::ref(stop), std::ref(clientStats));
+    if (numSpectators > 0) spectatorThread = std::thread(run_spectators, NetAddress{0x7f000001, server.getPort()}, numSpectators, std::ref(stop), std::ref(spectatorStats));
+
+    // Matches the loopback clients need, which the bot matches shouldn't be counted against
+    int clientMatches = (numClients + config.playersPerMatch - 1) / config.playersPerMatch;
+    double budgetMs = 1000.0 / GC::FPS;
+    int overruns = 0;
+
+    auto frameTime = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / GC::FPS));
+    auto start = Clock::now();
+    auto nextFrame = start;
+    auto nextReport = start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(reportSeconds));
+    while (runSeconds <= 0 || Clock::now() - start < std::chrono::duration<double>(runSeconds)) {
+        // Keep the bot matches topped up as they end
+        while (server.getNumMatches() < botMatches + clientMatches && server.getNumMatches() - server.getNumClients() / config.playersPerMatch < botMatches) {
+	    if (!server.AddBotMatch(botName)) break;
+	}
+
+	auto roundStart = Clock::now();
+	server.RunRound();
+	if (std::chrono::duration<double, std::milli>(Clock::now() - roundStart).count() > budgetMs) overruns++;
+
+	if (reportSeconds > 0 && Clock::now() >= nextReport) {
+	    ServerStats stats = server.getStats();
+	    std::printf("%6.1f s  %d matches, %d clients, %d spectators, round p99 %.3f ms, tick p99 %.3f ms, %llu migrations\n", std::chrono::duration<double>(Clock::now() - start).count(), server.getNumMatches(), server.getNumClients(), server.getNumSpectators(), stats.rounds.PercentileMs(0.99), stats.matchTicks.PercentileMs(0.99), (unsigned long long)stats.migrations);
+	    std::fflush(stdout);
+	    nextReport += std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(reportSeconds));
+	}
+
+	nextFrame += frameTime;
+	if (Clock::now() < nextFrame) std::this_thread::sleep_until(nextFrame);
+	else nextFrame = Clock::now();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    stop = true;
+    if (clientThread.joinable()) clientThread.join();
+    if (spectatorThread.joinable()) spectatorThread.join();
+    // Let the server hear the clients leave
+    server.RunRound();
+
+    ServerStats stats = server.getStats();
+    print_stats(server, stats, seconds, overruns);
+    if (numClients > 0) {
+        std::printf("clients         %d joined %d matches, %llu snapshots, %llu skipped, %llu failed to decode, %.2f KiB/s each\n", numClients, clientStats.matchesJoined, (unsigned long long)clientStats.snapshots, (unsigned long long)clientStats.snapshotsSkipped, (unsigned long long)clientStats.decodeFailures, clientStats.bytesReceived / 1024.0 / seconds / numClients);
+    }
+
+    if (numSpectators > 0) {
+        std::printf("watched         %d spectators joined %d times, %llu snapshots, %llu skipped, %llu failed to decode\n", numSpectators, spectatorStats.matchesJoined, (unsigned long long)spectatorStats.snapshots, (unsigned long long)spectatorStats.snapshotsSkipped, (unsigned long long)spectatorStats.decodeFailures);
+    }
+
+    bool ok = stats.rounds.PercentileMs(0.99) <= budgetMs && clientStats.decodeFailures == 0 && spectatorStats.decodeFailures == 0;
+    if (stats.rounds.PercentileMs(0.99) > budgetMs) std::cerr << "server: 99th percentile round took longer than a frame" << std::endl;
+    if (clientStats.decodeFailures || spectatorStats.decodeFailures) std::cerr << "server: clients failed to decode snapshots" << std::endl;
+    return ok ? 0 : 1;
+}
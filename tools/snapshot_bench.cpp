@@ -0,0 +1,156 @@
+// Plays a scenario and, every tick, snapshots the world and delta-encodes the snapshot against
+// the previous tick's, once at the lossy precision and once losslessly. Reports how big the
+// snapshots and deltas are and how fast they encode and decode.
+//
+//     bin/snapshot_bench scenarios/stress.scenario [key=value ...]
+//
+// Takes the same keys as scenario_runner, plus position_step=, velocity_step= (the lossy
+// precision, in pixels and pixels per frame) and keyframe_interval= (encode against nothing
+// every so many ticks, as a stream that late joiners can start from would)
+#include <raylib.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include "world.h"
+#include "scenario.h"
+#include "controllers.h"
+#include "snapshot.h"
+#include "snapshot_delta.h"
+#include "latency_histogram.h"
+
+using Clock = std::chrono::steady_clock;
+
+// Totals for one codec over the run
+struct CodecTotals {
+    const char* name;
+    SnapshotDeltaCodec codec;
+    std::vector<uint8_t> delta;
+    std::vector<std::byte> decoded;
+    // What the decoder holds, and so what the next delta is encoded against
+    std::vector<std::byte> reference;
+    double encodeSeconds = 0;
+    double decodeSeconds = 0;
+    // Deltas against a previous tick, and against nothing (the first tick and keyframes)
+    uint64_t deltaBytes = 0;
+    uint64_t maxDeltaBytes = 0;
+    int numDeltas = 0;
+    uint64_t keyframeBytes = 0;
+    int numKeyframes = 0;
+    uint64_t unchanged = 0;
+    uint64_t changed = 0;
+    uint64_t added = 0;
+    int failures = 0;
+
+    CodecTotals(const char* n, DeltaPrecision p) : name(n), codec(p) {}
+};
+
+int main(int argc, char** argv) {
+
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " <scenario file> [key=value ...]" << std::endl;
+	return 1;
+    }
+
+    Scenario scenario;
+    DeltaPrecision precision;
+    int keyframeInterval = 0;
+    if (!load_scenario(argv[1], scenario)) return 1;
+    for (int i = 2; i < argc; i++) {
+        std::string arg = argv[i];
+	size_t equals = arg.find('=');
+	std::string key = arg.substr(0, equals);
+	std::string value = equals == std::string::npos ? "" : arg.substr(equals + 1);
+	if (key == "position_step") precision.position = std::atof(value.c_str());
+	else if (key == "velocity_step") precision.velocity = std::atof(value.c_str());
+	else if (key == "keyframe_interval") keyframeInterval = std::atoi(value.c_str());
+	else if (equals == std::string::npos || !set_scenario_value(scenario, key, value)) {
+	    std::cerr << "bad override '" << arg << "'" << std::endl;
+	    return 1;
+	}
+    }
+
+    std::unique_ptr<Controller> bot = make_controller(scenario.bot, scenario.seed);
+    if (!bot) {
+        std::cerr << "unknown bot '" << scenario.bot << "'" << std::endl;
+	return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    World world(scenario.worldWidth, scenario.worldHeight, scenario.seed);
+    Entity ship = start_scenario(world, scenario);
+    if (ship == NULL_ENTITY) return 1;
+
+    CodecTotals codecs[2] = {{"lossy", precision}, {"lossless", LOSSLESS_PRECISION}};
+    std::vector<std::byte> snapshot;
+    double saveSeconds = 0;
+    uint64_t snapshotBytes = 0;
+    uint64_t entities = 0;
+
+    for (int frame = 0; frame < scenario.frames; frame++) {
+	world.Tick(bot->Decide(world, ship));
+	world.state.status = PLAYING;
+
+	auto saveStart = Clock::now();
+	save_snapshot(world, snapshot);
+	saveSeconds += seconds_since(saveStart);
+	snapshotBytes += snapshot.size();
+	entities += world.registry.getNumEntities();
+
+	bool keyframe = keyframeInterval > 0 && frame % keyframeInterval == 0;
+	for (CodecTotals& c : codecs) {
+	    if (keyframe) c.reference.clear();
+	    bool againstNothing = c.reference.empty();
+
+	    auto encodeStart = Clock::now();
+	    c.codec.Encode(c.reference.data(), c.reference.size(), snapshot.data(), snapshot.size(), c.delta);
+	    c.encodeSeconds += seconds_since(encodeStart);
+
+	    DeltaStats stats = c.codec.getStats();
+	    if (againstNothing) {
+	        c.keyframeBytes += stats.bytes;
+		c.numKeyframes++;
+	    } else {
+	        c.deltaBytes += stats.bytes;
+		c.maxDeltaBytes = std::max<uint64_t>(c.maxDeltaBytes, stats.bytes);
+		c.numDeltas++;
+	    }
+	    c.unchanged += stats.unchanged;
+	    c.changed += stats.changed;
+	    c.added += stats.added;
+
+	    auto decodeStart = Clock::now();
+	    bool decoded = c.codec.Decode(c.reference.data(), c.reference.size(), c.delta.data(), c.delta.size(), c.decoded);
+	    c.decodeSeconds += seconds_since(decodeStart);
+
+	    // Lossless deltas have to give back the very same snapshot
+	    if (!decoded || (&c == &codecs[1] && (c.decoded.size() != snapshot.size() || std::memcmp(c.decoded.data(), snapshot.data(), snapshot.size()) != 0))) c.failures++;
+	    std::swap(c.reference, c.decoded);
+	}
+    }
+
+    int frames = scenario.frames > 0 ? scenario.frames : 1;
+    double mib = 1024.0 * 1024.0;
+    std::printf("scenario        %s (seed %u, bot %s)\n", argv[1], scenario.seed, scenario.bot.c_str());
+    std::printf("world           %dx%d, %.0f entities on average, %d ticks\n", world.width, world.height, (double)entities / frames, scenario.frames);
+    std::printf("precision       %g px, %g px/frame (lossy)\n", precision.position, precision.velocity);
+    std::printf("snapshot        %.1f KiB/tick, saved at %.0f MiB/s (%.3f ms/tick)\n", snapshotBytes / 1024.0 / frames, snapshotBytes / mib / saveSeconds, 1000 * saveSeconds / frames);
+    std::printf("codec         keyframe bytes  delta bytes  max bytes     ratio unchanged  changed    new   encode MiB/s  decode MiB/s  encode ms  decode ms  failures\n");
+    for (CodecTotals& c : codecs) {
+        uint64_t total = c.unchanged + c.changed + c.added;
+	if (total == 0) total = 1;
+	double deltaBytes = c.numDeltas ? (double)c.deltaBytes / c.numDeltas : 0;
+	std::printf("  %-12s%14.0f%13.0f%11llu%9.1fx%9.1f%%%8.1f%%%6.1f%%%15.0f%14.0f%11.3f%11.3f%10d\n", c.name,
+	    c.numKeyframes ? (double)c.keyframeBytes / c.numKeyframes : 0.0, deltaBytes, (unsigned long long)c.maxDeltaBytes, deltaBytes > 0 ? snapshotBytes / frames / deltaBytes : 0.0,
+	    100.0 * c.unchanged / total, 100.0 * c.changed / total, 100.0 * c.added / total,
+	    snapshotBytes / mib / c.encodeSeconds, snapshotBytes / mib / c.decodeSeconds,
+	    1000 * c.encodeSeconds / frames, 1000 * c.decodeSeconds / frames, c.failures);
+    }
+    std::printf("ratio is snapshot size over delta size, throughput is in bytes of full snapshot per second\n");
+
+    int failures = codecs[0].failures + codecs[1].failures;
+    return failures == 0 ? 0 : 1;
+}
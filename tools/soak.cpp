@@ -0,0 +1,90 @@
+// Plays a scenario headless for a long time, sampling memory, allocations and frame times, and
+// fails if memory or p99 frame time trends upward.
+//
+//     bin/soak scenarios/default.scenario duration=14400 [sample=60] [paced=1] [key=value ...]
+//
+// Soak settings: duration, sample, warmup (seconds), max_rss_growth_mib, max_p99_ratio, and
+// paced=1 to tick at the game's frame rate instead of flat out. Any other key=value overrides
+// the scenario. The game restarts whenever the ship is destroyed. Exits with 1 on failure
+#include <raylib.h>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include "world.h"
+#include "scenario.h"
+#include "controllers.h"
+#include "soak_monitor.h"
+#include "game_constants.h"
+
+int main(int argc, char** argv) {
+
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " <scenario file> [duration=SECONDS] [sample=SECONDS] [warmup=SECONDS] [max_rss_growth_mib=N] [max_p99_ratio=N] [paced=0|1] [key=value ...]" << std::endl;
+	return 1;
+    }
+
+    Scenario scenario;
+    if (!load_scenario(argv[1], scenario)) return 1;
+
+    SoakConfig config;
+    bool paced = false;
+    for (int i = 2; i < argc; i++) {
+        std::string arg = argv[i];
+	size_t equals = arg.find('=');
+	if (equals == std::string::npos) {
+	    std::cerr << "bad argument '" << arg << "'" << std::endl;
+	    return 1;
+	}
+	std::string key = arg.substr(0, equals);
+	std::string value = arg.substr(equals + 1);
+
+	if (key == "duration") config.durationSeconds = std::atof(value.c_str());
+	else if (key == "sample") config.sampleSeconds = std::atof(value.c_str());
+	else if (key == "warmup") config.warmupSeconds = std::atof(value.c_str());
+	else if (key == "max_rss_growth_mib") config.maxRssGrowthMiB = std::atof(value.c_str());
+	else if (key == "max_p99_ratio") config.maxP99GrowthRatio = std::atof(value.c_str());
+	else if (key == "paced") paced = value == "1";
+	else if (!set_scenario_value(scenario, key, value)) return 1;
+    }
+    if (!check_soak_config(config)) return 1;
+
+    std::unique_ptr<Controller> bot = make_controller(scenario.bot, scenario.seed);
+    if (!bot) {
+        std::cerr << "unknown bot '" << scenario.bot << "'" << std::endl;
+	return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    World world(scenario.worldWidth, scenario.worldHeight, scenario.seed);
+    Entity ship = start_scenario(world, scenario);
+    SoakMonitor monitor(config);
+
+    const auto frameBudget = std::chrono::duration<double>(1.0 / GC::FPS);
+    auto start = std::chrono::steady_clock::now();
+    auto nextFrame = start;
+    long long restarts = 0;
+
+    while (monitor.Update(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count())) {
+        auto frameStart = std::chrono::steady_clock::now();
+
+	world.Tick(bot->Decide(world, ship));
+	if (world.state.status == GAME_OVER) {
+	    ship = start_scenario(world, scenario);
+	    restarts++;
+	}
+	world.state.status = PLAYING;
+
+	monitor.RecordFrame(std::chrono::duration<double>(std::chrono::steady_clock::now() - frameStart).count());
+
+	if (paced) {
+	    nextFrame += std::chrono::duration_cast<std::chrono::steady_clock::duration>(frameBudget);
+	    std::this_thread::sleep_until(nextFrame);
+	}
+    }
+
+    std::printf("[soak] %lld restarts\n", restarts);
+    return monitor.Passed() ? 0 : 1;
+}